@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+Turn framebuffer snapshots streamed over the serial console into PNG files.
+
+Take snapshots with the 'fbsnap' console command while logging
+    idf.py monitor | tee screen.log
+('fbsnap' for the whole framebuffer, 'fbsnap dirty' for the regions of the next
+screen update), then run
+    ./fb_snapshot_to_png.py screen.log [prefix] [--raw]
+Every snapshot in the log becomes <prefix>-<seq>.png (default prefix 'screen').
+A dirty snapshot is painted over the screen as the snapshots before it left it
+(black if there were none), with a red outline around the updated regions.
+Images are rotated to the way the screen is held, --raw keeps the panel layout.
+
+The format is described in main/fb_snapshot.h.
+"""
+
+import base64
+import struct
+import sys
+import zlib
+
+def decode_rle(data, bpp, count):
+    """Return 'count' pixels of 'bpp' bytes each from the RLE stream."""
+    out = bytearray()
+    position = 0
+    while len(out) < count * bpp:
+        control = data[position]
+        position += 1
+        if control < 128:
+            length = (control + 1) * bpp
+            out += data[position:position + length]
+            position += length
+        else:
+            out += data[position:position + bpp] * (control - 127)
+            position += bpp
+    if len(out) != count * bpp:
+        raise ValueError("RLE data does not match the region size")
+    return out
+
+def to_rgb(pixels, pixel_format, byte_order):
+    """Convert native framebuffer pixels to (r, g, b) tuples."""
+    rgb = []
+    if pixel_format == "rgb565":
+        for i in range(0, len(pixels), 2):
+            if byte_order == "le":
+                value = pixels[i] | (pixels[i + 1] << 8)
+            else:
+                value = (pixels[i] << 8) | pixels[i + 1]
+            r = (value >> 11) & 0x1F
+            g = (value >> 5) & 0x3F
+            b = value & 0x1F
+            rgb.append(((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)))
+    else:
+        for i in range(0, len(pixels), 3):
+            if byte_order == "le":
+                rgb.append((pixels[i + 2], pixels[i + 1], pixels[i]))
+            else:
+                rgb.append((pixels[i], pixels[i + 1], pixels[i + 2]))
+    return rgb
+
+def parse_log(lines):
+    """Yield a dict per complete snapshot in the log."""
+    snapshot = None
+    rect = None
+    for line in lines:
+        start = line.find("FB")
+        if start < 0:
+            continue
+        parts = line[start:].split()
+        try:
+            if parts[0] == "FB-START" and len(parts) == 8:
+                snapshot = {"seq": int(parts[1]), "width": int(parts[2]), "height": int(parts[3]),
+                            "format": parts[4], "order": parts[5], "orientation": parts[6],
+                            "count": int(parts[7]), "rects": []}
+                rect = None
+            elif snapshot is None:
+                continue
+            elif parts[0] == "FB-RECT" and len(parts) == 5:
+                rect = [int(parts[1]), int(parts[2]), int(parts[3]), int(parts[4]), bytearray()]
+                snapshot["rects"].append(rect)
+            elif parts[0] == "FB" and len(parts) == 2 and rect is not None:
+                rect[4] += base64.b64decode(parts[1], validate=True)
+            elif parts[0] == "FB-STOP" and len(parts) == 6:
+                if int(parts[1]) == snapshot["seq"] and len(snapshot["rects"]) == snapshot["count"]:
+                    snapshot["stats"] = [int(p) for p in parts[2:]]
+                    yield snapshot
+                snapshot = None
+        except ValueError:
+            snapshot = None  # Line mangled by other console output, drop the snapshot
+
+def write_png(path, width, height, rows):
+    """Write 8-bit RGB rows (lists of (r, g, b)) as a PNG file."""
+    raw = bytearray()
+    for row in rows:
+        raw.append(0)  # Filter type none
+        for r, g, b in row:
+            raw += bytes((r, g, b))
+
+    def chunk(kind, data):
+        return struct.pack(">I", len(data)) + kind + data + struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF)
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+def to_screen(canvas, width, height, orientation):
+    """Rotate panel rows to screen rows, the inverse of fb_region_to_raw()."""
+    if orientation == "ccw":
+        return [[canvas[height - 1 - sx][sy] for sx in range(height)] for sy in range(width)]
+    if orientation == "half":
+        return [[canvas[height - 1 - sy][width - 1 - sx] for sx in range(width)] for sy in range(height)]
+    if orientation == "cw":
+        return [[canvas[sx][width - 1 - sy] for sx in range(height)] for sy in range(width)]
+    return canvas
+
+def main():
+    args = [a for a in sys.argv[1:] if a != "--raw"]
+    keep_raw = "--raw" in sys.argv[1:]
+    if not args:
+        print(f"Usage: {sys.argv[0]} <serial log> [prefix] [--raw]")
+        sys.exit(1)
+
+    input_path = args[0]
+    prefix = args[1] if len(args) > 1 else "screen"
+
+    background = None  # Panel pixels as of the last snapshot
+    written = 0
+    with open(input_path, "r", errors="replace") as f:
+        for snapshot in parse_log(f):
+            width = snapshot["width"]
+            height = snapshot["height"]
+            bpp = 2 if snapshot["format"] == "rgb565" else 3
+            full = (len(snapshot["rects"]) == 1 and snapshot["rects"][0][:4] == [0, 0, width, height])
+            if full or background is None or len(background) != height or len(background[0]) != width:
+                canvas = [[(0, 0, 0)] * width for _ in range(height)]
+            else:
+                canvas = [list(row) for row in background]
+
+            try:
+                for x, y, w, h, data in snapshot["rects"]:
+                    pixels = to_rgb(decode_rle(data, bpp, w * h), snapshot["format"], snapshot["order"])
+                    for row in range(h):
+                        canvas[y + row][x:x + w] = pixels[row * w:(row + 1) * w]
+            except (ValueError, IndexError):
+                print(f"Snapshot {snapshot['seq']}: corrupted, skipped")
+                continue
+
+            background = [list(row) for row in canvas]
+            if not full:
+                # Outline the updated regions
+                for x, y, w, h, _ in snapshot["rects"]:
+                    for sx in range(x, x + w):
+                        canvas[y][sx] = canvas[y + h - 1][sx] = (255, 0, 0)
+                    for sy in range(y, y + h):
+                        canvas[sy][x] = canvas[sy][x + w - 1] = (255, 0, 0)
+
+            orientation = "upright" if keep_raw else snapshot["orientation"]
+            if orientation == "other":
+                print(f"Snapshot {snapshot['seq']}: unknown orientation, written as the panel sees it")
+            rows = to_screen(canvas, width, height, orientation)
+            path = f"{prefix}-{snapshot['seq']}.png"
+            write_png(path, len(rows[0]), len(rows), rows)
+            written += 1
+
+            raw_bytes, coded_bytes, copy_us, encode_us = snapshot["stats"]
+            kind = "full" if full else f"{len(snapshot['rects'])} region(s)"
+            print(f"Output: {path} ({kind}, {coded_bytes} of {raw_bytes} bytes, "
+                  f"copy {copy_us} us, encode {encode_us} us)")
+
+    if written == 0:
+        print("No snapshots found in input")
+        sys.exit(1)
+
+if __name__ == "__main__":
+    main()
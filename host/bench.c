@@ -0,0 +1,25 @@
+// Host benchmark: the console's 'bench' on the PC
+//
+// Runs the same benchmarks (dsp_bench.c) after the same start up as the
+// firmware (dsp_arena_init(), synth_init(); synth.c is included as in the
+// tests) and prints the same lines, so a change to a DSP loop can be compared
+// before and after without a badge. The figures are the PC's: the P4 figures
+// come from 'bench' on the device.
+//
+//   bench [name] [blocks]
+
+#include "synth.c"
+#include "dsp_bench.h"
+
+int main(int argc, char** argv) {
+    int blocks = argc > 2 ? atoi(argv[2]) : 10000;
+    if (blocks < 1) blocks = 1;
+
+    dsp_arena_init();
+    synth_init(NULL);
+    if (!dsp_bench_run(argc > 1 ? argv[1] : NULL, blocks)) {
+        printf("Unknown benchmark '%s'\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
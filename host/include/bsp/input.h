@@ -0,0 +1,8 @@
+// Host build: the one BSP input definition keyboard_notes.h needs
+
+#ifndef BSP_INPUT_H
+#define BSP_INPUT_H
+
+#define BSP_INPUT_SCANCODE_RELEASE_MODIFIER 0x80
+
+#endif  // BSP_INPUT_H
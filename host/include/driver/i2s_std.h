@@ -0,0 +1,59 @@
+// Host build: I2S channel types; there is no channel, synth_init() gets NULL
+
+#ifndef DRIVER_I2S_STD_H
+#define DRIVER_I2S_STD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct i2s_channel* i2s_chan_handle_t;
+
+typedef enum {
+    I2S_DATA_BIT_WIDTH_16BIT = 16,
+    I2S_DATA_BIT_WIDTH_24BIT = 24,
+    I2S_DATA_BIT_WIDTH_32BIT = 32,
+} i2s_data_bit_width_t;
+
+typedef enum {
+    I2S_SLOT_MODE_MONO   = 1,
+    I2S_SLOT_MODE_STEREO = 2,
+} i2s_slot_mode_t;
+
+typedef struct {
+    i2s_data_bit_width_t data_bit_width;
+    i2s_slot_mode_t      slot_mode;
+} i2s_std_slot_config_t;
+
+typedef struct {
+    uint32_t sample_rate_hz;
+} i2s_std_clk_config_t;
+
+typedef struct {
+    void*  data;
+    size_t size;
+} i2s_event_data_t;
+
+typedef bool (*i2s_isr_callback_t)(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx);
+
+typedef struct {
+    i2s_isr_callback_t on_recv;
+    i2s_isr_callback_t on_recv_q_ovf;
+    i2s_isr_callback_t on_sent;
+    i2s_isr_callback_t on_send_q_ovf;
+} i2s_event_callbacks_t;
+
+#define I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(bits, mode) {.data_bit_width = (bits), .slot_mode = (mode)}
+#define I2S_STD_CLK_DEFAULT_CONFIG(rate)                {.sample_rate_hz = (rate)}
+
+esp_err_t i2s_channel_write(i2s_chan_handle_t handle, const void* src, size_t size, size_t* bytes_written,
+                            uint32_t timeout_ms);
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle);
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle);
+esp_err_t i2s_channel_reconfig_std_slot(i2s_chan_handle_t handle, const i2s_std_slot_config_t* slot_cfg);
+esp_err_t i2s_channel_reconfig_std_clock(i2s_chan_handle_t handle, const i2s_std_clk_config_t* clk_cfg);
+esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle, const i2s_event_callbacks_t* callbacks,
+                                              void* user_data);
+
+#endif  // DRIVER_I2S_STD_H
@@ -0,0 +1,19 @@
+// Host build: SD card host types, only as far as wavetable.c names them
+
+#ifndef DRIVER_SDMMC_HOST_H
+#define DRIVER_SDMMC_HOST_H
+
+typedef struct {
+    int slot;
+} sdmmc_host_t;
+
+typedef struct {
+    int width;
+} sdmmc_slot_config_t;
+
+typedef struct sdmmc_card sdmmc_card_t;
+
+#define SDMMC_HOST_DEFAULT()        {0}
+#define SDMMC_SLOT_CONFIG_DEFAULT() {0}
+
+#endif  // DRIVER_SDMMC_HOST_H
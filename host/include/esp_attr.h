@@ -0,0 +1,10 @@
+// Host build: memory placement attributes mean nothing on the PC
+
+#ifndef ESP_ATTR_H
+#define ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define EXT_RAM_BSS_ATTR
+
+#endif  // ESP_ATTR_H
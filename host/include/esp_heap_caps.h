@@ -0,0 +1,21 @@
+// Host build: every capability is served by the C heap
+
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_DMA      (1 << 3)
+#define MALLOC_CAP_SPIRAM   (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+void*  heap_caps_malloc(size_t size, uint32_t caps);
+void*  heap_caps_calloc(size_t count, size_t size, uint32_t caps);
+void*  heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+void*  heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void   heap_caps_free(void* ptr);
+size_t heap_caps_get_free_size(uint32_t caps);
+
+#endif  // ESP_HEAP_CAPS_H
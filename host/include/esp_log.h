@@ -0,0 +1,13 @@
+// Host build: log lines go to stderr, tagged like on the device
+
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+#include <stdio.h>
+
+#define ESP_LOGE(tag, format, ...) fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) fprintf(stderr, "I (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ((void)(tag))
+
+#endif  // ESP_LOG_H
@@ -0,0 +1,28 @@
+// Host build: network interfaces, there are none
+
+#ifndef ESP_NETIF_H
+#define ESP_NETIF_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef struct esp_netif_obj esp_netif_t;
+
+typedef struct {
+    uint32_t addr;
+} esp_ip4_addr_t;
+
+typedef struct {
+    esp_ip4_addr_t ip;
+    esp_ip4_addr_t netmask;
+    esp_ip4_addr_t gw;
+} esp_netif_ip_info_t;
+
+#define IPSTR "%d.%d.%d.%d"
+#define IP2BYTE(ipaddr, n) (int)(((ipaddr)->addr >> (8 * (n))) & 0xff)
+#define IP2STR(ipaddr)      IP2BYTE(ipaddr, 0), IP2BYTE(ipaddr, 1), IP2BYTE(ipaddr, 2), IP2BYTE(ipaddr, 3)
+
+esp_netif_t* esp_netif_get_handle_from_ifkey(const char* if_key);
+esp_err_t    esp_netif_get_ip_info(esp_netif_t* netif, esp_netif_ip_info_t* ip_info);
+
+#endif  // ESP_NETIF_H
@@ -0,0 +1,10 @@
+// Host build: microseconds of the monotonic clock
+
+#ifndef ESP_TIMER_H
+#define ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time(void);
+
+#endif  // ESP_TIMER_H
@@ -0,0 +1,20 @@
+// Host build: there is no SD card, mounting fails
+
+#ifndef ESP_VFS_FAT_H
+#define ESP_VFS_FAT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "driver/sdmmc_host.h"
+#include "esp_err.h"
+
+typedef struct {
+    bool   format_if_mount_failed;
+    int    max_files;
+    size_t allocation_unit_size;
+} esp_vfs_fat_sdmmc_mount_config_t;
+
+esp_err_t esp_vfs_fat_sdmmc_mount(const char* base_path, const sdmmc_host_t* host, const void* slot_config,
+                                  const esp_vfs_fat_sdmmc_mount_config_t* mount_config, sdmmc_card_t** card);
+
+#endif  // ESP_VFS_FAT_H
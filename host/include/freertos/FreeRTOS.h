@@ -0,0 +1,31 @@
+// Host build: FreeRTOS types and constants
+//
+// The host programs run single threaded: tasks are never started, the
+// programs call the work a task would do themselves (see port.c).
+
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t)0xffffffff)
+#define portTICK_PERIOD_MS      1
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+#define configMAX_PRIORITIES    25
+#define configMAX_TASK_NAME_LEN 16
+#define tskIDLE_PRIORITY        0
+#define tskNO_AFFINITY          0x7fffffff
+
+BaseType_t xPortGetCoreID(void);
+
+#endif  // FREERTOS_H
@@ -0,0 +1,19 @@
+// Host build: FreeRTOS tasks
+
+#ifndef FREERTOS_TASK_H
+#define FREERTOS_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct task* TaskHandle_t;
+typedef void (*TaskFunction_t)(void* arg);
+
+BaseType_t   xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack_depth, void* arg,
+                                     UBaseType_t priority, TaskHandle_t* handle, BaseType_t core);
+void         vTaskDelete(TaskHandle_t task);
+void         vTaskDelay(TickType_t ticks);
+TickType_t   xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+char*        pcTaskGetName(TaskHandle_t task);
+
+#endif  // FREERTOS_TASK_H
@@ -0,0 +1,11 @@
+// Host build: lwIP's BSD sockets are the host's own
+
+#ifndef LWIP_SOCKETS_H
+#define LWIP_SOCKETS_H
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#endif  // LWIP_SOCKETS_H
@@ -0,0 +1,10 @@
+// Host build: the Synth menu's settings, at their Kconfig defaults
+// (CONFIG_DSP_ARENA_RENDER_GUARD comes from the Makefile)
+
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+#define CONFIG_DSP_ARENA_FAST_SIZE 96
+#define CONFIG_DSP_ARENA_BULK_SIZE 512
+
+#endif  // SDKCONFIG_H
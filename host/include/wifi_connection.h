@@ -0,0 +1,11 @@
+// Host build: Wi-Fi connection helpers, there is no radio
+
+#ifndef WIFI_CONNECTION_H
+#define WIFI_CONNECTION_H
+
+#include "esp_err.h"
+
+esp_err_t wifi_connection_init_stack(void);
+esp_err_t wifi_connect_try_all(void);
+
+#endif  // WIFI_CONNECTION_H
@@ -0,0 +1,10 @@
+// Host build: Wi-Fi radio coprocessor, there is none
+
+#ifndef WIFI_REMOTE_H
+#define WIFI_REMOTE_H
+
+#include "esp_err.h"
+
+esp_err_t wifi_remote_initialize(void);
+
+#endif  // WIFI_REMOTE_H
@@ -0,0 +1,271 @@
+// Host test: network MIDI packet parsing, sender clock mapping and jitter buffer
+//
+// net_midi.c is included as it is, with the host's own sockets behind
+// lwip/sockets.h, and synth_schedule_note() records what would be played.
+// Hand-made packets check the parser, the sequence and clock bookkeeping and
+// the playout times exactly, with made-up arrival times. On request
+// net_midi_send.py also sends a pattern with network jitter over the loopback
+// interface, and every event has to be scheduled in time, at the spacing it
+// was sent with; that part runs on the PC's clock and scheduler, so it is
+// left out of 'make test' ('make loopback' runs it).
+//
+//   net_midi_test [seconds of loopback]   (none or 0 skips the loopback part)
+
+#include "net_midi.c"
+#include <stdio.h>
+#include <sys/wait.h>
+
+#define MAX_RECORDED 8192
+
+typedef struct {
+    int     note_index;
+    bool    on;
+    int64_t time_us;
+} recorded_event_t;
+
+static recorded_event_t recorded[MAX_RECORDED];
+static int              recorded_count = 0;
+static int              failures       = 0;
+
+bool synth_schedule_note(int note_index, bool on, int64_t time_us) {
+    if (recorded_count == MAX_RECORDED) return false;
+    recorded[recorded_count++] = (recorded_event_t){.note_index = note_index, .on = on, .time_us = time_us};
+    return true;
+}
+
+// Helper function: Report a failed check
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// Helper function: Write a little-endian integer of 'bytes' bytes
+static void write_le(uint8_t* data, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) data[i] = (uint8_t)(value >> (8 * i));
+}
+
+// Helper function: Build a packet with 'count' note events, event i at 'sender' + i ms; returns its length
+static int build_packet(uint8_t* packet, uint16_t sequence, uint32_t sender, int count, uint8_t status, int note) {
+    memcpy(packet, "NMID", 4);
+    write_le(packet + 4, sequence, 2);
+    packet[6] = (uint8_t)count;
+    packet[7] = 0;
+    write_le(packet + 8, sender, 4);
+    for (int i = 0; i < count; i++) {
+        uint8_t* event = packet + HEADER_BYTES + i * EVENT_BYTES;
+        write_le(event, sender + i * 1000, 4);
+        event[4] = status;
+        event[5] = (uint8_t)(note + i);
+        event[6] = 100;
+        event[7] = 0;
+    }
+    return HEADER_BYTES + count * EVENT_BYTES;
+}
+
+// Helper function: Start over as after 'netmidi reset'
+static void reset(void) {
+    memset(&stats, 0, sizeof(stats));
+    sender_clock.synced = false;
+    recorded_count      = 0;
+}
+
+// Helper function: Datagrams that are not network MIDI packets are counted and ignored
+static void test_invalid(void) {
+    uint8_t packet[HEADER_BYTES + (NET_MIDI_MAX_EVENTS + 1) * EVENT_BYTES];
+    reset();
+    int length = build_packet(packet, 0, 0, 2, 0x90, 60);
+    handle_packet(packet, HEADER_BYTES - 1, 0);  // Too short
+    handle_packet(packet, length - 1, 0);        // Length does not match the count
+    handle_packet(packet, length + 1, 0);
+    packet[0] = 'X';  // Wrong magic
+    handle_packet(packet, length, 0);
+    length = build_packet(packet, 0, 0, NET_MIDI_MAX_EVENTS + 1, 0x90, 60);
+    handle_packet(packet, length, 0);  // Too many events
+    check(stats.invalid == 5 && stats.packets == 0 && recorded_count == 0, "invalid datagrams ignored");
+}
+
+// Helper function: MIDI messages map onto the keys, other octaves fold in, velocity 0 releases
+static void test_messages(void) {
+    uint8_t packet[HEADER_BYTES + NET_MIDI_MAX_EVENTS * EVENT_BYTES];
+    reset();
+    handle_packet(packet, build_packet(packet, 0, 0, 13, 0x90, 60), 0);  // C to C one octave up, on
+    check(recorded_count == 13, "every key of the octave played");
+    for (int i = 0; i < recorded_count && i < 13; i++) {
+        check(recorded[i].on && note_defs[recorded[i].note_index].semitone == i, "MIDI note maps onto its key");
+    }
+
+    recorded_count = 0;
+    handle_packet(packet, build_packet(packet, 1, 0, 1, 0x93, 48), 0);  // Octave below, channel 4
+    handle_packet(packet, build_packet(packet, 2, 0, 1, 0x80, 62), 0);  // Note off
+    int length = build_packet(packet, 3, 0, 2, 0x90, 64);
+    packet[HEADER_BYTES + 6]  = 0;     // Note on with velocity 0
+    packet[HEADER_BYTES + 12] = 0xB0;  // Control change, ignored
+    handle_packet(packet, length, 0);
+    check(recorded_count == 3, "control change ignored");
+    check(recorded[0].on && note_defs[recorded[0].note_index].semitone == 0, "other octaves fold onto the keys");
+    check(!recorded[1].on && note_defs[recorded[1].note_index].semitone == 2, "note off releases");
+    check(!recorded[2].on && note_defs[recorded[2].note_index].semitone == 4, "velocity 0 releases");
+    check(stats.events == 3 + 13 && stats.packets == 4, "events and packets counted");
+}
+
+// Helper function: An event up to NET_MIDI_MAX_AHEAD ahead of its packet is scheduled, one further ahead dropped
+static void test_ahead(void) {
+    uint8_t packet[HEADER_BYTES + 2 * EVENT_BYTES];
+    reset();
+    int length = build_packet(packet, 0, 1000, 2, 0x90, 60);
+    write_le(packet + HEADER_BYTES, 1000 + NET_MIDI_MAX_AHEAD, 4);
+    write_le(packet + HEADER_BYTES + EVENT_BYTES, 1000 + NET_MIDI_MAX_AHEAD + 1, 4);
+    handle_packet(packet, length, 0);
+    check(recorded_count == 1 && recorded[0].time_us == NET_MIDI_MAX_AHEAD + playout_delay,
+          "event at the limit scheduled");
+    check(stats.too_far_ahead == 1 && stats.events == 1, "event beyond the limit dropped and counted");
+}
+
+// Helper function: Sequence gaps count as lost until the packet turns up late
+static void test_sequence(void) {
+    static const uint16_t order[] = {65534, 65535, 1, 0, 2, 5, 6};  // Wraps, 0 late, 3 and 4 lost
+    uint8_t               packet[HEADER_BYTES];
+    reset();
+    for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        handle_packet(packet, build_packet(packet, order[i], i * 1000, 0, 0, 0), i * 1000);
+    }
+    check(stats.packets == 7 && stats.lost == 2 && stats.reordered == 1, "lost and reordered packets");
+}
+
+// Helper function: Events keep the sender's spacing whatever the network adds, across a clock wrap
+static void test_jitter(void) {
+    const uint32_t delay  = 10000;
+    const int64_t  origin = 5000000;     // esp_timer time of the first packet
+    const uint32_t start  = 0xFFF00000;  // Sender clock, wraps after about a second
+    uint8_t        packet[HEADER_BYTES + 2 * EVENT_BYTES];
+    reset();
+    playout_delay = delay;
+
+    // A packet every 10 ms for 1.5 s (within the window), the first one the fastest: 300 us, the others
+    // up to 8 ms more
+    bool late = false, spaced = true;
+    for (int i = 0; i < 150; i++) {
+        uint32_t sender  = start + i * 10000;
+        int64_t  arrival = origin + (int64_t)i * 10000 + 300 + (i == 0 ? 0 : (i * 2654435761u >> 16) % 8000);
+        handle_packet(packet, build_packet(packet, (uint16_t)i, sender, 2, 0x90, 60), arrival);
+        for (int e = recorded_count - 2; e < recorded_count; e++) {
+            int64_t expected = origin + (int64_t)i * 10000 + (e - recorded_count + 2) * 1000 + 300 + delay;
+            if (recorded[e].time_us != expected) spaced = false;
+            if (recorded[e].time_us < arrival) late = true;
+        }
+    }
+    check(recorded_count == 300 && spaced, "events scheduled at the sender's spacing, across the clock wrap");
+    check(!late, "no event later than its packet with the jitter below the playout delay");
+    check(stats.transit_us_max >= 7000 && stats.transit_us_max < 8000, "transit above the fastest packet");
+    check(stats.jitter_us > 1000, "jitter estimated");
+
+    // A sender that restarts with a new clock is followed at once
+    int before = recorded_count;
+    handle_packet(packet, build_packet(packet, 9, 0x40000000, 1, 0x90, 60), origin + 3000000);
+    check(recorded_count == before + 1 && recorded[before].time_us == origin + 3000000 + delay,
+          "restarted sender resynchronised");
+}
+
+// Helper function: Play a pattern from net_midi_send.py over the loopback interface
+static void test_loopback(int seconds) {
+    const uint32_t delay  = 30000;  // Room for the PC's own scheduling hiccups on top of the jitter
+    const int      jitter = 5;      // ms
+    reset();
+    playout_delay = delay;
+
+    int                sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct sockaddr_in addr = {.sin_family = AF_INET, .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+    socklen_t          addr_length = sizeof(addr);
+    struct timeval     timeout     = {.tv_usec = 100000};
+    if (sock < 0 || bind(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0 ||
+        getsockname(sock, (struct sockaddr*)&addr, &addr_length) != 0) {
+        check(false, "bind a loopback socket");
+        return;
+    }
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    // The sender's report goes through a pipe, read once it is done
+    char port[12], duration[12], jitter_ms[12];
+    snprintf(port, sizeof(port), "%d", ntohs(addr.sin_port));
+    snprintf(duration, sizeof(duration), "%d", seconds);
+    snprintf(jitter_ms, sizeof(jitter_ms), "%d", jitter);
+    int report[2];
+    if (pipe(report) != 0) return;
+    pid_t sender = fork();
+    if (sender == 0) {
+        dup2(report[1], STDOUT_FILENO);
+        execlp("python3", "python3", NET_MIDI_SEND, "send", "127.0.0.1", "--port", port, "--pattern", "random",
+               "--tempo", "240", "--seconds", duration, "--jitter", jitter_ms, "--seed", "7", (char*)NULL);
+        _exit(127);
+    }
+    close(report[1]);
+
+    static uint8_t packet[HEADER_BYTES + NET_MIDI_MAX_EVENTS * EVENT_BYTES + 1];
+    int            status = 0;
+    bool           late = false, done = false;
+    int32_t        base_min = INT32_MAX, base_max = INT32_MIN;
+    while (!done) {
+        int     length  = recv(sock, packet, sizeof(packet), 0);
+        int64_t arrival = esp_timer_get_time();
+        if (length < 0) {
+            done = waitpid(sender, &status, WNOHANG) == sender;
+            continue;
+        }
+        int before = recorded_count;
+        handle_packet(packet, length, arrival);
+        for (int e = before; e < recorded_count; e++) {
+            if (recorded[e].time_us < arrival) late = true;
+
+            // Both sides run on the same monotonic clock, so the buffer's idea of the fastest
+            // transit can be compared with the real one, which the loopback keeps near zero
+            uint32_t sent = read_le(packet + HEADER_BYTES + (e - before) * EVENT_BYTES, 4);
+            int32_t  base = (int32_t)((uint32_t)recorded[e].time_us - sent) - (int32_t)delay;
+            if (base < base_min) base_min = base;
+            if (base > base_max) base_max = base;
+        }
+    }
+    close(sock);
+
+    char  line[128]    = "";
+    int   sent_packets = -1, sent_events = -1;
+    FILE* output       = fdopen(report[0], "r");
+    while (output != NULL && fgets(line, sizeof(line), output) != NULL) {
+        if (sscanf(line, "Sending %d packets (%d events)", &sent_packets, &sent_events) == 2) break;
+    }
+    if (output != NULL) fclose(output);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || sent_packets < 0) {
+        check(false, "run net_midi_send.py (needs python3)");
+        return;
+    }
+
+    net_midi_stats_t received;
+    net_midi_get_stats(&received);
+    const int events = recorded_count;
+    printf("loopback: %lu of %d packets, %d of %d events, %lu reordered, transit max %lu us, jitter %lu us, "
+           "base transit %ld .. %ld us\n",
+           (unsigned long)received.packets, sent_packets, events, sent_events, (unsigned long)received.reordered,
+           (unsigned long)received.transit_us_max, (unsigned long)received.jitter_us, (long)base_min,
+           (long)base_max);
+    check(received.packets == (uint32_t)sent_packets && received.lost == 0 && received.invalid == 0,
+          "every loopback packet received");
+    check(events == sent_events, "every loopback event scheduled");
+    check(!late, "no loopback event later than its packet");
+    check(base_min >= 0 && base_max < (int32_t)delay, "playout anchored on the fastest packets");
+}
+
+int main(int argc, char** argv) {
+    const int seconds = argc > 1 ? atoi(argv[1]) : 0;
+    build_note_map();
+
+    test_invalid();
+    test_messages();
+    test_ahead();
+    test_sequence();
+    test_jitter();
+    if (seconds > 0) test_loopback(seconds);
+
+    printf("%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,171 @@
+// Host port of the ESP-IDF and FreeRTOS functions the DSP code calls
+//
+// The host programs are single threaded: xTaskCreatePinnedToCore() does not
+// start the task, queues stay empty and a mutex is always free. A program
+// calls the work of a task itself, the audio task's block for example.
+
+#include <stdlib.h>
+#include <time.h>
+#include "driver/i2s_std.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_netif.h"
+#include "esp_timer.h"
+#include "esp_vfs_fat.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "wifi_connection.h"
+#include "wifi_remote.h"
+
+static char main_task;  // Handle of the one task there is
+static char mutex;      // Handle of every mutex
+
+const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        default: return "ERROR";
+    }
+}
+
+int64_t esp_timer_get_time(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return malloc(size);
+}
+
+void* heap_caps_calloc(size_t count, size_t size, uint32_t caps) {
+    return calloc(count, size);
+}
+
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    return realloc(ptr, size);
+}
+
+void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    void* ptr = NULL;
+    return posix_memalign(&ptr, alignment, size) == 0 ? ptr : NULL;
+}
+
+void heap_caps_free(void* ptr) {
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return 0;
+}
+
+BaseType_t xPortGetCoreID(void) {
+    return 0;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stack_depth, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    if (handle != NULL) *handle = NULL;
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {}
+
+void vTaskDelay(TickType_t ticks) {}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(esp_timer_get_time() / 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return (TaskHandle_t)&main_task;
+}
+
+char* pcTaskGetName(TaskHandle_t task) {
+    return "main";
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    return NULL;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    return pdFALSE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    return pdFALSE;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    return (SemaphoreHandle_t)&mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return pdTRUE;
+}
+
+esp_err_t i2s_channel_write(i2s_chan_handle_t handle, const void* src, size_t size, size_t* bytes_written,
+                            uint32_t timeout_ms) {
+    if (bytes_written != NULL) *bytes_written = size;
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle) {
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle) {
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_reconfig_std_slot(i2s_chan_handle_t handle, const i2s_std_slot_config_t* slot_cfg) {
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_reconfig_std_clock(i2s_chan_handle_t handle, const i2s_std_clk_config_t* clk_cfg) {
+    return ESP_OK;
+}
+
+esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle, const i2s_event_callbacks_t* callbacks,
+                                              void* user_data) {
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_fat_sdmmc_mount(const char* base_path, const sdmmc_host_t* host, const void* slot_config,
+                                  const esp_vfs_fat_sdmmc_mount_config_t* mount_config, sdmmc_card_t** card) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_netif_t* esp_netif_get_handle_from_ifkey(const char* if_key) {
+    return NULL;
+}
+
+esp_err_t esp_netif_get_ip_info(esp_netif_t* netif, esp_netif_ip_info_t* ip_info) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t wifi_remote_initialize(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t wifi_connection_init_stack(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t wifi_connect_try_all(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
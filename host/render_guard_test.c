@@ -0,0 +1,150 @@
+// Host test: the audio path allocates nothing while it renders
+//
+// Links the heap functions wrapped as in a CONFIG_DSP_ARENA_RENDER_GUARD
+// firmware build (see Makefile) and runs the audio task's real block,
+// synth.c is included to reach it, through every engine, wavetable mode,
+// output rate and format and block size, with every effect in every chain
+// and the PCM capture on. Any allocation from the render path is refused and
+// counted, and fails the test.
+
+#include "synth.c"
+#include "esp_heap_caps.h"
+
+static int failures = 0;
+
+// Helper function: Report a failed check
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// Helper function: A table with the same cycle at every mip level
+static void fill_table(wavetable_t* table, int harmonic) {
+    for (int level = 0; level < WAVETABLE_MIPS; level++) {
+        for (int i = 0; i < WAVETABLE_LENGTH; i++) {
+            table->mips[level][i] = (int16_t)(16000.0f * sinf(2.0f * (float)M_PI * harmonic * i / WAVETABLE_LENGTH));
+        }
+    }
+}
+
+// Helper function: Render blocks with a chord held, then released, and a morph sweep on the way
+static void play(int blocks) {
+    static const int chord[] = {0, 4, 7, 12, 16, 19, 24, 28};
+    for (size_t i = 0; i < sizeof(chord) / sizeof(chord[0]); i++) start_note(chord[i]);
+    synth_set_morph(1.0f, 5.0f, 0.5f);
+    for (int block = 0; block < blocks; block++) audio_block();
+    for (size_t i = 0; i < sizeof(chord) / sizeof(chord[0]); i++) stop_note(chord[i]);
+    synth_set_morph(0.0f, 0.0f, 0.0f);
+    for (int block = 0; block < blocks; block++) audio_block();
+}
+
+int main(void) {
+    check(dsp_arena_init() == ESP_OK, "dsp_arena_init");
+    synth_init(NULL);
+    check(mix_buffer != NULL, "synth_init carved its buffers");
+
+    // The guard itself: every wrapped function fails inside a block and works outside
+    dsp_arena_render_begin();
+    void* refused[] = {
+        malloc(16),
+        calloc(4, 4),
+        realloc(NULL, 16),
+        heap_caps_malloc(16, MALLOC_CAP_INTERNAL),
+        heap_caps_calloc(4, 4, MALLOC_CAP_INTERNAL),
+        heap_caps_realloc(NULL, 16, MALLOC_CAP_INTERNAL),
+        heap_caps_aligned_alloc(16, 16, MALLOC_CAP_INTERNAL),
+        dsp_arena_alloc(DSP_ARENA_FAST, 16, "test"),
+    };
+    dsp_arena_render_end();
+    const uint32_t guard_checks = sizeof(refused) / sizeof(refused[0]);
+    for (uint32_t i = 0; i < guard_checks; i++) check(refused[i] == NULL, "allocation refused while rendering");
+    check(dsp_arena_refused() == guard_checks, "every refusal counted");
+    void* allowed = malloc(16);
+    check(allowed != NULL, "allocation allowed outside a block");
+    free(allowed);
+
+    // The morph moves once per block: a jump across a 64-frame bank slews MORPH_MAX_SLEW frames, and the
+    // segments a block is split into take consecutive parts of its spans
+    synth_set_morph(1.0f, 0.0f, 0.0f);
+    morph_block_t morph = {.count = 0};
+    morph.count         = update_morph(64, 256, morph.spans, &morph.weight_step);
+    check(morph_frame == MORPH_MAX_SLEW, "the morph slews once per block");
+    bool         sliced = true;
+    const int    cuts[] = {0, 1, 31, 32, 100, 101, 256};
+    morph_span_t spans[MORPH_MAX_SPANS];
+    for (size_t cut = 0; cut + 1 < sizeof(cuts) / sizeof(cuts[0]); cut++) {
+        int count = morph_segment(&morph, cuts[cut], cuts[cut + 1] - cuts[cut], spans);
+        for (int span = 0, frame = cuts[cut]; span < count; frame += spans[span].frames, span++) {
+            float position = morph.weight_step * frame;
+            if (spans[span].pair != (int)position) sliced = false;
+            if (fabsf(spans[span].pair + spans[span].weight - position) > 1e-4f) sliced = false;
+        }
+    }
+    check(sliced, "segments take their part of the block's morph spans");
+    morph_frame = 0.0f;
+    synth_set_morph(0.0f, 0.0f, 0.0f);
+
+    // Console-side settings: everything on, both buses and the master chain in use
+    wavetable_t*      table = heap_caps_malloc(sizeof(wavetable_t), MALLOC_CAP_SPIRAM);
+    wavetable_bank_t* bank  = heap_caps_malloc(sizeof(wavetable_bank_t) + 2 * sizeof(wavetable_t), MALLOC_CAP_SPIRAM);
+    check(pcm_capture_enable(true) == ESP_OK, "pcm_capture_enable");
+    check(dsp_arena_alloc(DSP_ARENA_BULK, DSP_ARENA_BULK_SIZE, "test") == NULL, "the arenas do not grow");
+    fill_table(table, 3);
+    bank->frames = 2;
+    fill_table(&bank->tables[0], 1);
+    fill_table(&bank->tables[1], 5);
+
+    chorus_params_t chorus;
+    chorus_preset(CHORUS_FLANGER, &chorus);
+    check(synth_set_chorus(&chorus), "synth_set_chorus");
+    const waveshaper_params_t drive = {.curve = WAVESHAPER_TANH, .drive = 4.0f, .level = 0.5f};
+    check(synth_set_waveshaper(&drive), "synth_set_waveshaper");
+    const speaker_eq_params_t speaker = {.eq = true, .bass = 0.5f};
+    check(synth_set_speaker_eq(&speaker), "synth_set_speaker_eq");
+    granular_capture_start();
+
+    fx_patch_t patches[2];
+    fx_patch_default(&patches[0]);
+    memset(&patches[1], 0, sizeof(patches[1]));
+    patches[1].chain[FX_CHAIN_VOICE][0]  = FX_DRIVE;
+    patches[1].chain[FX_CHAIN_BUS_A][0]  = FX_CHORUS;
+    patches[1].chain[FX_CHAIN_MASTER][0] = FX_DRIVE;
+    patches[1].send[0]                   = 0.5f;
+    patches[1].send[1]                   = 0.5f;
+    patches[1].ret[0]                    = 1.0f;
+    patches[1].ret[1]                    = 1.0f;
+
+    static const int      block_sizes[] = {MIN_FRAMES_PER_WRITE, FRAMES_PER_WRITE, MAX_FRAMES_PER_WRITE};
+    static const uint32_t rates[]       = {SAMPLE_RATE, RESAMPLER_OUTPUT_RATE};
+    int                   runs          = 0;
+    for (int patch = 0; patch < 2; patch++) {
+        check(synth_set_fx_patch(&patches[patch]), "synth_set_fx_patch");
+        for (synth_engine_t voice_engine = 0; voice_engine < SYNTH_ENGINE_COUNT; voice_engine++) {
+            synth_set_engine(voice_engine);
+            for (int wave = 0; wave < 3; wave++) {
+                synth_set_wavetable(wave == 1 ? table : NULL);
+                synth_set_wavetable_bank(wave == 2 ? bank : NULL);
+                for (size_t rate = 0; rate < sizeof(rates) / sizeof(rates[0]); rate++) {
+                    synth_set_output_rate(rates[rate]);
+                    synth_set_output_format((output_format_t)(runs % OUTPUT_FORMAT_COUNT));
+                    for (size_t size = 0; size < sizeof(block_sizes) / sizeof(block_sizes[0]); size++) {
+                        synth_set_block_frames(block_sizes[size]);
+                        play(40);
+                        runs++;
+                    }
+                }
+            }
+        }
+    }
+
+    uint32_t in_render = dsp_arena_refused() - guard_checks;
+    if (in_render > 0) {
+        printf("FAIL: %lu allocations from the render path\n", (unsigned long)in_render);
+        dsp_arena_report();
+        failures++;
+    }
+    printf("%d configurations, %lu blocks rendered, %d failures\n", runs, (unsigned long)block_count, failures);
+    return failures == 0 ? 0 : 1;
+}
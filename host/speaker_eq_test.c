@@ -0,0 +1,89 @@
+// Host test: the bass enhancer's harmonic generator
+//
+// speaker_eq.c is included to reach bass_harmonics(), with every filter of
+// the bass path replaced by a unity biquad, so the chunk comes out as the
+// generator made it. Every sample has to match e * (T2(u) + T3(u)) / 2 with
+// u = x / E worked out in double precision, E the envelope at the chunk's end
+// and e following its ramp over the chunk: steady cosines at levels from the
+// envelope floor to full scale, onsets out of silence and decays.
+
+#include "speaker_eq.c"
+#include <stdio.h>
+
+static int failures = 0;
+
+// Helper function: Report a failed check
+static void check(bool ok, const char* what) {
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// Helper function: Run the generator over one chunk of the mono signal 'x', compare with the reference
+static void generate(speaker_eq_t* eq, const int32_t* x, int count, const char* what) {
+    for (int i = 0; i < count; i++) {
+        eq->work[i * 2]     = x[i];
+        eq->work[i * 2 + 1] = x[i];
+    }
+    const int32_t start = eq->envelope;
+    bass_harmonics(eq, count);
+    const int32_t end  = eq->envelope;
+    const int32_t step = (end - start) / count;
+
+    // Within rounding: 2 LSB of the Q27 output, or 1e-7 of the envelope at higher levels
+    double worst = 0.0;
+    for (int i = 0; i < count; i++) {
+        const double e = start + (double)step * i;
+        const double u = (double)x[i] / end;
+        check(u >= -1.0 && u <= 1.0, "peak within the envelope");
+        const double h     = e * (2.0 * u * u - 1.0 + 4.0 * u * u * u - 3.0 * u) / 2.0;
+        const double error = fabs(eq->low[i] - h) / (2.0 + 1e-7 * e);
+        if (error > worst) worst = error;
+    }
+    if (worst > 1.0) printf("%s: error %.3g of the tolerance\n", what, worst);
+    check(worst <= 1.0, what);
+}
+
+int main(void) {
+    // Unity biquads in place of the split, harmonics high-pass and low-pass
+    static int32_t unity[SPEAKER_EQ_FILTERS][5];
+    for (int filter = 0; filter < SPEAKER_EQ_FILTERS; filter++) unity[filter][0] = 1 << SPEAKER_EQ_COEFF_SHIFT;
+
+    speaker_eq_t eq;
+    int32_t      x[SPEAKER_EQ_CHUNK];
+    const int    levels[] = {ENVELOPE_FLOOR, 1 << 20, 1 << 24, Q27_ONE, 1 << 30, (int32_t)(SAMPLE_LIMIT * Q27_ONE)};
+    for (size_t level = 0; level < sizeof(levels) / sizeof(levels[0]); level++) {
+        const int32_t amplitude = levels[level];
+
+        // A cosine whose peak is the envelope: the harmonics at the same level
+        speaker_eq_reset(&eq);
+        eq.coeffs   = unity;
+        eq.rate     = SAMPLE_RATE;
+        eq.envelope = amplitude;
+        for (int chunk = 0; chunk < 4; chunk++) {
+            for (int i = 0; i < SPEAKER_EQ_CHUNK; i++) {
+                x[i] = (int32_t)(amplitude * cos(2.0 * M_PI * (chunk * SPEAKER_EQ_CHUNK + i) / 32.0));
+            }
+            generate(&eq, x, SPEAKER_EQ_CHUNK, "steady cosine");
+        }
+
+        // Out of silence, the low band far ahead of the envelope ramp
+        speaker_eq_reset(&eq);
+        eq.coeffs = unity;
+        eq.rate   = SAMPLE_RATE;
+        for (int i = 0; i < SPEAKER_EQ_CHUNK; i++) x[i] = 0;
+        generate(&eq, x, SPEAKER_EQ_CHUNK, "silence");
+        for (int i = 0; i < SPEAKER_EQ_CHUNK; i++) x[i] = (int32_t)(amplitude * sin(2.0 * M_PI * i / 20.0));
+        generate(&eq, x, SPEAKER_EQ_CHUNK, "onset");
+
+        // And back to silence, the envelope decaying over a short chunk
+        for (int chunk = 0; chunk < 8; chunk++) {
+            for (int i = 0; i < 17; i++) x[i] = (int32_t)(amplitude / 64 * sin(2.0 * M_PI * i / 17.0));
+            generate(&eq, x, 17, "decay");
+        }
+    }
+
+    printf("%d failures\n", failures);
+    return failures == 0 ? 0 : 1;
+}
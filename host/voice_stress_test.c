@@ -0,0 +1,248 @@
+// Host test: seeded random stress test of voice allocation
+//
+// Drives start_note()/stop_note() with random sequences of key storms,
+// auto-repeat and overlapping releases, renders every block with the real
+// render_block() (synth.c is included to reach it) and checks after every
+// block that no voice leaks or gets stuck and the output stays finite and
+// bounded. A sequence (polyphony, interpolation, block sizes, events)
+// depends on its seed only, so a failure replays exactly from its seed:
+//
+//   voice_stress_test [sequences] [first seed] [blocks]
+//
+// The defaults check one million blocks; a single sequence prints every event.
+
+#include "synth.c"
+
+// Longest a released voice may keep sounding: the rest of the attack, the decay, the release,
+// and a steal fade if load shedding picks it just before the release ends
+#define STRESS_RELEASE_LIMIT (ADSR_ATTACK_SAMPLES + ADSR_DECAY_SAMPLES + ADSR_RELEASE_SAMPLES + STEAL_FADE_SAMPLES)
+
+// Sequence patterns, switched at random every few blocks
+typedef enum {
+    STRESS_STORM = 0,  // Many random presses and releases per block
+    STRESS_REPEAT,     // One key held down with auto-repeat, as the keyboard sends it
+    STRESS_OVERLAP,    // Chords pressed together, released one key at a time
+    STRESS_PATTERNS
+} stress_pattern_t;
+
+// Result of one sequence
+typedef struct {
+    uint32_t    seed;
+    uint32_t    events;            // Key events sent
+    uint32_t    blocks;            // Blocks rendered and checked
+    uint32_t    block_us_max;      // Slowest block
+    int         block_frames_max;  // Size of the slowest block
+    int         failed_block;      // Block that broke an invariant, -1 if none
+    const char* failure;           // Invariant that broke, NULL if none
+} stress_result_t;
+
+typedef struct {
+    uint32_t         rng;                             // xorshift32 state, derived from the seed only
+    bool             pressed[NUM_NOTES];              // Mirror of the UI's note_keys_pressed
+    uint32_t         released_for[MAX_ACTIVE_NOTES];  // Samples since a voice's key went up
+    int64_t          block_time;                      // Render clock of the next block
+    bool             verbose;                         // Print every event, for replaying a failure
+    stress_result_t* result;
+} stress_state_t;
+
+// Helper function: Next pseudo random number of a stress sequence
+static uint32_t stress_random(stress_state_t* state, uint32_t range) {
+    uint32_t x = state->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    state->rng = x;
+    return x % range;
+}
+
+// Helper function: Send one key event the way the UI loop does
+static void stress_key(stress_state_t* state, int note, bool press) {
+    if (press) {
+        start_note(note);
+        for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+            if (active_notes[i].note_index == note) state->released_for[i] = 0;  // (Re)started from the attack
+        }
+    } else {
+        stop_note(note);
+    }
+    state->pressed[note] = press;
+    state->result->events++;
+    if (state->verbose) printf("  %s %d\n", press ? "press" : "release", note);
+}
+
+// Helper function: Generate the events of one block
+static void stress_events(stress_state_t* state, stress_pattern_t pattern, int* repeat_note) {
+    switch (pattern) {
+        case STRESS_STORM: {
+            int count = stress_random(state, 9);
+            for (int i = 0; i < count; i++) {
+                stress_key(state, stress_random(state, NUM_NOTES), stress_random(state, 2) == 0);
+            }
+            break;
+        }
+        case STRESS_REPEAT:
+            stress_key(state, *repeat_note, true);
+            if (stress_random(state, 8) == 0) {
+                stress_key(state, *repeat_note, false);
+                *repeat_note = stress_random(state, NUM_NOTES);
+            }
+            break;
+        case STRESS_OVERLAP:
+        default:
+            if (stress_random(state, 4) == 0) {
+                int count = 2 + stress_random(state, 3);
+                for (int i = 0; i < count; i++) stress_key(state, stress_random(state, NUM_NOTES), true);
+            }
+            for (int note = 0; note < NUM_NOTES; note++) {
+                if (state->pressed[note] && stress_random(state, 6) == 0) stress_key(state, note, false);
+            }
+            break;
+    }
+
+    // Now and then load shedding steals a voice or the console changes the polyphony
+    if (stress_random(state, 50) == 0) {
+        steal_quietest_voice();
+        if (state->verbose) printf("  steal\n");
+    }
+    if (stress_random(state, 100) == 0) {
+        polyphony = 1 + stress_random(state, MAX_ACTIVE_NOTES);
+        if (state->verbose) printf("  polyphony %d\n", polyphony);
+    }
+}
+
+// Helper function: Check every invariant after a block, returns a description of the first one broken
+static const char* stress_check(stress_state_t* state, const float* out, int frames, int voices) {
+    bool seen[NUM_NOTES] = {false};
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        const active_note_t* note = &active_notes[i];
+        if ((note->adsr_state == ADSR_IDLE) != (note->note_index == -1)) return "leaked voice (state and note disagree)";
+        if (note->adsr_state == ADSR_IDLE) {
+            state->released_for[i] = 0;
+            continue;
+        }
+        if (note->note_index < 0 || note->note_index >= NUM_NOTES) return "voice plays an invalid note";
+        if (seen[note->note_index]) return "two voices play the same note";
+        seen[note->note_index] = true;
+        if (note->key_held != state->pressed[note->note_index]) return "voice key state differs from the key";
+        if (!(note->adsr_level >= 0.0f && note->adsr_level <= 1.0f)) return "envelope level out of range";
+        if (!(note->playback_position >= 0.0f && note->playback_position < WAVEFORM_CYCLE_LENGTH)) {
+            return "playback position out of range";
+        }
+
+        state->released_for[i] = note->key_held ? 0 : state->released_for[i] + frames;
+        if (state->released_for[i] > (uint32_t)(STRESS_RELEASE_LIMIT + frames)) return "stuck note (released but still sounding)";
+    }
+
+    // Every voice adds at most its waveform peak (50%, a little more with cubic overshoot)
+    const float limit = voices * 0.5f * 1.25f + 1e-6f;
+    for (int i = 0; i < frames * 2; i++) {
+        if (!isfinite(out[i])) return "NaN or infinity in the output";
+        if (fabsf(out[i]) > limit) return "output exceeds the voice count bound";
+    }
+    return NULL;
+}
+
+// Helper function: Render one test block and check it, returns false on a broken invariant
+static bool stress_block(stress_state_t* state, float* out, int frames, synth_interp_t interp) {
+    int64_t  start  = esp_timer_get_time();
+    int      voices = render_block(out, frames, state->block_time, SYNTH_ENGINE_WAVE, interp, NULL, NULL, NULL);
+    uint32_t block_us = (uint32_t)(esp_timer_get_time() - start);
+    state->block_time += (int64_t)frames * 1000000 / SAMPLE_RATE;
+
+    stress_result_t* result = state->result;
+    if (block_us > result->block_us_max) {
+        result->block_us_max     = block_us;
+        result->block_frames_max = frames;
+    }
+    const char* failure = stress_check(state, out, frames, voices);
+    if (failure != NULL) {
+        result->failure      = failure;
+        result->failed_block = result->blocks;
+    }
+    result->blocks++;
+    return failure == NULL;
+}
+
+// Helper function: Run one sequence from silence, returns false on failure
+static bool stress_test(uint32_t seed, int blocks, bool verbose, stress_result_t* result) {
+    static const int frame_choices[] = {16, 32, 64, 128, 256, 512};
+    static float     out[MAX_FRAMES_PER_WRITE * 2];
+
+    memset(result, 0, sizeof(*result));
+    result->seed         = seed;
+    result->failed_block = -1;
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        memset(&active_notes[i], 0, sizeof(active_notes[i]));
+        active_notes[i].note_index = -1;
+    }
+    current_normalization = 1.0f;
+
+    // Everything below depends on the seed only
+    stress_state_t state = {.rng = (seed ^ 0x9E3779B9u) != 0 ? (seed ^ 0x9E3779B9u) : 1, .result = result,
+                            .verbose = verbose};
+    polyphony                    = 1 + stress_random(&state, MAX_ACTIVE_NOTES);
+    const synth_interp_t interp  = stress_random(&state, SYNTH_INTERP_COUNT);
+    stress_pattern_t     pattern = stress_random(&state, STRESS_PATTERNS);
+    int                  repeat  = stress_random(&state, NUM_NOTES);
+    if (verbose) printf("seed %lu: polyphony %d, %s interpolation\n", (unsigned long)seed, polyphony,
+                        interp_names[interp]);
+
+    bool ok = true;
+    for (int block = 0; ok && block < blocks; block++) {
+        if (stress_random(&state, 16) == 0) pattern = stress_random(&state, STRESS_PATTERNS);
+        int frames = frame_choices[stress_random(&state, sizeof(frame_choices) / sizeof(frame_choices[0]))];
+        if (verbose) printf("block %d (%d frames, pattern %d)\n", block, frames, pattern);
+        stress_events(&state, pattern, &repeat);
+        ok = stress_block(&state, out, frames, interp);
+    }
+
+    // Let go of every key, all voices have to fall silent within the release limit
+    for (int note = 0; ok && note < NUM_NOTES; note++) {
+        if (state.pressed[note]) stress_key(&state, note, false);
+    }
+    for (int tail = 0; ok && tail < STRESS_RELEASE_LIMIT / MAX_FRAMES_PER_WRITE + 2; tail++) {
+        ok = stress_block(&state, out, MAX_FRAMES_PER_WRITE, interp);
+    }
+    for (int i = 0; ok && i < MAX_ACTIVE_NOTES; i++) {
+        if (active_notes[i].adsr_state != ADSR_IDLE) {
+            result->failure      = "stuck note (still sounding after all keys were released)";
+            result->failed_block = result->blocks - 1;
+            ok                   = false;
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const int      sequences = argc > 1 && atoi(argv[1]) > 0 ? atoi(argv[1]) : 1000;
+    const uint32_t first     = argc > 2 ? strtoul(argv[2], NULL, 10) : 1;
+    const int      blocks    = argc > 3 && atoi(argv[3]) > 0 ? atoi(argv[3]) : 1000;
+
+    dsp_arena_init();
+    synth_init(NULL);
+
+    uint64_t checked = 0;
+    uint32_t events = 0, worst_us = 0, worst_seed = first;
+    int      worst_frames = 0;
+    for (int i = 0; i < sequences; i++) {
+        stress_result_t result;
+        bool            ok = stress_test(first + i, blocks, sequences == 1, &result);
+        events += result.events;
+        checked += result.blocks;
+        if (result.block_us_max > worst_us) {
+            worst_us     = result.block_us_max;
+            worst_frames = result.block_frames_max;
+            worst_seed   = result.seed;
+        }
+        if (!ok) {
+            printf("FAIL seed %lu, block %d: %s\n", (unsigned long)result.seed, result.failed_block, result.failure);
+            printf("Replay with: %s 1 %lu %d\n", argv[0], (unsigned long)result.seed, blocks);
+            return 1;
+        }
+    }
+    printf("PASS %d sequences, %lu key events, %llu blocks checked\n", sequences, (unsigned long)events,
+           (unsigned long long)checked);
+    printf("Slowest block: %lu us for %d frames (seed %lu)\n", (unsigned long)worst_us, worst_frames,
+           (unsigned long)worst_seed);
+    return 0;
+}
@@ -0,0 +1,45 @@
+// Chord recognition
+
+#include "chord.h"
+#include <stdint.h>
+#include <stdio.h>
+#include "chord_table.h"
+#include "keyboard_notes.h"
+
+static const char* const pitch_class_names[12] = {"C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"};
+
+static uint8_t  held_count[12];           // Held keys per pitch class (C1 and C2 share one)
+static uint16_t held_mask  = 0;           // Bit set for every pitch class with a held key
+static uint8_t  held_chord = CHORD_NONE;  // chord_table entry for held_mask
+static char     held_name[CHORD_NAME_MAX] = "";
+
+bool chord_update(int note_index, bool pressed) {
+    if (note_index < 0 || note_index >= NUM_NOTES) return false;
+
+    int pitch_class = note_defs[note_index].semitone % 12;
+    if (pressed) {
+        held_count[pitch_class]++;
+    } else if (held_count[pitch_class] > 0) {
+        held_count[pitch_class]--;
+    }
+    if (held_count[pitch_class] > 0) {
+        held_mask |= 1 << pitch_class;
+    } else {
+        held_mask &= ~(1 << pitch_class);
+    }
+
+    uint8_t chord = chord_table[held_mask];
+    if (chord == held_chord) return false;
+
+    held_chord = chord;
+    if (chord == CHORD_NONE) {
+        held_name[0] = '\0';
+    } else {
+        snprintf(held_name, sizeof(held_name), "%s%s", pitch_class_names[chord >> 4], chord_quality_names[chord & 0x0F]);
+    }
+    return true;
+}
+
+const char* chord_name(void) {
+    return held_name;
+}
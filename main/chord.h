@@ -0,0 +1,22 @@
+// Chord recognition
+//
+// Keeps a 12-bit pitch class set of the held keys up to date one key event at
+// a time and names it with a single lookup in the generated chord_table.h
+// (see generate_chord_table.pl), so recognition is O(1) per input event.
+
+#ifndef CHORD_H
+#define CHORD_H
+
+#include <stdbool.h>
+
+// Longest possible name, e.g. "C#m7b5"
+#define CHORD_NAME_MAX 8
+
+// Update the held set for a key press (true) or release (false)
+// Returns true if the recognised chord name changed
+bool chord_update(int note_index, bool pressed);
+
+// Name of the chord currently held, or "" if the held keys do not form a known chord
+const char* chord_name(void);
+
+#endif  // CHORD_H
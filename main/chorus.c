@@ -0,0 +1,182 @@
+// Stereo chorus and flanger on the master bus
+//
+// Per channel and frame: read the line at 'delay' samples behind the write
+// position with linear interpolation, write the input plus feedback, and blend
+// dry and wet. The delay never drops below one sample, so the read only ever
+// touches samples written before, and the write slot is not read in the same
+// frame. With the LFO and smoothing out of the frame loop, the loop body is the
+// same arithmetic for every frame and both channels.
+
+#include "chorus.h"
+#include <math.h>
+#include <string.h>
+#include "dsp_math.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "synth.h"
+
+#define DELAY_MASK (CHORUS_DELAY_LENGTH - 1)
+
+// One-pole smoothing per control segment, about 16 ms to 63% at 32 frames per segment
+#define SMOOTHING 0.045f
+
+// Below this the faded out wet signal is inaudible and processing stops
+#define BYPASS_MIX 0.0005f
+
+_Static_assert((CHORUS_DELAY_LENGTH & DELAY_MASK) == 0, "The delay line length must be a power of two");
+_Static_assert(CHORUS_MAX_DELAY_MS * SAMPLE_RATE / 1000.0f < CHORUS_DELAY_LENGTH - 2, "Delay line too short");
+
+static const char* const mode_names[CHORUS_MODE_COUNT] = {
+    [CHORUS_OFF]     = "off",
+    [CHORUS_CHORUS]  = "chorus",
+    [CHORUS_FLANGER] = "flanger",
+};
+
+void chorus_preset(chorus_mode_t mode, chorus_params_t* params) {
+    switch (mode) {
+        case CHORUS_FLANGER:
+            *params = (chorus_params_t){.mode     = CHORUS_FLANGER,
+                                        .rate_hz  = 0.25f,
+                                        .delay_ms = 2.5f,
+                                        .depth_ms = 2.0f,
+                                        .feedback = 0.6f,
+                                        .mix      = 0.5f};
+            break;
+        case CHORUS_CHORUS:
+        default:
+            *params = (chorus_params_t){.mode     = mode,
+                                        .rate_hz  = 0.8f,
+                                        .delay_ms = 15.0f,
+                                        .depth_ms = 4.0f,
+                                        .feedback = 0.0f,
+                                        .mix      = 0.5f};
+            break;
+    }
+}
+
+bool chorus_params_valid(const chorus_params_t* params) {
+    if (params->mode < 0 || params->mode >= CHORUS_MODE_COUNT) return false;
+    if (!(params->rate_hz >= 0.01f && params->rate_hz <= 10.0f)) return false;
+    if (!(params->delay_ms > 0.0f && params->depth_ms >= 0.0f && params->depth_ms <= params->delay_ms)) return false;
+    if (!(params->delay_ms + params->depth_ms <= CHORUS_MAX_DELAY_MS)) return false;
+    if (!(params->feedback >= -0.95f && params->feedback <= 0.95f)) return false;
+    if (!(params->mix >= 0.0f && params->mix <= 1.0f)) return false;
+    return true;
+}
+
+const char* chorus_mode_name(chorus_mode_t mode) {
+    if (mode < 0 || mode >= CHORUS_MODE_COUNT) return "?";
+    return mode_names[mode];
+}
+
+void chorus_reset(chorus_t* chorus) {
+    memset(chorus, 0, sizeof(*chorus));
+}
+
+// Helper function: Delay of one channel at an LFO phase, kept where the read stays behind the write
+static inline float sweep_delay(const chorus_t* chorus, float phase) {
+    if (phase >= 1.0f) phase -= 1.0f;
+    float delay = chorus->centre + chorus->depth * lfo_sine(phase);
+    return fminf(fmaxf(delay, 1.0f), (float)(CHORUS_DELAY_LENGTH - 2));
+}
+
+void chorus_process(chorus_t* chorus, const chorus_params_t* params, float* buffer, int frames) {
+    const float ms          = SAMPLE_RATE / 1000.0f;
+    const float target_mix  = params->mode == CHORUS_OFF ? 0.0f : params->mix;
+    const float lfo_advance = params->rate_hz / SAMPLE_RATE;  // Turns per frame
+
+    if (!chorus->active) {
+        if (target_mix == 0.0f) return;
+
+        // Fade in from empty lines, already at the requested sweep
+        memset(chorus->line, 0, sizeof(chorus->line));
+        chorus->centre   = params->delay_ms * ms;
+        chorus->depth    = params->depth_ms * ms;
+        chorus->feedback = params->feedback;
+        chorus->mix      = 0.0f;
+        chorus->delay[0] = sweep_delay(chorus, chorus->lfo_phase);
+        chorus->delay[1] = sweep_delay(chorus, chorus->lfo_phase + 0.25f);
+        chorus->active   = true;
+    }
+
+    float (*line)[CHORUS_DELAY_LENGTH] = chorus->line;
+    int write                          = chorus->write;
+    for (int done = 0; done < frames; done += CHORUS_CONTROL_FRAMES) {
+        const int count = frames - done < CHORUS_CONTROL_FRAMES ? frames - done : CHORUS_CONTROL_FRAMES;
+
+        // Control rate: glide the settings, step the LFO and find the delays at the end of the segment
+        chorus->centre   += SMOOTHING * (params->delay_ms * ms - chorus->centre);
+        chorus->depth    += SMOOTHING * (params->depth_ms * ms - chorus->depth);
+        chorus->feedback += SMOOTHING * (params->feedback - chorus->feedback);
+        chorus->mix      += SMOOTHING * (target_mix - chorus->mix);
+        chorus->lfo_phase += lfo_advance * count;
+        if (chorus->lfo_phase >= 1.0f) chorus->lfo_phase -= 1.0f;
+        const float end_left  = sweep_delay(chorus, chorus->lfo_phase);
+        const float end_right = sweep_delay(chorus, chorus->lfo_phase + 0.25f);
+
+        // Audio rate: the delays ramp linearly to their new values over the segment
+        float       delay_left  = chorus->delay[0];
+        float       delay_right = chorus->delay[1];
+        const float step_left   = (end_left - delay_left) / count;
+        const float step_right  = (end_right - delay_right) / count;
+        const float feedback    = chorus->feedback;
+        const float mix         = chorus->mix;
+        float*      frame       = buffer + done * 2;
+        for (int i = 0; i < count; i++) {
+            // Read positions relative to the write slot, offset by a whole line so they stay positive
+            float read_left  = (float)(write + CHORUS_DELAY_LENGTH) - delay_left;
+            float read_right = (float)(write + CHORUS_DELAY_LENGTH) - delay_right;
+            int   index_left  = (int)read_left;
+            int   index_right = (int)read_right;
+            float frac_left   = read_left - index_left;
+            float frac_right  = read_right - index_right;
+
+            float a        = line[0][index_left & DELAY_MASK];
+            float b        = line[0][(index_left + 1) & DELAY_MASK];
+            float wet_left = a + (b - a) * frac_left;
+            a               = line[1][index_right & DELAY_MASK];
+            b               = line[1][(index_right + 1) & DELAY_MASK];
+            float wet_right = a + (b - a) * frac_right;
+
+            float in_left  = frame[i * 2];
+            float in_right = frame[i * 2 + 1];
+            line[0][write] = in_left + feedback * wet_left;
+            line[1][write] = in_right + feedback * wet_right;
+            frame[i * 2]     = in_left + mix * (wet_left - in_left);
+            frame[i * 2 + 1] = in_right + mix * (wet_right - in_right);
+
+            write        = (write + 1) & DELAY_MASK;
+            delay_left  += step_left;
+            delay_right += step_right;
+        }
+        chorus->delay[0] = end_left;
+        chorus->delay[1] = end_right;
+    }
+    chorus->write = write;
+
+    // Faded out after being switched off: stop until switched on again
+    if (target_mix == 0.0f && chorus->mix < BYPASS_MIX) chorus->active = false;
+}
+
+uint32_t chorus_bench(int blocks) {
+    static float    buffer[FRAMES_PER_WRITE * 2];
+    chorus_params_t params;
+    chorus_preset(CHORUS_FLANGER, &params);  // Feedback on, the most work per frame
+
+    // Internal RAM like the real state in the fast arena, freed again after the run
+    chorus_t* chorus = heap_caps_malloc(sizeof(chorus_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (chorus == NULL) return 0;
+    chorus_reset(chorus);
+    for (int i = 0; i < FRAMES_PER_WRITE; i++) {
+        buffer[i * 2]     = sinf(i * 0.0627f);  // ~440 Hz at 44.1 kHz
+        buffer[i * 2 + 1] = buffer[i * 2];
+    }
+
+    int64_t start = esp_timer_get_time();
+    for (int block = 0; block < blocks; block++) {
+        chorus_process(chorus, &params, buffer, FRAMES_PER_WRITE);
+    }
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    heap_caps_free(chorus);
+    return elapsed;
+}
@@ -0,0 +1,71 @@
+// Stereo chorus and flanger on the master bus
+//
+// Each channel reads its delay line at a delay swept by a sine LFO, the right
+// channel a quarter turn after the left, so the mono mix of the voices comes
+// out wide. The LFO and the parameter smoothing run at control rate, once per
+// CHORUS_CONTROL_FRAMES; in between the delay ramps linearly and every frame
+// is the same branch-free read, interpolate, write sequence.
+//
+// Chorus and flanger are the same effect with different settings: a flanger
+// uses a short delay, a shallow sweep and feedback.
+
+#ifndef CHORUS_H
+#define CHORUS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CHORUS_DELAY_LENGTH   2048   // Samples per channel, power of two (46 ms at 44.1 kHz)
+#define CHORUS_CONTROL_FRAMES 32     // Frames between LFO and parameter updates
+#define CHORUS_MAX_DELAY_MS   40.0f  // Longest delay the sweep may reach
+
+typedef enum {
+    CHORUS_OFF = 0,
+    CHORUS_CHORUS,
+    CHORUS_FLANGER,
+    CHORUS_MODE_COUNT
+} chorus_mode_t;
+
+// Settings, any value in range may change at any time
+typedef struct {
+    chorus_mode_t mode;
+    float         rate_hz;   // LFO rate (0.01 .. 10 Hz)
+    float         delay_ms;  // Centre of the sweep
+    float         depth_ms;  // Sweep either side of the centre (at most delay_ms)
+    float         feedback;  // Delayed signal fed back into the line (-0.95 .. 0.95)
+    float         mix;       // 0.0 dry .. 1.0 wet, 0.5 for equal parts
+} chorus_params_t;
+
+// State, about 16 KB; lives in the fast DSP arena
+typedef struct {
+    float line[2][CHORUS_DELAY_LENGTH];  // Per channel
+    int   write;                         // Next slot to write in both lines
+    float lfo_phase;                     // Turns, 0.0 .. 1.0
+    float delay[2];                      // Delay in samples reached at the end of the last segment
+    float centre;                        // Smoothed settings, in samples where they are times
+    float depth;
+    float feedback;
+    float mix;
+    bool  active;                        // False while bypassed (faded out, lines stale)
+} chorus_t;
+
+// Default settings of a mode
+void chorus_preset(chorus_mode_t mode, chorus_params_t* params);
+
+// Check that all settings are in range
+bool chorus_params_valid(const chorus_params_t* params);
+
+// Human readable name ("off", "chorus", "flanger")
+const char* chorus_mode_name(chorus_mode_t mode);
+
+// Clear the delay lines and start bypassed
+void chorus_reset(chorus_t* chorus);
+
+// Process 'frames' interleaved stereo frames in place
+// Switching the mode on or off fades the wet signal in or out instead of clicking
+void chorus_process(chorus_t* chorus, const chorus_params_t* params, float* buffer, int frames);
+
+// Benchmark: time 'blocks' flanger blocks of FRAMES_PER_WRITE frames, returns microseconds
+uint32_t chorus_bench(int blocks);
+
+#endif  // CHORUS_H
@@ -0,0 +1,253 @@
+// Preallocated memory for DSP state
+
+#include "dsp_arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+static const char* TAG = "dsp_arena";
+
+typedef struct {
+    uint8_t* base;     // Reserved at init
+    size_t   size;     // ... its size
+    size_t   used;     // ... and how much of it is carved
+    size_t   refused;  // Bytes asked for that did not fit
+    bool     sram;     // Bulk arena that had to fall back to internal SRAM
+} arena_t;
+
+typedef struct {
+    const char*        name;
+    dsp_arena_region_t region;
+    size_t             size;
+} owner_t;
+
+static arena_t           arenas[DSP_ARENA_COUNT];
+static owner_t           owners[DSP_ARENA_MAX_OWNERS];
+static int               owner_count = 0;
+static dsp_pool_t*       pools       = NULL;
+static SemaphoreHandle_t arena_lock  = NULL;  // Serialises carving, pool registration and the report
+
+static const char* const region_names[DSP_ARENA_COUNT] = {
+    [DSP_ARENA_FAST] = "fast",
+    [DSP_ARENA_BULK] = "bulk",
+};
+
+static const size_t arena_sizes[DSP_ARENA_COUNT] = {
+    [DSP_ARENA_FAST] = DSP_ARENA_FAST_SIZE,
+    [DSP_ARENA_BULK] = DSP_ARENA_BULK_SIZE,
+};
+
+// Render guard: the task currently rendering a block, and what it tried to allocate
+static volatile TaskHandle_t render_task    = NULL;
+static volatile uint32_t     refused_count  = 0;
+static void* volatile        refused_caller = NULL;
+static volatile size_t       refused_size   = 0;
+
+// Helper function: True (and the attempt recorded) if the calling task is rendering
+static inline bool refuse_in_render(void* caller, size_t size) {
+    if (render_task == NULL || xTaskGetCurrentTaskHandle() != render_task) return false;
+    refused_count++;
+    refused_caller = caller;
+    refused_size   = size;
+#ifdef DSP_ARENA_GUARD_ABORT
+    abort();
+#endif
+    return true;
+}
+
+#ifdef CONFIG_DSP_ARENA_RENDER_GUARD
+// The real heap functions, reached through the linker's --wrap option
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t count, size_t size, uint32_t caps);
+void* __real_heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+void* __real_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+
+void* __wrap_malloc(size_t size) {
+    if (refuse_in_render(__builtin_return_address(0), size)) return NULL;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+    if (refuse_in_render(__builtin_return_address(0), count * size)) return NULL;
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    if (refuse_in_render(__builtin_return_address(0), size)) return NULL;
+    return __real_realloc(ptr, size);
+}
+
+void* __wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+    if (refuse_in_render(__builtin_return_address(0), size)) return NULL;
+    return __real_heap_caps_malloc(size, caps);
+}
+
+void* __wrap_heap_caps_calloc(size_t count, size_t size, uint32_t caps) {
+    if (refuse_in_render(__builtin_return_address(0), count * size)) return NULL;
+    return __real_heap_caps_calloc(count, size, caps);
+}
+
+void* __wrap_heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    if (refuse_in_render(__builtin_return_address(0), size)) return NULL;
+    return __real_heap_caps_realloc(ptr, size, caps);
+}
+
+void* __wrap_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    if (refuse_in_render(__builtin_return_address(0), size)) return NULL;
+    return __real_heap_caps_aligned_alloc(alignment, size, caps);
+}
+#endif
+
+// Helper function: Reserve an arena from the heap; without PSRAM the bulk arena falls back to internal SRAM
+static esp_err_t reserve(dsp_arena_region_t region) {
+    const uint32_t internal = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    arena_t*       arena    = &arenas[region];
+    const size_t   size     = arena_sizes[region];
+    if (region == DSP_ARENA_BULK) {
+        arena->base = heap_caps_aligned_alloc(DSP_ARENA_ALIGN, size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (arena->base == NULL) {
+            ESP_LOGW(TAG, "No PSRAM, bulk arena in SRAM");
+            arena->sram = true;
+        }
+    }
+    if (arena->base == NULL) arena->base = heap_caps_aligned_alloc(DSP_ARENA_ALIGN, size, internal);
+    if (arena->base == NULL) {
+        ESP_LOGE(TAG, "No memory for the %u byte %s arena", (unsigned)size, region_names[region]);
+        return ESP_ERR_NO_MEM;
+    }
+    arena->size = size;
+    arena->used = 0;
+    return ESP_OK;
+}
+
+esp_err_t dsp_arena_init(void) {
+    if (arena_lock != NULL) return ESP_ERR_INVALID_STATE;
+    for (int region = 0; region < DSP_ARENA_COUNT; region++) {
+        esp_err_t res = reserve(region);
+        if (res != ESP_OK) return res;
+    }
+    arena_lock = xSemaphoreCreateMutex();
+    return arena_lock != NULL ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+void* dsp_arena_alloc(dsp_arena_region_t region, size_t size, const char* owner) {
+    if (refuse_in_render(__builtin_return_address(0), size)) return NULL;
+    if (region < 0 || region >= DSP_ARENA_COUNT || arena_lock == NULL) return NULL;
+
+    size_t rounded = (size + DSP_ARENA_ALIGN - 1) & ~(size_t)(DSP_ARENA_ALIGN - 1);
+    // The arenas never grow: what does not fit is refused and counted
+    arena_t* arena = &arenas[region];
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    if (rounded > arena->size - arena->used) {
+        arena->refused += rounded;
+        xSemaphoreGive(arena_lock);
+        ESP_LOGE(TAG, "%s: no room for %u bytes in the %s arena", owner, (unsigned)size, region_names[region]);
+        return NULL;
+    }
+    uint8_t* block = arena->base + arena->used;
+    arena->used += rounded;
+
+    // Same owner twice (one allocation per voice, say) adds up in one report line
+    int i = 0;
+    while (i < owner_count && !(owners[i].region == region && strcmp(owners[i].name, owner) == 0)) i++;
+    if (i < owner_count) {
+        owners[i].size += rounded;
+    } else if (owner_count < DSP_ARENA_MAX_OWNERS) {
+        owners[owner_count++] = (owner_t){.name = owner, .region = region, .size = rounded};
+    }
+    xSemaphoreGive(arena_lock);
+
+    memset(block, 0, rounded);
+    return block;
+}
+
+bool dsp_pool_init(dsp_pool_t* pool, dsp_arena_region_t region, size_t block_size, int count, const char* owner) {
+    if (block_size < sizeof(void*)) block_size = sizeof(void*);
+    block_size = (block_size + DSP_ARENA_ALIGN - 1) & ~(size_t)(DSP_ARENA_ALIGN - 1);
+
+    uint8_t* blocks = dsp_arena_alloc(region, block_size * count, owner);
+    if (blocks == NULL) return false;
+
+    // Thread the free list through the blocks, first block first
+    pool->free_list = NULL;
+    for (int i = count - 1; i >= 0; i--) {
+        void** block    = (void**)(blocks + i * block_size);
+        *block          = pool->free_list;
+        pool->free_list = block;
+    }
+    pool->block_size = block_size;
+    pool->count      = count;
+    pool->in_use     = 0;
+    pool->peak       = 0;
+    pool->owner      = owner;
+
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    pool->next = pools;
+    pools      = pool;
+    xSemaphoreGive(arena_lock);
+    return true;
+}
+
+void* dsp_pool_get(dsp_pool_t* pool) {
+    void** block = pool->free_list;
+    if (block == NULL) return NULL;
+    pool->free_list = *block;
+    pool->in_use++;
+    if (pool->in_use > pool->peak) pool->peak = pool->in_use;
+    memset(block, 0, pool->block_size);
+    return block;
+}
+
+void dsp_pool_put(dsp_pool_t* pool, void* block) {
+    if (block == NULL) return;
+    *(void**)block  = pool->free_list;
+    pool->free_list = block;
+    pool->in_use--;
+}
+
+void dsp_arena_render_begin(void) {
+    render_task = xTaskGetCurrentTaskHandle();
+}
+
+void dsp_arena_render_end(void) {
+    render_task = NULL;
+}
+
+uint32_t dsp_arena_refused(void) {
+    return refused_count;
+}
+
+void dsp_arena_report(void) {
+    if (arena_lock == NULL) return;
+    xSemaphoreTake(arena_lock, portMAX_DELAY);
+    for (int region = 0; region < DSP_ARENA_COUNT; region++) {
+        const arena_t* arena = &arenas[region];
+        printf("%s arena (%s): %u of %u bytes used (%.1f%%)", region_names[region],
+               region == DSP_ARENA_FAST || arena->sram ? "SRAM" : "PSRAM", (unsigned)arena->used,
+               (unsigned)arena->size, arena->size > 0 ? arena->used * 100.0f / arena->size : 0.0f);
+        if (arena->refused > 0) printf(", %u bytes refused", (unsigned)arena->refused);
+        printf("\n");
+        for (int i = 0; i < owner_count; i++) {
+            if ((int)owners[i].region == region) printf("  %-20s %8u bytes\n", owners[i].name, (unsigned)owners[i].size);
+        }
+    }
+    for (const dsp_pool_t* pool = pools; pool != NULL; pool = pool->next) {
+        printf("pool %-15s %d x %u bytes, %d in use, peak %d\n", pool->owner, pool->count, (unsigned)pool->block_size,
+               pool->in_use, pool->peak);
+    }
+    xSemaphoreGive(arena_lock);
+    if (refused_count > 0) {
+        printf("Allocations refused while rendering: %lu, last %u bytes from %p\n", (unsigned long)refused_count,
+               (unsigned)refused_size, refused_caller);
+    } else {
+        printf("Allocations refused while rendering: none\n");
+    }
+}
@@ -0,0 +1,93 @@
+// Preallocated memory for DSP state
+//
+// All buffers the audio path works on (block buffers, delay lines, filter
+// states, recordings) are carved from two arenas that are never returned:
+//
+//   DSP_ARENA_FAST  internal SRAM, for state touched every sample in random
+//                   order: filter states, block buffers, short delay lines
+//   DSP_ARENA_BULK  PSRAM, for large buffers read and written in order:
+//                   long delay lines, loop records, streaming buffers
+//
+// Both arenas are reserved in full by dsp_arena_init(), sized in the Synth
+// menu of menuconfig from what the 'arena' report shows, and never grow: an
+// allocation that does not fit fails and is counted in the report. Almost
+// everything is carved at startup; a few buffers (the PCM capture ring) are
+// carved later from the console task, so carving is serialised by a mutex.
+//
+// Fixed-size pools on top of the arenas hand out and take back blocks in O(1)
+// without touching the heap, for state that comes and goes with notes.
+//
+// While the audio task renders a block, dsp_arena_alloc() fails for that task.
+// With CONFIG_DSP_ARENA_RENDER_GUARD (a debugging option, off by default) the
+// heap functions malloc(), calloc(), realloc() and heap_caps_malloc(),
+// _calloc(), _realloc() and _aligned_alloc() are wrapped at link time as well
+// (see CMakeLists.txt), so an allocation that sneaks into the render path
+// shows up in the 'arena' console report instead of as a rare audio glitch.
+
+#ifndef DSP_ARENA_H
+#define DSP_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+// Arena sizes (CONFIG_DSP_ARENA_FAST_SIZE and _BULK_SIZE are in KB)
+#define DSP_ARENA_FAST_SIZE (CONFIG_DSP_ARENA_FAST_SIZE * 1024)
+#define DSP_ARENA_BULK_SIZE (CONFIG_DSP_ARENA_BULK_SIZE * 1024)
+
+#define DSP_ARENA_ALIGN      16  // Alignment of every allocation (cache line friendly, SIMD loads)
+#define DSP_ARENA_MAX_OWNERS 32  // Allocations listed by name in the report
+
+// Uncomment to abort() on the first allocation inside the render function
+// instead of failing it (the backtrace then points straight at the caller)
+// #define DSP_ARENA_GUARD_ABORT
+
+typedef enum {
+    DSP_ARENA_FAST = 0,  // Internal SRAM
+    DSP_ARENA_BULK,      // PSRAM (internal SRAM if the board has none)
+    DSP_ARENA_COUNT
+} dsp_arena_region_t;
+
+// Pool of equally sized blocks carved from an arena
+// Not thread safe: get and put from one task only (normally the audio task)
+typedef struct dsp_pool {
+    void*            free_list;   // First free block, each free block holds the next pointer
+    size_t           block_size;  // Bytes per block, rounded up to DSP_ARENA_ALIGN
+    int              count;       // Blocks in the pool
+    int              in_use;      // Blocks handed out now
+    int              peak;        // Most blocks handed out at once
+    const char*      owner;       // Name in the report
+    struct dsp_pool* next;        // Next registered pool
+} dsp_pool_t;
+
+// Reserve both arenas, call once before any DSP module initialises; ESP_ERR_NO_MEM if the heap
+// cannot hold them
+esp_err_t dsp_arena_init(void);
+
+// Zeroed, DSP_ARENA_ALIGN aligned memory for the lifetime of the program, or NULL when the
+// arena is full or when called from the render function; 'owner' names it in the report
+// Any task but the audio task may call it, at any time
+void* dsp_arena_alloc(dsp_arena_region_t region, size_t size, const char* owner);
+
+// Carve a pool of 'count' blocks of 'block_size' bytes, returns false if the arena is full
+bool dsp_pool_init(dsp_pool_t* pool, dsp_arena_region_t region, size_t block_size, int count, const char* owner);
+
+// Take a zeroed block from a pool, NULL if all are in use
+void* dsp_pool_get(dsp_pool_t* pool);
+
+// Give a block back to the pool it came from
+void dsp_pool_put(dsp_pool_t* pool, void* block);
+
+// Mark the calling task as rendering, allocations from it fail until dsp_arena_render_end()
+void dsp_arena_render_begin(void);
+void dsp_arena_render_end(void);
+
+// Allocations refused while rendering since startup
+uint32_t dsp_arena_refused(void);
+
+// Print the usage of both arenas, every owner and every pool, and refused allocations
+void dsp_arena_report(void);
+
+#endif  // DSP_ARENA_H
@@ -0,0 +1,50 @@
+// DSP benchmarks, shared by the console's 'bench' command and host/bench
+
+#include "dsp_bench.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "chorus.h"
+#include "granular.h"
+#include "modal.h"
+#include "resampler.h"
+#include "speaker_eq.h"
+#include "synth.h"
+#include "waveshaper.h"
+
+typedef struct {
+    const char* name;
+    const char* description;
+    uint32_t (*run)(int blocks);
+    uint32_t    block_rate;  // Output rate the benchmarked block is played at
+    int         units;       // Units of work in a block, reported per ms (0 = none)
+    const char* unit_name;   // ... their name
+} benchmark_t;
+
+static const benchmark_t benchmarks[] = {
+    {"src", "44.1 -> 48 kHz polyphase resampler", resampler_bench, RESAMPLER_OUTPUT_RATE, 0, NULL},
+    {"chorus", "Stereo flanger, modulated fractional delay with feedback", chorus_bench, SAMPLE_RATE, 0, NULL},
+    {"shaper", "Stereo tanh waveshaper, 2x half-band oversampling", waveshaper_bench, SAMPLE_RATE, 0, NULL},
+    {"speaker", "Fixed-point speaker EQ (4 biquads) and bass enhancer", speaker_eq_bench, SAMPLE_RATE, 0, NULL},
+    {"grain", "64 windowed grains read from the PSRAM source", granular_bench, SAMPLE_RATE, GRANULAR_MAX_GRAINS,
+     "grains"},
+    {"modal", "13 voices of 32 two-pole resonators, 4 lanes per group", modal_bench, SAMPLE_RATE, 0, NULL},
+};
+
+bool dsp_bench_run(const char* name, int blocks) {
+    bool found = false;
+    for (size_t i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++) {
+        const benchmark_t* bench = &benchmarks[i];
+        if (name != NULL && strcmp(name, bench->name) != 0) continue;
+        found = true;
+
+        uint32_t total_us    = bench->run(blocks);
+        float    block_us    = (float)total_us / blocks;
+        float    deadline_us = FRAMES_PER_WRITE * 1000000.0f / bench->block_rate;
+        printf("%-8s %8.2f us per %d frame block, %5.1f%% of deadline", bench->name, block_us, FRAMES_PER_WRITE,
+               block_us * 100.0f / deadline_us);
+        if (bench->units > 0) printf(", %.0f %s per ms", bench->units * 1000.0f / block_us, bench->unit_name);
+        printf(" (%s)\n", bench->description);
+    }
+    return found;
+}
@@ -0,0 +1,17 @@
+// DSP benchmarks, shared by the console's 'bench' command and host/bench
+//
+// Each DSP module with an inner loop worth timing has a <module>_bench()
+// function that runs it over 'blocks' blocks of FRAMES_PER_WRITE frames and
+// returns the time taken. The table of them and the report line live here, so
+// the figures from the device and from the PC come out in the same form.
+
+#ifndef DSP_BENCH_H
+#define DSP_BENCH_H
+
+#include <stdbool.h>
+
+// Run the benchmark called 'name' (NULL = every one) over 'blocks' blocks and print a line for each
+// Returns false if there is no benchmark called 'name'
+bool dsp_bench_run(const char* name, int blocks);
+
+#endif  // DSP_BENCH_H
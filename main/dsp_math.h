@@ -0,0 +1,50 @@
+// Small math helpers for the audio render path
+//
+// The render path stays clear of libm, which lives in flash: these cheap
+// approximations stand in for sinf() and expf() where their accuracy is enough.
+
+#ifndef DSP_MATH_H
+#define DSP_MATH_H
+
+#include <math.h>
+#include <stdint.h>
+
+// Sine of a phase in turns (0.0 .. 1.0), parabolic approximation (error about 0.1%)
+static inline float lfo_sine(float phase) {
+    float u = phase - 0.5f;  // sin(2 pi phase) = -sin(2 pi u)
+    float y = 8.0f * u - 16.0f * u * fabsf(u);
+    y += 0.225f * (y * fabsf(y) - y);
+    return -y;
+}
+
+// exp(-x) for the small x of one block's envelope decay (x < 0.1, error < 2e-6)
+static inline float decay_factor(float x) {
+    return 1.0f - x * (1.0f - x * (0.5f - x * (1.0f / 6.0f)));
+}
+
+// 2^x for pitch ratios of a few octaves (|x| < 16, error about 0.01%)
+static inline float exp2_approx(float x) {
+    int   whole = (int)x - (x < (int)x);  // Rounded down
+    float f     = x - whole;              // 0.0 .. 1.0
+    float p     = 1.0f + f * (0.6960656f + f * (0.2244943f + f * 0.0794402f));
+    union {
+        uint32_t bits;
+        float    value;
+    } scale = {.bits = (uint32_t)(whole + 127) << 23};  // 2^whole
+    return p * scale.value;
+}
+
+// 1 / sqrt(x) for levels (x > 0, error about 0.0005%): bit trick estimate and two Newton steps
+static inline float inverse_sqrt_approx(float x) {
+    union {
+        float    value;
+        uint32_t bits;
+    } estimate = {.value = x};
+    estimate.bits = 0x5F375A86u - (estimate.bits >> 1);
+    float y       = estimate.value;
+    y *= 1.5f - 0.5f * x * y * y;
+    y *= 1.5f - 0.5f * x * y * y;
+    return y;
+}
+
+#endif  // DSP_MATH_H
@@ -0,0 +1,181 @@
+// Event-driven display updates for e-paper panels
+
+#include "epaper.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bsp/display.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "fb_region.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "trace.h"
+
+// Windows start and end on multiples of 8 panel pixels: e-paper controllers
+// address the RAM in whole bytes, and with 2 bits per pixel it keeps every
+// window row byte aligned in the framebuffer, whatever the bit order
+#define EPAPER_ALIGN 8
+
+// Separate changes (e.g. a key on the keyboard and the status line) go out as
+// separate windows, so the region between them is not refreshed for nothing;
+// beyond this many the closest ones are merged
+#define EPAPER_MAX_WINDOWS 4
+
+typedef struct {
+    int x0, y0, x1, y1;  // Panel coordinates, x1 and y1 exclusive
+} epaper_window_t;
+
+static const char* TAG = "epaper";
+
+static pax_buf_t*   fb                 = NULL;
+static uint8_t*     staging            = NULL;  // Copy of the framebuffer the panel task reads from
+static uint8_t*     window_buf         = NULL;  // Packed pixels of the window being sent
+static size_t       fb_size            = 0;
+static int          raw_w              = 0;  // Panel size in pixels
+static int          raw_h              = 0;
+static int          bits               = 0;  // Bits per pixel of the framebuffer
+static TaskHandle_t epaper_task_handle = NULL;
+
+// Changes not yet sent, as windows that neither overlap nor touch (UI task only)
+static epaper_window_t pending[EPAPER_MAX_WINDOWS];
+static int             pending_count = 0;
+static int64_t         pending_since = 0;
+
+// Windows handed to the panel task, valid while panel_busy is set
+static epaper_window_t refresh_windows[EPAPER_MAX_WINDOWS];
+static int             refresh_count = 0;
+static atomic_bool     panel_busy    = false;
+
+// Helper function: The smallest window holding both
+static epaper_window_t window_union(epaper_window_t a, epaper_window_t b) {
+    return (epaper_window_t){a.x0 < b.x0 ? a.x0 : b.x0, a.y0 < b.y0 ? a.y0 : b.y0, a.x1 > b.x1 ? a.x1 : b.x1,
+                             a.y1 > b.y1 ? a.y1 : b.y1};
+}
+
+// Helper function: Pixels of a window
+static int window_area(epaper_window_t window) {
+    return (window.x1 - window.x0) * (window.y1 - window.y0);
+}
+
+static void epaper_task(void* arg) {
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        for (int i = 0; i < refresh_count; i++) {
+            epaper_window_t window = refresh_windows[i];
+            int             w      = window.x1 - window.x0;
+            int             h      = window.y1 - window.y0;
+
+            TRACE_BEGIN(TRACE_BLIT);
+            if (w == raw_w && h == raw_h) {
+                bsp_display_blit(0, 0, raw_w, raw_h, staging);
+            } else {
+                // Pack the rows of the window, they are byte aligned thanks to EPAPER_ALIGN
+                size_t row_bytes = (size_t)w * bits / 8;
+                for (int row = 0; row < h; row++) {
+                    size_t offset = ((size_t)(window.y0 + row) * raw_w + window.x0) * bits / 8;
+                    memcpy(window_buf + row * row_bytes, staging + offset, row_bytes);
+                }
+                bsp_display_blit(window.x0, window.y0, w, h, window_buf);
+            }
+            TRACE_END(TRACE_BLIT);
+        }
+
+        // The staging buffer may be overwritten from here on
+        atomic_store_explicit(&panel_busy, false, memory_order_release);
+    }
+}
+
+bool epaper_start(pax_buf_t* buf) {
+    fb      = buf;
+    fb_size = pax_buf_get_size(buf);
+
+    // Panel size is the framebuffer size with the rotation undone
+    pax_recti raw = fb_region_to_raw(buf, (pax_recti){0, 0, pax_buf_get_width(buf), pax_buf_get_height(buf)});
+    raw_w         = raw.w;
+    raw_h         = raw.h;
+    bits          = (int)(fb_size * 8 / ((size_t)raw_w * raw_h));
+
+    staging    = malloc(fb_size);
+    window_buf = malloc(fb_size);
+    if (staging == NULL || window_buf == NULL || raw_w % EPAPER_ALIGN != 0) {
+        ESP_LOGE(TAG, "Cannot use partial refresh on this panel");
+        free(staging);
+        free(window_buf);
+        staging    = NULL;
+        window_buf = NULL;
+        return false;
+    }
+
+    // Same priority as the UI loop on core 0: while the panel is refreshing the
+    // UI keeps handling keys, the audio task on core 1 is never involved
+    xTaskCreatePinnedToCore(epaper_task, "epaper", 3072, NULL, tskIDLE_PRIORITY + 1, &epaper_task_handle, 0);
+    return true;
+}
+
+void epaper_damage(pax_recti rect) {
+    pax_recti raw = fb_region_to_raw(fb, rect);
+
+    // Grow to the alignment grid and clamp to the panel
+    int x0 = raw.x / EPAPER_ALIGN * EPAPER_ALIGN;
+    int x1 = (raw.x + raw.w + EPAPER_ALIGN - 1) / EPAPER_ALIGN * EPAPER_ALIGN;
+    int y0 = raw.y;
+    int y1 = raw.y + raw.h;
+    if (x0 < 0) x0 = 0;
+    if (y0 < 0) y0 = 0;
+    if (x1 > raw_w) x1 = raw_w;
+    if (y1 > raw_h) y1 = raw_h;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    if (pending_count == 0) pending_since = esp_timer_get_time();
+
+    // Absorb every pending window the new one overlaps or touches; a merged window may reach
+    // further ones, so start over after each merge
+    epaper_window_t window = {x0, y0, x1, y1};
+    while (1) {
+        for (int i = 0; i < pending_count;) {
+            if (pending[i].x0 <= window.x1 && window.x0 <= pending[i].x1 && pending[i].y0 <= window.y1 &&
+                window.y0 <= pending[i].y1) {
+                window     = window_union(window, pending[i]);
+                pending[i] = pending[--pending_count];
+                i          = 0;
+            } else {
+                i++;
+            }
+        }
+        if (pending_count < EPAPER_MAX_WINDOWS) {
+            pending[pending_count++] = window;
+            return;
+        }
+
+        // No room: merge into the pending window that grows the least, then look for overlaps again
+        int best = 0;
+        int cost = 0;
+        for (int i = 0; i < pending_count; i++) {
+            int grown = window_area(window_union(window, pending[i])) - window_area(pending[i]);
+            if (i == 0 || grown < cost) {
+                best = i;
+                cost = grown;
+            }
+        }
+        window        = window_union(window, pending[best]);
+        pending[best] = pending[--pending_count];
+    }
+}
+
+void epaper_commit(void) {
+    if (pending_count == 0 || staging == NULL) return;
+    if (esp_timer_get_time() - pending_since < EPAPER_BATCH_MS * 1000) return;
+    if (atomic_load_explicit(&panel_busy, memory_order_acquire)) return;
+
+    // Snapshot the frame so the UI can keep drawing while the panel refreshes
+    memcpy(staging, pax_buf_get_pixels(fb), fb_size);
+    memcpy(refresh_windows, pending, sizeof(epaper_window_t) * pending_count);
+    refresh_count = pending_count;
+    pending_count = 0;
+
+    atomic_store_explicit(&panel_busy, true, memory_order_relaxed);
+    xTaskNotifyGive(epaper_task_handle);
+}
@@ -0,0 +1,31 @@
+// Event-driven display updates for e-paper panels
+//
+// An e-paper refresh takes hundreds of milliseconds. Instead of blitting from
+// the UI loop (which would hold up key handling, and with it note starts),
+// the UI only reports which screen regions changed. Changes are collected for
+// a short batching window, then the framebuffer is copied to a staging buffer
+// and a separate task sends the changed regions to the panel as partial
+// refreshes, one per group of regions that overlap or touch. Changes made
+// while the panel is busy are batched into the next refresh.
+
+#ifndef EPAPER_H
+#define EPAPER_H
+
+#include <stdbool.h>
+#include "pax_gfx.h"
+
+// Changes closer together than this go out in one refresh (e.g. the keys of a chord)
+#define EPAPER_BATCH_MS 60
+
+// Allocate the staging buffers and start the panel task
+// Returns false if there is not enough memory
+bool epaper_start(pax_buf_t* fb);
+
+// Report a changed region of the framebuffer, in screen coordinates
+void epaper_damage(pax_recti rect);
+
+// Start a refresh if changes are due and the panel is idle, call this from the
+// UI loop after drawing; never waits for the panel
+void epaper_commit(void);
+
+#endif  // EPAPER_H
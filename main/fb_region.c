@@ -0,0 +1,91 @@
+// Helpers for working on rectangular regions of the framebuffer
+
+#include "fb_region.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Helper function: Bytes per pixel of the framebuffer, 0 if pixels are not byte aligned
+static int fb_bytes_per_pixel(const pax_buf_t* fb) {
+    switch (pax_buf_get_type(fb)) {
+        case PAX_BUF_16_565RGB: return 2;
+        case PAX_BUF_24_888RGB: return 3;
+        default: return 0;
+    }
+}
+
+// Helper function: Panel size, the screen size with the rotation undone
+static void fb_raw_size(const pax_buf_t* fb, int* raw_w, int* raw_h) {
+    pax_orientation_t orientation = pax_buf_get_orientation(fb);
+    bool              rotated     = orientation == PAX_O_ROT_CCW || orientation == PAX_O_ROT_CW;
+    *raw_w = rotated ? pax_buf_get_height(fb) : pax_buf_get_width(fb);
+    *raw_h = rotated ? pax_buf_get_width(fb) : pax_buf_get_height(fb);
+}
+
+pax_recti fb_region_to_raw(const pax_buf_t* fb, pax_recti rect) {
+    int raw_w, raw_h;
+    fb_raw_size(fb, &raw_w, &raw_h);
+
+    switch (pax_buf_get_orientation(fb)) {
+        case PAX_O_ROT_CCW: return (pax_recti){rect.y, raw_h - (rect.x + rect.w), rect.h, rect.w};
+        case PAX_O_ROT_HALF: return (pax_recti){raw_w - (rect.x + rect.w), raw_h - (rect.y + rect.h), rect.w, rect.h};
+        case PAX_O_ROT_CW: return (pax_recti){raw_w - (rect.y + rect.h), rect.x, rect.h, rect.w};
+        default: return rect;
+    }
+}
+
+bool fb_region_scroll(pax_buf_t* fb, pax_recti rect, int dx, int dy) {
+    int bpp = fb_bytes_per_pixel(fb);
+    if (bpp == 0) return false;
+
+    int raw_w, raw_h;
+    fb_raw_size(fb, &raw_w, &raw_h);
+
+    // Rotate the shift the same way as the region
+    pax_recti raw = fb_region_to_raw(fb, rect);
+    int       rdx = dx, rdy = dy;
+    switch (pax_buf_get_orientation(fb)) {
+        case PAX_O_ROT_CCW:
+            rdx = dy;
+            rdy = -dx;
+            break;
+        case PAX_O_ROT_HALF:
+            rdx = -dx;
+            rdy = -dy;
+            break;
+        case PAX_O_ROT_CW:
+            rdx = -dy;
+            rdy = dx;
+            break;
+        default:
+            break;
+    }
+
+    // Clamp the region to the panel
+    if (raw.x < 0) {
+        raw.w += raw.x;
+        raw.x  = 0;
+    }
+    if (raw.y < 0) {
+        raw.h += raw.y;
+        raw.y  = 0;
+    }
+    if (raw.x + raw.w > raw_w) raw.w = raw_w - raw.x;
+    if (raw.y + raw.h > raw_h) raw.h = raw_h - raw.y;
+    if (abs(rdx) >= raw.w || abs(rdy) >= raw.h) return true;  // Everything scrolls out
+
+    uint8_t* pixels = pax_buf_get_pixels(fb);
+    size_t   stride = (size_t)raw_w * bpp;
+    size_t   length = (size_t)(raw.w - abs(rdx)) * bpp;
+    int      src_x  = raw.x + (rdx < 0 ? -rdx : 0);
+    int      dst_x  = raw.x + (rdx > 0 ? rdx : 0);
+
+    // Walk rows against the shift so source rows are read before they are overwritten
+    int rows = raw.h - abs(rdy);
+    for (int i = 0; i < rows; i++) {
+        int dst_y = rdy > 0 ? raw.y + raw.h - 1 - i : raw.y + i;
+        int src_y = dst_y - rdy;
+        memmove(pixels + dst_y * stride + dst_x * bpp, pixels + src_y * stride + src_x * bpp, length);
+    }
+    return true;
+}
@@ -0,0 +1,22 @@
+// Helpers for working on rectangular regions of the framebuffer
+//
+// The UI draws in screen coordinates, while the framebuffer memory is laid out
+// in panel coordinates (rotated by the display orientation). These helpers map
+// regions between the two and move framebuffer content in place, so views that
+// scroll only have to draw the newly exposed strip.
+
+#ifndef FB_REGION_H
+#define FB_REGION_H
+
+#include <stdbool.h>
+#include "pax_gfx.h"
+
+// Map a region from screen to panel coordinates
+pax_recti fb_region_to_raw(const pax_buf_t* fb, pax_recti rect);
+
+// Shift the content of a region by (dx, dy) screen pixels, in place
+// The exposed strip keeps stale pixels and must be redrawn by the caller
+// Returns false if the buffer format does not support scrolling (palette buffers)
+bool fb_region_scroll(pax_buf_t* fb, pax_recti rect, int dx, int dy);
+
+#endif  // FB_REGION_H
@@ -0,0 +1,229 @@
+// Framebuffer snapshots over the serial console
+
+#include "fb_snapshot.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "fb_region.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define SNAPSHOT_MAX_RECTS  16
+#define SNAPSHOT_LINE_BYTES 768  // Encoded bytes per FB line (1024 base64 characters)
+
+static const char* TAG = "fb_snapshot";
+
+static pax_buf_t*   fb                  = NULL;
+static bool         fb_big_endian       = false;
+static uint8_t*     copy                = NULL;  // Pixels of all regions, packed one after another (PSRAM)
+static int          bpp                 = 0;     // Bytes per pixel
+static int          raw_w               = 0;     // Panel size in pixels
+static int          raw_h               = 0;
+static TaskHandle_t snapshot_task_handle = NULL;
+
+// Request from the console, and the copy handed to the encoder while 'busy' is set
+static volatile fb_snapshot_mode_t wanted = FB_SNAPSHOT_NONE;
+static atomic_bool                 busy   = false;
+static pax_recti                   regions[SNAPSHOT_MAX_RECTS];  // Panel coordinates
+static int                         region_count = 0;
+static uint32_t                    copy_us      = 0;
+static uint32_t                    sequence     = 0;
+
+static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Encoded bytes waiting to be printed (encoder task)
+static uint8_t line_buf[SNAPSHOT_LINE_BYTES];
+static int     line_used  = 0;
+static size_t  coded_size = 0;
+
+// Helper function: Print the pending encoded bytes as one FB line
+static void flush_line(void) {
+    if (line_used == 0) return;
+    char text[SNAPSHOT_LINE_BYTES / 3 * 4 + 1];
+    int  length = 0;
+    for (int i = 0; i < line_used; i += 3) {
+        uint32_t group = (uint32_t)line_buf[i] << 16;
+        if (i + 1 < line_used) group |= (uint32_t)line_buf[i + 1] << 8;
+        if (i + 2 < line_used) group |= line_buf[i + 2];
+        text[length++] = base64_chars[(group >> 18) & 63];
+        text[length++] = base64_chars[(group >> 12) & 63];
+        text[length++] = i + 1 < line_used ? base64_chars[(group >> 6) & 63] : '=';
+        text[length++] = i + 2 < line_used ? base64_chars[group & 63] : '=';
+    }
+    text[length] = '\0';
+    printf("FB %s\n", text);
+    coded_size += line_used;
+    line_used   = 0;
+}
+
+// Helper function: Append encoded bytes, a packet may span two lines
+static void emit(const uint8_t* data, int length) {
+    while (length > 0) {
+        int part = SNAPSHOT_LINE_BYTES - line_used;
+        if (part > length) part = length;
+        memcpy(line_buf + line_used, data, part);
+        line_used += part;
+        data      += part;
+        length    -= part;
+        if (line_used == SNAPSHOT_LINE_BYTES) flush_line();
+    }
+}
+
+// Helper function: Run-length encode 'count' packed pixels
+static void encode_pixels(const uint8_t* pixels, int count) {
+    int literal = 0;  // Start of the pending literal pixels
+    int i       = 0;
+    while (i < count) {
+        int run = 1;
+        while (i + run < count && run < 128 && memcmp(pixels + (i + run) * bpp, pixels + i * bpp, bpp) == 0) run++;
+
+        // Two equal pixels already code shorter as a run than as part of a literal
+        if (run >= 2 || i - literal == 128) {
+            while (literal < i) {
+                int     length  = i - literal < 128 ? i - literal : 128;
+                uint8_t control = (uint8_t)(length - 1);
+                emit(&control, 1);
+                emit(pixels + literal * bpp, length * bpp);
+                literal += length;
+            }
+        }
+        if (run >= 2) {
+            uint8_t control = (uint8_t)(127 + run);
+            emit(&control, 1);
+            emit(pixels + i * bpp, bpp);
+            i       += run;
+            literal  = i;
+        } else {
+            i++;
+        }
+    }
+    while (literal < count) {
+        int     length  = count - literal < 128 ? count - literal : 128;
+        uint8_t control = (uint8_t)(length - 1);
+        emit(&control, 1);
+        emit(pixels + literal * bpp, length * bpp);
+        literal += length;
+    }
+}
+
+// Helper function: Name of the rotation between the panel and the screen, as understood by fb_snapshot_to_png.py
+static const char* orientation_name(pax_orientation_t orientation) {
+    switch (orientation) {
+        case PAX_O_UPRIGHT: return "upright";
+        case PAX_O_ROT_CCW: return "ccw";
+        case PAX_O_ROT_HALF: return "half";
+        case PAX_O_ROT_CW: return "cw";
+        default: return "other";
+    }
+}
+
+static void snapshot_task(void* arg) {
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t start = esp_timer_get_time();
+
+        size_t raw_size = 0;
+        coded_size      = 0;
+        printf("FB-START %lu %d %d %s %s %s %d\n", (unsigned long)sequence, raw_w, raw_h, bpp == 2 ? "rgb565" : "rgb888",
+               fb_big_endian ? "be" : "le", orientation_name(pax_buf_get_orientation(fb)), region_count);
+
+        const uint8_t* pixels = copy;
+        for (int i = 0; i < region_count; i++) {
+            pax_recti rect = regions[i];
+            printf("FB-RECT %d %d %d %d\n", rect.x, rect.y, rect.w, rect.h);
+            encode_pixels(pixels, rect.w * rect.h);
+            flush_line();
+            pixels   += (size_t)rect.w * rect.h * bpp;
+            raw_size += (size_t)rect.w * rect.h * bpp;
+        }
+        printf("FB-STOP %lu %u %u %lu %lu\n", (unsigned long)sequence, (unsigned)raw_size, (unsigned)coded_size,
+               (unsigned long)copy_us, (unsigned long)(esp_timer_get_time() - start));
+        sequence++;
+
+        // The copy may be overwritten from here on
+        atomic_store_explicit(&busy, false, memory_order_release);
+    }
+}
+
+void fb_snapshot_start(pax_buf_t* buf, bool big_endian) {
+    fb            = buf;
+    fb_big_endian = big_endian;
+
+    // Panel size is the framebuffer size with the rotation undone
+    pax_recti raw = fb_region_to_raw(buf, (pax_recti){0, 0, pax_buf_get_width(buf), pax_buf_get_height(buf)});
+    raw_w         = raw.w;
+    raw_h         = raw.h;
+    switch (pax_buf_get_type(buf)) {
+        case PAX_BUF_16_565RGB: bpp = 2; break;
+        case PAX_BUF_24_888RGB: bpp = 3; break;
+        default: bpp = 0; break;
+    }
+
+    // Idle priority on core 0: encoding only uses time the UI does not want, core 1 is not involved
+    xTaskCreatePinnedToCore(snapshot_task, "fb_snapshot", 3072, NULL, tskIDLE_PRIORITY, &snapshot_task_handle, 0);
+}
+
+esp_err_t fb_snapshot_request(fb_snapshot_mode_t mode) {
+    if (fb == NULL || bpp == 0) return ESP_ERR_NOT_SUPPORTED;
+    // In the opposite order to fb_snapshot_take(), which sets busy before it clears the request: if the request
+    // reads as cleared here, busy reads as set
+    if (wanted != FB_SNAPSHOT_NONE) return ESP_ERR_INVALID_STATE;
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&busy, memory_order_acquire)) return ESP_ERR_INVALID_STATE;
+    if (copy == NULL) {
+        copy = heap_caps_malloc((size_t)raw_w * raw_h * bpp, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (copy == NULL) {
+            ESP_LOGE(TAG, "No memory for a copy of the framebuffer");
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    wanted = mode;
+    return ESP_OK;
+}
+
+fb_snapshot_mode_t fb_snapshot_wanted(void) {
+    return wanted;
+}
+
+void fb_snapshot_take(const pax_recti* rects, int count) {
+    if (wanted == FB_SNAPSHOT_NONE) return;
+    int64_t        start  = esp_timer_get_time();
+    const uint8_t* pixels = pax_buf_get_pixels(fb);
+
+    if (rects == NULL || count > SNAPSHOT_MAX_RECTS) {
+        memcpy(copy, pixels, (size_t)raw_w * raw_h * bpp);
+        regions[0]   = (pax_recti){0, 0, raw_w, raw_h};
+        region_count = 1;
+    } else {
+        // Pack the rows of every region, clamped to the panel
+        uint8_t* out = copy;
+        region_count = 0;
+        for (int i = 0; i < count; i++) {
+            pax_recti raw = fb_region_to_raw(fb, rects[i]);
+            int       x0  = raw.x < 0 ? 0 : raw.x;
+            int       y0  = raw.y < 0 ? 0 : raw.y;
+            int       x1  = raw.x + raw.w > raw_w ? raw_w : raw.x + raw.w;
+            int       y1  = raw.y + raw.h > raw_h ? raw_h : raw.y + raw.h;
+            if (x1 <= x0 || y1 <= y0) continue;
+
+            size_t row_bytes = (size_t)(x1 - x0) * bpp;
+            for (int y = y0; y < y1; y++) {
+                memcpy(out, pixels + ((size_t)y * raw_w + x0) * bpp, row_bytes);
+                out += row_bytes;
+            }
+            regions[region_count++] = (pax_recti){x0, y0, x1 - x0, y1 - y0};
+        }
+    }
+    copy_us = (uint32_t)(esp_timer_get_time() - start);
+
+    // The copy belongs to the encoder from here; busy goes up before the request is cleared, so a console
+    // request in between finds one or the other set
+    atomic_store_explicit(&busy, true, memory_order_release);
+    atomic_thread_fence(memory_order_release);
+    wanted = FB_SNAPSHOT_NONE;
+    xTaskNotifyGive(snapshot_task_handle);
+}
@@ -0,0 +1,47 @@
+// Framebuffer snapshots over the serial console
+//
+// The 'fbsnap' console command asks for the whole framebuffer or for the
+// regions redrawn by the next screen update. The UI loop copies those pixels
+// once, right after the frame is complete, and a task at idle priority on
+// core 0 run-length encodes the copy and prints it, so neither the UI loop nor
+// the audio task on core 1 waits for the console. fb_snapshot_to_png.py turns
+// the log into PNG files.
+//
+// Output, one line each:
+//   FB-START <seq> <panel width> <panel height> <rgb565|rgb888> <le|be> <upright|ccw|half|cw> <regions>
+//   FB-RECT <x> <y> <w> <h>          once per region, in panel coordinates
+//   FB <base64>                      RLE data of the region, split over lines
+//   FB-STOP <seq> <raw bytes> <encoded bytes> <copy us> <encode us>
+//
+// Pixels keep the framebuffer's native layout (2 or 3 bytes, byte order as
+// reported) and run row by row through each region. The RLE stream is a
+// sequence of packets: a control byte c < 128 is followed by c + 1 literal
+// pixels, a control byte c >= 128 by one pixel repeated c - 127 times.
+
+#ifndef FB_SNAPSHOT_H
+#define FB_SNAPSHOT_H
+
+#include <stdbool.h>
+#include "esp_err.h"
+#include "pax_gfx.h"
+
+typedef enum {
+    FB_SNAPSHOT_NONE = 0,
+    FB_SNAPSHOT_FULL,   // The whole framebuffer, at the next pass of the UI loop
+    FB_SNAPSHOT_DIRTY,  // Only the regions sent to the display at the next screen update
+} fb_snapshot_mode_t;
+
+// Start the encoder task; 'big_endian' is the byte order of the pixels in memory
+void fb_snapshot_start(pax_buf_t* fb, bool big_endian);
+
+// Ask for a snapshot (console), the copy buffer is allocated on first use
+// Fails if a snapshot is still being encoded or the framebuffer is not RGB565 or RGB888
+esp_err_t fb_snapshot_request(fb_snapshot_mode_t mode);
+
+// Snapshot the UI loop should take, FB_SNAPSHOT_NONE most of the time
+fb_snapshot_mode_t fb_snapshot_wanted(void);
+
+// Copy the regions (screen coordinates, NULL for the whole frame) and hand them to the encoder (UI loop)
+void fb_snapshot_take(const pax_recti* rects, int count);
+
+#endif  // FB_SNAPSHOT_H
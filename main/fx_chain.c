@@ -0,0 +1,228 @@
+// Effects graph: voice inserts, two send buses and the master chain
+//
+// A schedule is compiled on the console core into the schedule the audio
+// task is not using and handed over with a pointer swap (see synth.c), so
+// compiling may take its time; the audio task only calls the step functions.
+
+#include "fx_chain.h"
+#include <string.h>
+#include "dsp_arena.h"
+
+// What the compiler needs to know about an effect kind
+typedef struct {
+    const char* name;
+    fx_block_fn run;
+    void (*init)(void* state);        // Set up or clear the stereo instance
+    void (*init_voice)(void* state);  // ... a mono voice instance
+    size_t      size;                 // Stereo instance
+    size_t      voice_size;           // Mono instance per voice, 0 if the kind cannot be a voice insert
+    size_t      params_offset;        // Settings in fx_settings_t
+} fx_kind_info_t;
+
+// Helper function: Block functions binding each kind's process function to a step
+static void run_drive(const fx_step_t* step, void* state, float* buffer, int frames) {
+    waveshaper_process(state, step->params, buffer, frames);
+}
+
+static void run_chorus(const fx_step_t* step, void* state, float* buffer, int frames) {
+    chorus_process(state, step->params, buffer, frames);
+}
+
+// Helper function: Return step, adds a bus to the master mix at the return level
+static void run_return(const fx_step_t* step, void* state, float* buffer, int frames) {
+    const float* source = step->source;
+    const float  gain   = step->gain;
+    for (int i = 0; i < frames * 2; i++) buffer[i] += gain * source[i];
+}
+
+static void init_drive(void* state) {
+    waveshaper_init(state, 2);
+}
+
+static void init_drive_voice(void* state) {
+    waveshaper_init(state, 1);
+}
+
+static void init_chorus(void* state) {
+    chorus_reset(state);
+}
+
+static const fx_kind_info_t kinds[FX_KIND_COUNT] = {
+    [FX_NONE]   = {.name = "none"},
+    [FX_DRIVE]  = {.name          = "drive",
+                   .run           = run_drive,
+                   .init          = init_drive,
+                   .init_voice    = init_drive_voice,
+                   .size          = WAVESHAPER_SIZE(2),
+                   .voice_size    = WAVESHAPER_SIZE(1),
+                   .params_offset = offsetof(fx_settings_t, drive)},
+    [FX_CHORUS] = {.name          = "chorus",
+                   .run           = run_chorus,
+                   .init          = init_chorus,
+                   .size          = sizeof(chorus_t),
+                   .params_offset = offsetof(fx_settings_t, chorus)},
+};
+
+static void*  instances[FX_KIND_COUNT];        // Stereo instance of every kind
+static void*  voice_instances[FX_KIND_COUNT];  // Mono instances, one per voice, voice_strides[] apart
+static size_t voice_strides[FX_KIND_COUNT];
+static int    voice_count   = 0;
+static float* master_buffer = NULL;
+static float* bus_buffers[2];
+
+bool fx_chain_init(float* master, int voices, int max_frames) {
+    master_buffer  = master;
+    voice_count    = voices;
+    bus_buffers[0] = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * max_frames * 2, "fx bus A");
+    bus_buffers[1] = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * max_frames * 2, "fx bus B");
+    if (bus_buffers[0] == NULL || bus_buffers[1] == NULL) return false;
+
+    for (int kind = FX_NONE + 1; kind < FX_KIND_COUNT; kind++) {
+        const fx_kind_info_t* info = &kinds[kind];
+        instances[kind]            = dsp_arena_alloc(DSP_ARENA_FAST, info->size, info->name);
+        if (instances[kind] == NULL) return false;
+        info->init(instances[kind]);
+
+        if (info->voice_size == 0) continue;
+        voice_strides[kind]   = (info->voice_size + DSP_ARENA_ALIGN - 1) & ~(size_t)(DSP_ARENA_ALIGN - 1);
+        voice_instances[kind] = dsp_arena_alloc(DSP_ARENA_FAST, voice_strides[kind] * voices, "fx voice inserts");
+        if (voice_instances[kind] == NULL) return false;
+        for (int voice = 0; voice < voices; voice++) {
+            info->init_voice((char*)voice_instances[kind] + voice * voice_strides[kind]);
+        }
+    }
+    return true;
+}
+
+void fx_patch_default(fx_patch_t* patch) {
+    memset(patch, 0, sizeof(*patch));
+    patch->chain[FX_CHAIN_MASTER][0] = FX_DRIVE;
+    patch->chain[FX_CHAIN_MASTER][1] = FX_CHORUS;
+    patch->ret[0]                    = 1.0f;
+    patch->ret[1]                    = 1.0f;
+}
+
+bool fx_patch_valid(const fx_patch_t* patch) {
+    bool used[FX_KIND_COUNT] = {false};
+    for (int chain = 0; chain < FX_CHAIN_COUNT; chain++) {
+        bool inserted[FX_KIND_COUNT] = {false};
+        bool ended                   = false;
+        for (int i = 0; i < FX_CHAIN_LENGTH; i++) {
+            fx_kind_t kind = patch->chain[chain][i];
+            if (kind < FX_NONE || kind >= FX_KIND_COUNT) return false;
+            if (kind == FX_NONE) {
+                ended = true;
+                continue;
+            }
+            if (ended) return false;
+            if (chain == FX_CHAIN_VOICE) {
+                // Each voice has one mono instance per kind
+                if (kinds[kind].voice_size == 0 || inserted[kind]) return false;
+                inserted[kind] = true;
+            } else {
+                // One stereo instance for all three stereo chains
+                if (used[kind]) return false;
+                used[kind] = true;
+            }
+        }
+    }
+    for (int bus = 0; bus < 2; bus++) {
+        if (!(patch->send[bus] >= 0.0f && patch->send[bus] <= 1.0f)) return false;
+        if (!(patch->ret[bus] >= 0.0f && patch->ret[bus] <= 1.0f)) return false;
+    }
+    return true;
+}
+
+const char* fx_kind_name(fx_kind_t kind) {
+    if (kind < FX_NONE || kind >= FX_KIND_COUNT) return "?";
+    return kinds[kind].name;
+}
+
+fx_kind_t fx_kind_from_name(const char* name) {
+    for (int kind = FX_NONE; kind < FX_KIND_COUNT; kind++) {
+        if (strcmp(name, kinds[kind].name) == 0) return kind;
+    }
+    return FX_KIND_COUNT;
+}
+
+// Helper function: Append the steps of one stereo chain working on 'buffer'
+static void compile_chain(const fx_patch_t* patch, fx_chain_t chain, const fx_settings_t* settings, float* buffer,
+                          fx_schedule_t* schedule) {
+    for (int i = 0; i < FX_CHAIN_LENGTH && patch->chain[chain][i] != FX_NONE; i++) {
+        fx_kind_t             kind = patch->chain[chain][i];
+        const fx_kind_info_t* info = &kinds[kind];
+        schedule->steps[schedule->step_count++] = (fx_step_t){
+            .run    = info->run,
+            .state  = instances[kind],
+            .params = (const char*)settings + info->params_offset,
+            .buffer = buffer,
+        };
+        schedule->placement[kind] = chain;
+    }
+}
+
+void fx_chain_compile(const fx_patch_t* patch, const fx_settings_t* settings, const fx_schedule_t* previous,
+                      fx_schedule_t* schedule) {
+    memset(schedule, 0, sizeof(*schedule));
+    memset(schedule->placement, -1, sizeof(schedule->placement));
+
+    // Voice inserts
+    for (int i = 0; i < FX_CHAIN_LENGTH && patch->chain[FX_CHAIN_VOICE][i] != FX_NONE; i++) {
+        fx_kind_t             kind = patch->chain[FX_CHAIN_VOICE][i];
+        const fx_kind_info_t* info = &kinds[kind];
+        schedule->voice[schedule->voice_count++] = (fx_step_t){
+            .run    = info->run,
+            .state  = voice_instances[kind],
+            .stride = voice_strides[kind],
+            .params = (const char*)settings + info->params_offset,
+        };
+        schedule->inserted[kind] = true;
+    }
+
+    // Buses that cannot be heard are left out, the mixer does not even fill them
+    for (int bus = 0; bus < 2; bus++) {
+        if (patch->send[bus] == 0.0f || patch->ret[bus] == 0.0f) continue;
+        schedule->send_used[bus] = true;
+        schedule->send[bus]      = patch->send[bus];
+        compile_chain(patch, FX_CHAIN_BUS_A + bus, settings, bus_buffers[bus], schedule);
+    }
+    for (int bus = 0; bus < 2; bus++) {
+        if (!schedule->send_used[bus]) continue;
+        schedule->steps[schedule->step_count++] = (fx_step_t){
+            .run    = run_return,
+            .buffer = master_buffer,
+            .source = bus_buffers[bus],
+            .gain   = patch->ret[bus],
+        };
+    }
+    compile_chain(patch, FX_CHAIN_MASTER, settings, master_buffer, schedule);
+
+    // An instance joining a chain still holds whatever it processed elsewhere (or long ago)
+    for (int kind = FX_NONE + 1; kind < FX_KIND_COUNT; kind++) {
+        const fx_kind_info_t* info  = &kinds[kind];
+        const bool            first = previous == NULL;
+        if (schedule->placement[kind] >= 0 && (first || previous->placement[kind] != schedule->placement[kind])) {
+            schedule->resets[schedule->reset_count++] =
+                (fx_reset_t){.init = info->init, .state = instances[kind], .count = 1};
+        }
+        if (schedule->inserted[kind] && (first || !previous->inserted[kind])) {
+            schedule->resets[schedule->reset_count++] = (fx_reset_t){.init   = info->init_voice,
+                                                                     .state  = voice_instances[kind],
+                                                                     .stride = voice_strides[kind],
+                                                                     .count  = voice_count};
+        }
+    }
+}
+
+void fx_chain_prepare(const fx_schedule_t* schedule) {
+    for (int i = 0; i < schedule->reset_count; i++) {
+        const fx_reset_t* reset = &schedule->resets[i];
+        for (int instance = 0; instance < reset->count; instance++) {
+            reset->init((char*)reset->state + instance * reset->stride);
+        }
+    }
+}
+
+float* fx_chain_bus(int bus) {
+    return bus_buffers[bus];
+}
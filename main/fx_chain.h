@@ -0,0 +1,135 @@
+// Effects graph: voice inserts, two send buses and the master chain
+//
+//   voice -> [voice chain] -+---------------------------------------------+
+//                           +-> send A -> [bus A chain] -> return A ------+-> [master chain] -> output
+//                           +-> send B -> [bus B chain] -> return B ------+
+//
+// A patch lists the effects of every chain in processing order. When the
+// patch changes, fx_chain_compile() resolves it once into a schedule: flat
+// arrays of steps, each a block function with its state, settings and
+// buffer already bound. Rendering a block then only walks those arrays;
+// nothing looks at the patch, and buses that cannot be heard (send or
+// return at zero) have no steps at all.
+//
+// Every effect kind has one stereo instance, so it can sit in one of the bus
+// and master chains at a time. Kinds that can be voice inserts also have one
+// mono instance per voice. All instances of a kind share its settings.
+
+#ifndef FX_CHAIN_H
+#define FX_CHAIN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "chorus.h"
+#include "waveshaper.h"
+
+#define FX_CHAIN_LENGTH 4                          // Effects per chain
+#define FX_MAX_STEPS    (FX_CHAIN_LENGTH * 3 + 2)  // Bus and master effects plus the two returns
+
+typedef enum {
+    FX_NONE = 0,  // Ends a chain
+    FX_DRIVE,     // Oversampled waveshaper, also as a voice insert
+    FX_CHORUS,    // Chorus/flanger
+    FX_KIND_COUNT
+} fx_kind_t;
+
+typedef enum {
+    FX_CHAIN_VOICE = 0,  // Inserts on every voice, mono
+    FX_CHAIN_BUS_A,
+    FX_CHAIN_BUS_B,
+    FX_CHAIN_MASTER,
+    FX_CHAIN_COUNT
+} fx_chain_t;
+
+typedef struct {
+    fx_kind_t chain[FX_CHAIN_COUNT][FX_CHAIN_LENGTH];  // Effects in processing order, FX_NONE after the last
+    float     send[2];                                 // Level of every voice into bus A and B (0 .. 1)
+    float     ret[2];                                  // Level of bus A and B into the master chain (0 .. 1)
+} fx_patch_t;
+
+// Settings of every effect kind, shared by all its instances
+typedef struct {
+    waveshaper_params_t drive;
+    chorus_params_t     chorus;
+} fx_settings_t;
+
+typedef struct fx_step fx_step_t;
+
+// Process 'frames' frames of 'buffer' in place with the step's effect and the given instance
+typedef void (*fx_block_fn)(const fx_step_t* step, void* state, float* buffer, int frames);
+
+struct fx_step {
+    fx_block_fn  run;
+    void*        state;   // Instance; for voice steps the one of voice 0, voice v at state + v * stride
+    size_t       stride;
+    const void*  params;  // The kind's member of the settings passed to fx_chain_compile()
+    float*       buffer;  // Stereo buffer the step works on (NULL for voice steps)
+    const float* source;  // Bus mixed into 'buffer' by a return step
+    float        gain;    // Return level
+};
+
+// Instance to clear before the schedule's first block, because its effect moved or was inserted
+typedef struct {
+    void (*init)(void* state);  // Sets up one instance: the kind's stereo or voice init
+    void*  state;
+    size_t stride;
+    int    count;  // Instances from 'state' on
+} fx_reset_t;
+
+// A compiled patch; steps in the order they run
+typedef struct {
+    fx_step_t  voice[FX_CHAIN_LENGTH];  // On every sounding voice's mono buffer
+    int        voice_count;
+    fx_step_t  steps[FX_MAX_STEPS];     // Bus chains, returns and master chain on the stereo buffers
+    int        step_count;
+    bool       send_used[2];            // Voices feed bus A / B
+    float      send[2];
+    fx_reset_t resets[FX_KIND_COUNT * 2];
+    int        reset_count;
+    int8_t     placement[FX_KIND_COUNT];  // Chain of the stereo instance, -1 if unused
+    bool       inserted[FX_KIND_COUNT];   // Voice instances in use
+} fx_schedule_t;
+
+// Allocate every instance and both bus buffers from the fast DSP arena
+// 'master' is the stereo mix buffer the master chain works on and the returns mix into
+bool fx_chain_init(float* master, int voices, int max_frames);
+
+// The patch matching a plain master chain: drive, then chorus, no sends
+void fx_patch_default(fx_patch_t* patch);
+
+// Check kinds, order (nothing after FX_NONE), one use of each stereo instance, voice inserts and levels
+bool fx_patch_valid(const fx_patch_t* patch);
+
+// Human readable name ("none", "drive", "chorus") and back (FX_KIND_COUNT if unknown)
+const char* fx_kind_name(fx_kind_t kind);
+fx_kind_t   fx_kind_from_name(const char* name);
+
+// Resolve a valid patch into 'schedule', steps reading their settings from 'settings'
+// Effects not in the same place in 'previous' (NULL at startup) get cleared before they run
+void fx_chain_compile(const fx_patch_t* patch, const fx_settings_t* settings, const fx_schedule_t* previous,
+                      fx_schedule_t* schedule);
+
+// Clear the instances a schedule asks for, once before its first block (audio task)
+void fx_chain_prepare(const fx_schedule_t* schedule);
+
+// Stereo buffer of bus 0 (A) or 1 (B), written by the mixer when the schedule uses the send
+float* fx_chain_bus(int bus);
+
+// Run the voice chain on one voice's mono buffer
+static inline void fx_chain_run_voice(const fx_schedule_t* schedule, int voice, float* buffer, int frames) {
+    for (int i = 0; i < schedule->voice_count; i++) {
+        const fx_step_t* step = &schedule->voice[i];
+        step->run(step, (char*)step->state + voice * step->stride, buffer, frames);
+    }
+}
+
+// Run the bus chains, returns and master chain once the voices are mixed
+static inline void fx_chain_run(const fx_schedule_t* schedule, int frames) {
+    for (int i = 0; i < schedule->step_count; i++) {
+        const fx_step_t* step = &schedule->steps[i];
+        step->run(step, step->state, step->buffer, frames);
+    }
+}
+
+#endif  // FX_CHAIN_H
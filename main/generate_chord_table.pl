@@ -0,0 +1,102 @@
+#!/usr/bin/env perl
+use strict;
+use warnings;
+
+# Chord lookup table generator for musical keyboard
+# Builds a 4096 entry table indexed by a 12-bit pitch class set (bit 0 = C,
+# bit 11 = B). Each entry holds the root pitch class in the high nibble and
+# the chord quality in the low nibble, or 0xFF if the set is not a chord.
+# Output: C header file with the table and the quality suffixes
+
+# Chord qualities in order of preference: when one pitch class set matches
+# several chords (C6 = Am7, Csus4 = Fsus2) the first match in this list wins
+my @QUALITIES = (
+    ["",     [0, 4, 7]],
+    ["m",    [0, 3, 7]],
+    ["dim",  [0, 3, 6]],
+    ["aug",  [0, 4, 8]],
+    ["sus4", [0, 5, 7]],
+    ["sus2", [0, 2, 7]],
+    ["7",    [0, 4, 7, 10]],
+    ["maj7", [0, 4, 7, 11]],
+    ["m7",   [0, 3, 7, 10]],
+    ["m7b5", [0, 3, 6, 10]],
+    ["dim7", [0, 3, 6, 9]],
+    ["6",    [0, 4, 7, 9]],
+    ["m6",   [0, 3, 7, 9]],
+    ["add9", [0, 2, 4, 7]],
+    ["5",    [0, 7]],
+);
+
+my $NO_CHORD = 0xFF;
+
+die "Too many qualities for a nibble\n" if @QUALITIES > 15;
+
+# Pitch class set of each quality with the root on C
+my @templates;
+foreach my $quality (@QUALITIES) {
+    my $mask = 0;
+    $mask |= 1 << $_ foreach @{$quality->[1]};
+    push @templates, $mask;
+}
+
+# Rotate a 12-bit pitch class set down by 'root' semitones
+sub rotate {
+    my ($mask, $root) = @_;
+    return (($mask >> $root) | ($mask << (12 - $root))) & 0xFFF;
+}
+
+my @table;
+my $found = 0;
+for (my $mask = 0; $mask < 4096; $mask++) {
+    my $entry = $NO_CHORD;
+    QUALITY: for (my $q = 0; $q < @templates; $q++) {
+        for (my $root = 0; $root < 12; $root++) {
+            next unless $mask & (1 << $root);
+            if (rotate($mask, $root) == $templates[$q]) {
+                $entry = ($root << 4) | $q;
+                last QUALITY;
+            }
+        }
+    }
+    $found++ if $entry != $NO_CHORD;
+    push @table, $entry;
+}
+
+print STDERR "Generating chord table:\n";
+print STDERR "  Qualities: " . scalar(@QUALITIES) . "\n";
+print STDERR "  Recognised pitch class sets: $found of 4096\n";
+
+# Output C header file
+print "// Auto-generated chord lookup table for musical keyboard\n";
+print "// Index: 12-bit pitch class set (bit 0 = C ... bit 11 = B)\n";
+print "// Entry: root pitch class << 4 | quality, or CHORD_NONE\n";
+print "// Recognised pitch class sets: $found of 4096\n";
+print "//\n";
+print "// Generated by generate_chord_table.pl\n";
+print "\n";
+print "#ifndef CHORD_TABLE_H\n";
+print "#define CHORD_TABLE_H\n";
+print "\n";
+print "#include <stdint.h>\n";
+print "\n";
+printf "#define CHORD_NONE 0x%02X\n", $NO_CHORD;
+print "\n";
+print "// Chord quality suffixes, indexed by the low nibble of a table entry\n";
+print "static const char* const chord_quality_names[" . scalar(@QUALITIES) . "] = {\n";
+print join(",\n", map { "    \"$_->[0]\"" } @QUALITIES) . "\n";
+print "};\n";
+print "\n";
+print "static const uint8_t chord_table[4096] = {\n";
+
+# Output entries, 16 per line
+for (my $i = 0; $i < @table; $i += 16) {
+    print "    ";
+    print join(", ", map { sprintf("0x%02X", $_) } @table[$i .. $i + 15]);
+    print "," if ($i + 16 < @table);
+    print "\n";
+}
+
+print "};\n";
+print "\n";
+print "#endif // CHORD_TABLE_H\n";
@@ -0,0 +1,141 @@
+#!/usr/bin/env perl
+use strict;
+use warnings;
+use Math::Trig;
+
+# Half-band filter coefficient generator for musical keyboard
+# Designs a Kaiser windowed sinc half-band lowpass for 2x oversampling at
+# 44100 Hz (88200 Hz inside the filter). Every second coefficient of a
+# half-band filter is zero apart from the centre one (0.5), so only the taps
+# of the other polyphase branch are written out. The measured passband ripple
+# and stopband attenuation are reported on STDERR.
+# Output: C header file with the coefficient table
+
+my $BASE_RATE = 44100;           # Hz, rate outside the oversampled section
+my $TAPS = 24;                   # Non-zero taps besides the centre (filter length 2 * TAPS - 1)
+my $PASSBAND_EDGE = 18000;       # Hz, must stay flat
+my $STOPBAND_EDGE = $BASE_RATE - $PASSBAND_EDGE;  # Hz, half-band filters are symmetric around rate / 4
+my $KAISER_BETA = 6.6;           # Window shape (higher = more attenuation, wider transition)
+
+die "TAPS must be even\n" if $TAPS % 2;
+
+my $length = 2 * $TAPS - 1;
+my $center = $TAPS - 1;
+my $rate = 2 * $BASE_RATE;
+
+print STDERR "Generating half-band filter:\n";
+print STDERR "  Oversampled rate: $rate Hz\n";
+print STDERR "  Length: $length ($TAPS taps plus the centre)\n";
+print STDERR "  Passband: 0 - $PASSBAND_EDGE Hz, stopband from $STOPBAND_EDGE Hz\n";
+print STDERR "  Kaiser beta: $KAISER_BETA\n";
+
+# Zeroth order modified Bessel function of the first kind (series expansion)
+sub bessel_i0 {
+    my ($x) = @_;
+    my $sum = 1.0;
+    my $term = 1.0;
+    for (my $k = 1; $k < 50; $k++) {
+        $term *= ($x / (2 * $k)) ** 2;
+        $sum += $term;
+        last if $term < 1e-12 * $sum;
+    }
+    return $sum;
+}
+
+# Windowed sinc with its cutoff at a quarter of the rate; sin(pi t / 2) is exactly
+# zero at even t, so those taps are set to zero instead of rounding noise
+my @filter;
+my $i0_beta = bessel_i0($KAISER_BETA);
+for (my $n = 0; $n < $length; $n++) {
+    my $t = $n - $center;
+    my $ratio = 2 * $n / ($length - 1) - 1;
+    my $window = bessel_i0($KAISER_BETA * sqrt(1 - $ratio * $ratio)) / $i0_beta;
+    if ($t == 0) {
+        push @filter, 0.5;
+    } elsif ($t % 2 == 0) {
+        push @filter, 0.0;
+    } else {
+        push @filter, sin(pi * $t / 2) / (pi * $t) * $window;
+    }
+}
+
+# Normalise the DC gain of the branch to exactly 0.5, so both branches match
+my $branch_sum = 0;
+for (my $n = 0; $n < $length; $n += 2) {
+    $branch_sum += $filter[$n];
+}
+for (my $n = 0; $n < $length; $n += 2) {
+    $filter[$n] *= 0.5 / $branch_sum;
+}
+
+# Magnitude response at a frequency in Hz
+sub magnitude {
+    my ($freq) = @_;
+    my $w = 2 * pi * $freq / $rate;
+    my ($re, $im) = (0, 0);
+    for (my $n = 0; $n < $length; $n++) {
+        $re += $filter[$n] * cos($w * $n);
+        $im -= $filter[$n] * sin($w * $n);
+    }
+    return sqrt($re * $re + $im * $im);
+}
+
+sub db {
+    my ($value) = @_;
+    return 20 * log($value > 1e-12 ? $value : 1e-12) / log(10);
+}
+
+# Passband ripple
+my ($pass_min, $pass_max) = (1e9, -1e9);
+for (my $i = 0; $i <= 200; $i++) {
+    my $mag = db(magnitude($PASSBAND_EDGE * $i / 200));
+    $pass_min = $mag if $mag < $pass_min;
+    $pass_max = $mag if $mag > $pass_max;
+}
+
+# Worst stopband level up to the oversampled Nyquist frequency
+my $stop_max = -1e9;
+my $points = 2000;
+for (my $i = 0; $i <= $points; $i++) {
+    my $freq = $STOPBAND_EDGE + ($rate / 2 - $STOPBAND_EDGE) * $i / $points;
+    my $mag = db(magnitude($freq));
+    $stop_max = $mag if $mag > $stop_max;
+}
+
+printf STDERR "  Passband ripple: %.4f dB (%.4f to %.4f dB)\n", $pass_max - $pass_min, $pass_min, $pass_max;
+printf STDERR "  Stopband attenuation: %.1f dB\n", -$stop_max;
+
+# Output C header file
+print "// Auto-generated half-band filter coefficients for musical keyboard\n";
+print "// 2x oversampling at $BASE_RATE Hz, length $length, Kaiser beta: $KAISER_BETA\n";
+printf "// Passband ripple (0 - %d Hz): %.4f dB\n", $PASSBAND_EDGE, $pass_max - $pass_min;
+printf "// Stopband attenuation (from %d Hz): %.1f dB\n", $STOPBAND_EDGE, -$stop_max;
+print "//\n";
+print "// Generated by generate_halfband.pl\n";
+print "\n";
+print "#ifndef HALFBAND_COEFFS_H\n";
+print "#define HALFBAND_COEFFS_H\n";
+print "\n";
+print "#define HALFBAND_TAPS    $TAPS\n";
+printf "#define HALFBAND_LATENCY %d  // Frames at the base rate through interpolator and decimator\n", $center;
+print "\n";
+print "// The branch without the centre tap (every second coefficient, the others are\n";
+print "// zero), symmetric, so the order of the taps does not matter\n";
+print "static const float halfband_coeffs[$TAPS] = {";
+
+my @taps;
+for (my $n = 0; $n < $length; $n += 2) {
+    push @taps, sprintf("%.9e", $filter[$n]);
+}
+for (my $i = 0; $i < @taps; $i += 4) {
+    print "\n    " . join(", ", @taps[$i .. min($i + 3, $#taps)]);
+    print "," if ($i + 4 < @taps);
+}
+print "\n};\n";
+print "\n";
+print "#endif // HALFBAND_COEFFS_H\n";
+
+sub min {
+    my ($a, $b) = @_;
+    return $a < $b ? $a : $b;
+}
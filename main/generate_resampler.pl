@@ -0,0 +1,140 @@
+#!/usr/bin/env perl
+use strict;
+use warnings;
+use Math::Trig;
+
+# Polyphase resampler coefficient generator for musical keyboard
+# Designs a Kaiser windowed sinc lowpass for 44100 Hz -> 48000 Hz conversion
+# (interpolate by 160, decimate by 147) and splits it into 160 polyphase
+# branches. The measured passband ripple and stopband attenuation are
+# reported on STDERR.
+# Output: C header file with the coefficient table
+
+my $INPUT_RATE = 44100;          # Hz
+my $OUTPUT_RATE = 48000;         # Hz
+my $UP = 160;                    # Interpolation factor (L)
+my $DOWN = 147;                  # Decimation factor (M)
+my $TAPS = 48;                   # Taps per polyphase branch
+my $PASSBAND_EDGE = 20000;       # Hz, must stay flat
+my $STOPBAND_EDGE = $INPUT_RATE - $PASSBAND_EDGE;  # Hz, first image of the passband edge
+my $KAISER_BETA = 7.0;           # Window shape (higher = more attenuation, wider transition)
+
+die "Ratio mismatch\n" unless $INPUT_RATE * $UP == $OUTPUT_RATE * $DOWN;
+
+my $length = $UP * $TAPS;
+my $upsampled_rate = $INPUT_RATE * $UP;
+my $cutoff = (($PASSBAND_EDGE + $STOPBAND_EDGE) / 2) / $upsampled_rate;  # Cycles per sample
+
+print STDERR "Generating polyphase resampler:\n";
+print STDERR "  Ratio: $INPUT_RATE Hz -> $OUTPUT_RATE Hz ($UP:$DOWN)\n";
+print STDERR "  Taps per phase: $TAPS ($length total)\n";
+print STDERR "  Passband: 0 - $PASSBAND_EDGE Hz, stopband from $STOPBAND_EDGE Hz\n";
+print STDERR "  Kaiser beta: $KAISER_BETA\n";
+
+# Zeroth order modified Bessel function of the first kind (series expansion)
+sub bessel_i0 {
+    my ($x) = @_;
+    my $sum = 1.0;
+    my $term = 1.0;
+    for (my $k = 1; $k < 50; $k++) {
+        $term *= ($x / (2 * $k)) ** 2;
+        $sum += $term;
+        last if $term < 1e-12 * $sum;
+    }
+    return $sum;
+}
+
+# Windowed sinc prototype, scaled by the interpolation factor for unity passband gain
+my @prototype;
+my $center = ($length - 1) / 2;
+my $i0_beta = bessel_i0($KAISER_BETA);
+for (my $n = 0; $n < $length; $n++) {
+    my $t = $n - $center;
+    my $sinc = ($t == 0) ? 2 * $cutoff : sin(2 * pi * $cutoff * $t) / (pi * $t);
+    my $ratio = 2 * $n / ($length - 1) - 1;
+    my $window = bessel_i0($KAISER_BETA * sqrt(1 - $ratio * $ratio)) / $i0_beta;
+    push @prototype, $sinc * $window * $UP;
+}
+
+# Magnitude response of the prototype at a frequency in Hz (relative to the upsampled rate)
+sub magnitude {
+    my ($freq) = @_;
+    my $w = 2 * pi * $freq / $upsampled_rate;
+    my ($re, $im) = (0, 0);
+    for (my $n = 0; $n < $length; $n++) {
+        $re += $prototype[$n] * cos($w * $n);
+        $im -= $prototype[$n] * sin($w * $n);
+    }
+    return sqrt($re * $re + $im * $im) / $UP;
+}
+
+sub db {
+    my ($value) = @_;
+    return 20 * log($value > 1e-12 ? $value : 1e-12) / log(10);
+}
+
+# Passband ripple
+my ($pass_min, $pass_max) = (1e9, -1e9);
+for (my $i = 0; $i <= 200; $i++) {
+    my $mag = db(magnitude($PASSBAND_EDGE * $i / 200));
+    $pass_min = $mag if $mag < $pass_min;
+    $pass_max = $mag if $mag > $pass_max;
+}
+
+# Worst stopband level up to the upsampled Nyquist frequency
+my $stop_max = -1e9;
+my $points = 2000;
+for (my $i = 0; $i <= $points; $i++) {
+    my $freq = $STOPBAND_EDGE + ($upsampled_rate / 2 - $STOPBAND_EDGE) * $i / $points;
+    my $mag = db(magnitude($freq));
+    $stop_max = $mag if $mag > $stop_max;
+}
+
+printf STDERR "  Passband ripple: %.4f dB (%.4f to %.4f dB)\n", $pass_max - $pass_min, $pass_min, $pass_max;
+printf STDERR "  Stopband attenuation: %.1f dB\n", -$stop_max;
+
+# Output C header file
+print "// Auto-generated polyphase resampler coefficients for musical keyboard\n";
+print "// Ratio: $INPUT_RATE Hz -> $OUTPUT_RATE Hz (interpolate by $UP, decimate by $DOWN)\n";
+print "// Taps per phase: $TAPS, Kaiser beta: $KAISER_BETA\n";
+printf "// Passband ripple (0 - %d Hz): %.4f dB\n", $PASSBAND_EDGE, $pass_max - $pass_min;
+printf "// Stopband attenuation (from %d Hz): %.1f dB\n", $STOPBAND_EDGE, -$stop_max;
+print "//\n";
+print "// Generated by generate_resampler.pl\n";
+print "\n";
+print "#ifndef RESAMPLER_COEFFS_H\n";
+print "#define RESAMPLER_COEFFS_H\n";
+print "\n";
+print "#define RESAMPLER_INPUT_RATE  $INPUT_RATE\n";
+print "#define RESAMPLER_OUTPUT_RATE $OUTPUT_RATE\n";
+print "#define RESAMPLER_UP          $UP\n";
+print "#define RESAMPLER_DOWN        $DOWN\n";
+print "#define RESAMPLER_TAPS        $TAPS\n";
+print "\n";
+print "// One row per phase, taps stored oldest input first so each output is a\n";
+print "// contiguous dot product over the input history\n";
+print "static const float resampler_coeffs[$UP][$TAPS] = {\n";
+
+for (my $phase = 0; $phase < $UP; $phase++) {
+    my @row;
+    for (my $tap = $TAPS - 1; $tap >= 0; $tap--) {
+        push @row, sprintf("%.9e", $prototype[$phase + $tap * $UP]);
+    }
+    print "    {";
+    for (my $i = 0; $i < @row; $i += 4) {
+        print "\n        " . join(", ", @row[$i .. min($i + 3, $#row)]);
+        print "," if ($i + 4 < @row);
+    }
+    print "\n    }";
+    print "," if ($phase + 1 < $UP);
+    print "\n";
+}
+
+print "};\n";
+print "\n";
+print "#endif // RESAMPLER_COEFFS_H\n";
+
+sub min {
+    my ($a, $b) = @_;
+    return $a < $b ? $a : $b;
+}
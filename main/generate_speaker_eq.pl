@@ -0,0 +1,141 @@
+#!/usr/bin/env perl
+use strict;
+use warnings;
+use Math::Trig;
+
+# Speaker compensation filter generator for musical keyboard
+# Designs the biquads of the speaker EQ and of the bass enhancer with the
+# RBJ audio EQ cookbook formulas, once for every output rate, and writes them
+# in fixed point. The EQ response of the cascade at a few frequencies is
+# reported on STDERR.
+# Output: C header file with the coefficient tables
+
+my @RATES = (44100, 48000);      # Hz, every rate the I2S output runs at
+my $COEFF_SHIFT = 29;            # Fractional bits of the coefficients (range +/-4)
+
+# Compensation for a small full-range speaker: no output below ~200 Hz, a dip
+# in the low mids and a peak in the presence region. Starting values, not a
+# measurement of the Tanmatsu's speaker.
+my @EQ = (
+    ["highpass",  200,  0.707, 0],   # Keep out what the speaker cannot play anyway
+    ["peaking",   500,  1.0,   4],   # Lift the lowest band it still plays
+    ["peaking",  3000,  1.4,  -3],   # Tame the presence peak
+    ["highshelf", 8000, 0.707, 2],   # Air
+);
+
+# Bass enhancer: the band with the lowest fundamentals feeds the harmonic
+# generator, whose output is band limited to where the speaker plays well
+my $SPLIT = ["lowpass", 400, 0.707, 0];
+my $HARMONICS_HIGHPASS = ["highpass", 450, 0.707, 0];
+my $HARMONICS_LOWPASS = ["lowpass", 2000, 0.707, 0];
+
+# Normalised coefficients (b0, b1, b2, a1, a2), a0 = 1
+sub biquad {
+    my ($rate, $type, $freq, $q, $gain_db) = @_;
+    my $w0 = 2 * pi * $freq / $rate;
+    my $cos = cos($w0);
+    my $alpha = sin($w0) / (2 * $q);
+    my $a = 10 ** ($gain_db / 40);
+    my ($b0, $b1, $b2, $a0, $a1, $a2);
+    if ($type eq "lowpass") {
+        ($b0, $b1, $b2) = ((1 - $cos) / 2, 1 - $cos, (1 - $cos) / 2);
+        ($a0, $a1, $a2) = (1 + $alpha, -2 * $cos, 1 - $alpha);
+    } elsif ($type eq "highpass") {
+        ($b0, $b1, $b2) = ((1 + $cos) / 2, -(1 + $cos), (1 + $cos) / 2);
+        ($a0, $a1, $a2) = (1 + $alpha, -2 * $cos, 1 - $alpha);
+    } elsif ($type eq "peaking") {
+        ($b0, $b1, $b2) = (1 + $alpha * $a, -2 * $cos, 1 - $alpha * $a);
+        ($a0, $a1, $a2) = (1 + $alpha / $a, -2 * $cos, 1 - $alpha / $a);
+    } elsif ($type eq "highshelf") {
+        my $root = 2 * sqrt($a) * $alpha;
+        $b0 = $a * (($a + 1) + ($a - 1) * $cos + $root);
+        $b1 = -2 * $a * (($a - 1) + ($a + 1) * $cos);
+        $b2 = $a * (($a + 1) + ($a - 1) * $cos - $root);
+        $a0 = ($a + 1) - ($a - 1) * $cos + $root;
+        $a1 = 2 * (($a - 1) - ($a + 1) * $cos);
+        $a2 = ($a + 1) - ($a - 1) * $cos - $root;
+    } else {
+        die "Unknown filter type $type\n";
+    }
+    return map { $_ / $a0 } ($b0, $b1, $b2, $a1, $a2);
+}
+
+# Magnitude of one biquad at a frequency in Hz
+sub magnitude {
+    my ($rate, $freq, @c) = @_;
+    my $w = 2 * pi * $freq / $rate;
+    my ($nr, $ni) = ($c[0] + $c[1] * cos($w) + $c[2] * cos(2 * $w), -$c[1] * sin($w) - $c[2] * sin(2 * $w));
+    my ($dr, $di) = (1 + $c[3] * cos($w) + $c[4] * cos(2 * $w), -$c[3] * sin($w) - $c[4] * sin(2 * $w));
+    return sqrt(($nr * $nr + $ni * $ni) / ($dr * $dr + $di * $di));
+}
+
+sub fixed {
+    my ($value) = @_;
+    my $scaled = $value * (1 << $COEFF_SHIFT);
+    die "Coefficient $value out of range\n" if abs($scaled) >= 2 ** 31;
+    return sprintf("%d", $scaled < 0 ? $scaled - 0.5 : $scaled + 0.5);
+}
+
+my @filters = (@EQ, $SPLIT, $HARMONICS_HIGHPASS, $HARMONICS_LOWPASS);
+
+print STDERR "Generating speaker EQ:\n";
+for my $filter (@filters) {
+    printf STDERR "  %-9s %5d Hz, Q %.3f, %+d dB\n", @$filter;
+}
+
+my @tables;
+for my $rate (@RATES) {
+    my @rows;
+    my @eq_coeffs;
+    for my $filter (@filters) {
+        my @c = biquad($rate, @$filter);
+        push @eq_coeffs, [@c] if @eq_coeffs < @EQ;
+        push @rows, "{" . join(", ", map { fixed($_) } @c) . "}";
+    }
+    push @tables, [$rate, @rows];
+
+    print STDERR "  EQ response at $rate Hz:";
+    for my $freq (100, 261, 500, 1000, 3000, 8000, 16000) {
+        my $gain = 1;
+        $gain *= magnitude($rate, $freq, @$_) for @eq_coeffs;
+        printf STDERR " %d Hz %+.1f dB,", $freq, 20 * log($gain) / log(10);
+    }
+    print STDERR "\n";
+}
+
+# Output C header file
+print "// Auto-generated speaker EQ and bass enhancer filters for musical keyboard\n";
+print "// RBJ cookbook biquads, (b0, b1, b2, a1, a2) with a0 = 1, in Q$COEFF_SHIFT fixed point\n";
+for my $filter (@filters) {
+    printf "// %-9s %5d Hz, Q %.3f, %+d dB\n", @$filter;
+}
+print "//\n";
+print "// Generated by generate_speaker_eq.pl\n";
+print "\n";
+print "#ifndef SPEAKER_EQ_COEFFS_H\n";
+print "#define SPEAKER_EQ_COEFFS_H\n";
+print "\n";
+print "#include <stdint.h>\n";
+print "\n";
+printf "#define SPEAKER_EQ_RATES        %d\n", scalar(@RATES);
+printf "#define SPEAKER_EQ_SECTIONS     %d  // Filters 0 .. SECTIONS - 1 are the EQ cascade\n", scalar(@EQ);
+printf "#define SPEAKER_EQ_SPLIT        %d  // Bass enhancer: low band lowpass\n", scalar(@EQ);
+printf "#define SPEAKER_EQ_HARM_HP      %d  // ... harmonics highpass\n", scalar(@EQ) + 1;
+printf "#define SPEAKER_EQ_HARM_LP      %d  // ... harmonics lowpass\n", scalar(@EQ) + 2;
+printf "#define SPEAKER_EQ_FILTERS      %d\n", scalar(@filters);
+print "#define SPEAKER_EQ_COEFF_SHIFT  $COEFF_SHIFT\n";
+print "\n";
+print "static const uint32_t speaker_eq_rates[SPEAKER_EQ_RATES] = {" . join(", ", @RATES) . "};\n";
+print "\n";
+print "static const int32_t speaker_eq_coeffs[SPEAKER_EQ_RATES][SPEAKER_EQ_FILTERS][5] = {\n";
+for my $table (@tables) {
+    my ($rate, @rows) = @$table;
+    print "    {   // $rate Hz\n";
+    for (my $i = 0; $i < @rows; $i++) {
+        print "        $rows[$i]" . ($i + 1 < @rows ? ",\n" : "\n");
+    }
+    print "    }" . ($table == $tables[-1] ? "\n" : ",\n");
+}
+print "};\n";
+print "\n";
+print "#endif // SPEAKER_EQ_COEFFS_H\n";
@@ -0,0 +1,350 @@
+// Granular voice engine: windowed grains sprayed from a source recording
+//
+// A grain reads the int16 source with linear interpolation at its own speed
+// and multiplies it with its window, read from the table with linear
+// interpolation too. Grains of one voice are a singly linked list through the
+// pool blocks; a grain that started inside the block waits 'delay' frames.
+//
+// The level of a grain is 1 / sqrt(overlap), overlap being the number of
+// grains a voice has sounding on average (density times length, at most the
+// pool), so thin and dense clouds play about as loud: grains at random
+// positions add up in power.
+
+#include "granular.h"
+#include <math.h>
+#include <string.h>
+#include "dsp_arena.h"
+#include "dsp_math.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "synth.h"
+
+_Static_assert(GRANULAR_SOURCE_FRAMES == GRANULAR_SOURCE_SECONDS * SAMPLE_RATE, "The source runs at SAMPLE_RATE");
+
+#define SOURCE_ROOT_HZ 261.63f                        // C1, the pitch a grain read at speed 1 plays
+#define SOURCE_LEVEL   0.5f                           // Peak of the built-in source, as the built-in waveform
+#define DECAY_ATTACK   (GRANULAR_WINDOW_LENGTH / 32)  // Attack of the decay window, in table segments
+#define DECAY_RATE     5.0f                           // Decay window: exp(-DECAY_RATE) at the end, about -43 dB
+#define PHASE_SHIFT    22                             // Fractional bits of the window phase, the table end is 2^31
+
+typedef struct grain {
+    struct grain* next;        // Next grain of the same voice
+    const float*  window;      // Window table
+    uint32_t      index;       // Source sample at or before the read position
+    float         fraction;    // ... and how far beyond it (0.0 .. 1.0)
+    float         speed;       // Source samples per frame
+    uint32_t      phase;       // Position in the window table, PHASE_SHIFT fractional bits
+    uint32_t      phase_step;  // ... per frame, rounded down so the last frame stays inside the table
+    float         gain;        // Level, with the int16 source scaled to +/-1
+    int           delay;       // Frames into the next block before the grain starts
+    int           remaining;   // Frames left to play
+} grain_t;
+
+typedef struct {
+    grain_t* grains;     // Sounding grains, newest first
+    float    countdown;  // Frames until the next onset
+    bool     active;     // Rendered in the last block
+} granular_voice_t;
+
+static float windows[GRANULAR_WINDOW_COUNT][GRANULAR_WINDOW_LENGTH + 1];
+
+static int16_t*          source = NULL;  // In PSRAM, GRANULAR_SOURCE_FRAMES + 1 samples, the last repeats the first
+static dsp_pool_t        grain_pool;
+static granular_voice_t* voices = NULL;
+static uint32_t          rng    = 1;  // xorshift32 state (audio task)
+static granular_stats_t  stats;
+
+// Capture of the mix into the source, requested by the console and run by the audio task
+static volatile bool capture_request  = false;
+static int           capture_position = -1;  // Next frame to record, -1 when not capturing
+
+static const char* const window_names[GRANULAR_WINDOW_COUNT] = {
+    [GRANULAR_WINDOW_HANN]  = "hann",
+    [GRANULAR_WINDOW_TUKEY] = "tukey",
+    [GRANULAR_WINDOW_DECAY] = "decay",
+};
+
+// Helper function: Next pseudo random number, 0.0 .. 1.0
+static inline float random_unit(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (x >> 8) * (1.0f / 16777216.0f);
+}
+
+// Helper function: Fill the window tables, every one rises from 0 and ends at 0
+static void init_windows(void) {
+    const float pi = 3.14159265f;
+    for (int i = 0; i <= GRANULAR_WINDOW_LENGTH; i++) {
+        float t = (float)i / GRANULAR_WINDOW_LENGTH;
+
+        windows[GRANULAR_WINDOW_HANN][i] = 0.5f - 0.5f * cosf(2.0f * pi * t);
+
+        float edge                        = fminf(t, 1.0f - t) * 4.0f;  // 0 at the ends, 1 from a quarter in
+        windows[GRANULAR_WINDOW_TUKEY][i] = edge >= 1.0f ? 1.0f : 0.5f - 0.5f * cosf(pi * edge);
+
+        // Raised cosine attack, exponential decay, and a cosine fade over the last attack length to reach 0
+        float decay;
+        if (i < DECAY_ATTACK) {
+            decay = 0.5f - 0.5f * cosf(pi * i / DECAY_ATTACK);
+        } else {
+            decay = expf(-DECAY_RATE * (i - DECAY_ATTACK) / (GRANULAR_WINDOW_LENGTH - DECAY_ATTACK));
+        }
+        if (i > GRANULAR_WINDOW_LENGTH - DECAY_ATTACK) {
+            decay *= 0.5f + 0.5f * cosf(pi * (i - (GRANULAR_WINDOW_LENGTH - DECAY_ATTACK)) / DECAY_ATTACK);
+        }
+        windows[GRANULAR_WINDOW_DECAY][i] = decay;
+    }
+}
+
+// Helper function: Sawtooth-like tone of eight harmonics at a phase in radians, sin(k x) by recurrence
+static float harmonic_tone(float x) {
+    const float twice_cos = 2.0f * cosf(x);
+    float       previous  = 0.0f;  // sin((k - 1) x)
+    float       current   = sinf(x);
+    float       tone      = 0.0f;
+    for (int harmonic = 1; harmonic <= 8; harmonic++) {
+        tone      += current / harmonic;
+        float next = twice_cos * current - previous;
+        previous   = current;
+        current    = next;
+    }
+    return tone;
+}
+
+// Helper function: Fill the source with a tone at C1 with a vibrato and a swell; tone, vibrato and swell
+// complete whole cycles over the source, so it loops seamlessly
+static void fill_source(void) {
+    const float two_pi         = 6.28318531f;
+    const float cycles         = roundf(SOURCE_ROOT_HZ * GRANULAR_SOURCE_SECONDS);  // 523, 261.5 Hz
+    const float vibrato_cycles = 11.0f;                                              // 5.5 Hz
+    const float vibrato_depth  = 0.01f;                                              // +/- 1% (17 cents)
+
+    // The vibrato only moves the phase and the swell peaks at 1, so the peak of one cycle is the peak
+    float peak = 0.0f;
+    for (int i = 0; i < 4096; i++) peak = fmaxf(peak, fabsf(harmonic_tone(two_pi * i / 4096)));
+    const float scale = SOURCE_LEVEL * 32767.0f / peak;
+
+    for (int i = 0; i < GRANULAR_SOURCE_FRAMES; i++) {
+        float t       = (float)i / GRANULAR_SOURCE_FRAMES;
+        float vibrato = vibrato_cycles * t;
+        float swing   = vibrato_depth * cycles / (two_pi * vibrato_cycles) * lfo_sine(vibrato - (int)vibrato);
+        float phase   = cycles * t + swing;
+        float swell   = 0.8f + 0.2f * lfo_sine(t < 0.75f ? t + 0.25f : t - 0.75f);  // Cosine, 1 at the loop point
+        source[i]     = (int16_t)lrintf(harmonic_tone(two_pi * (phase - (int)phase)) * swell * scale);
+    }
+    source[GRANULAR_SOURCE_FRAMES] = source[0];
+}
+
+bool granular_init(int voices_needed) {
+    init_windows();
+    source = dsp_arena_alloc(DSP_ARENA_BULK, sizeof(int16_t) * (GRANULAR_SOURCE_FRAMES + 1), "grain source");
+    voices = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(granular_voice_t) * voices_needed, "grain voices");
+    if (source == NULL || voices == NULL) return false;
+    if (!dsp_pool_init(&grain_pool, DSP_ARENA_FAST, sizeof(grain_t), GRANULAR_MAX_GRAINS, "grains")) return false;
+    fill_source();
+    return true;
+}
+
+void granular_params_default(granular_params_t* params) {
+    *params = (granular_params_t){
+        .position  = 0.25f,
+        .spray     = 0.1f,
+        .density   = 40.0f,
+        .length_ms = 80.0f,
+        .jitter    = 0.1f,
+        .window    = GRANULAR_WINDOW_HANN,
+    };
+}
+
+bool granular_params_valid(const granular_params_t* params) {
+    if (!(params->position >= 0.0f && params->position <= 1.0f)) return false;
+    if (!(params->spray >= 0.0f && params->spray <= 1.0f)) return false;
+    if (!(params->density >= 1.0f && params->density <= 1000.0f)) return false;
+    if (!(params->length_ms >= 5.0f && params->length_ms <= 500.0f)) return false;
+    if (!(params->jitter >= 0.0f && params->jitter <= 12.0f)) return false;
+    if (params->window < 0 || params->window >= GRANULAR_WINDOW_COUNT) return false;
+    return true;
+}
+
+const char* granular_window_name(granular_window_t window) {
+    if (window < 0 || window >= GRANULAR_WINDOW_COUNT) return "?";
+    return window_names[window];
+}
+
+granular_window_t granular_window_from_name(const char* name) {
+    for (int window = 0; window < GRANULAR_WINDOW_COUNT; window++) {
+        if (strcmp(name, window_names[window]) == 0) return window;
+    }
+    return GRANULAR_WINDOW_COUNT;
+}
+
+// Helper function: Set up a grain starting 'delay' frames into the block
+static void start_grain(grain_t* grain, float speed, const granular_params_t* params, int delay, uint32_t* state) {
+    const int   length  = (int)(params->length_ms * (SAMPLE_RATE / 1000.0f));
+    const float overlap = fminf(params->density * params->length_ms * 0.001f, GRANULAR_MAX_GRAINS);
+
+    // Start anywhere within +/- spray around the position, wrapped into the source
+    float start = params->position + params->spray * (2.0f * random_unit(state) - 1.0f);
+    start -= (int)start;
+    if (start < 0.0f) start += 1.0f;
+    float    frame = start * GRANULAR_SOURCE_FRAMES;
+    uint32_t index = (uint32_t)frame;
+    if (index >= GRANULAR_SOURCE_FRAMES) index = 0;
+
+    grain->window     = windows[params->window];
+    grain->index      = index;
+    grain->fraction   = frame - (float)(uint32_t)frame;
+    grain->speed      = speed * exp2_approx(params->jitter * (2.0f * random_unit(state) - 1.0f) * (1.0f / 12.0f));
+    grain->phase      = 0;
+    grain->phase_step = ((uint32_t)GRANULAR_WINDOW_LENGTH << PHASE_SHIFT) / length;
+    grain->gain       = (overlap > 1.0f ? inverse_sqrt_approx(overlap) : 1.0f) * (1.0f / 32768.0f);
+    grain->delay      = delay;
+    grain->remaining  = length;
+}
+
+// Helper function: Add one grain's frames of this block to 'buffer', the grain is done once 'remaining' is 0
+static void render_grain(grain_t* grain, float* buffer, int frames) {
+    const int16_t* data   = source;
+    const float*   window = grain->window;
+    const float    speed  = grain->speed;
+    const uint32_t step   = grain->phase_step;
+    const float    gain   = grain->gain;
+    uint32_t       index  = grain->index;
+    float          frac   = grain->fraction;
+    uint32_t       phase  = grain->phase;
+
+    const int start = grain->delay;
+    const int end   = grain->remaining < frames - start ? start + grain->remaining : frames;
+    for (int i = start; i < end; i++) {
+        uint32_t segment = phase >> PHASE_SHIFT;
+        float    between = (phase & ((1u << PHASE_SHIFT) - 1)) * (1.0f / (1u << PHASE_SHIFT));
+        float    w       = window[segment] + (window[segment + 1] - window[segment]) * between;
+        float    s0      = data[index];
+        float    s1      = data[index + 1];  // The guard sample after the end repeats the first
+        buffer[i] += gain * w * (s0 + (s1 - s0) * frac);
+
+        phase    += step;
+        frac     += speed;
+        int whole = (int)frac;
+        frac     -= whole;
+        index    += whole;
+        if (index >= GRANULAR_SOURCE_FRAMES) index -= GRANULAR_SOURCE_FRAMES;
+    }
+
+    grain->index      = index;
+    grain->fraction   = frac;
+    grain->phase      = phase;
+    grain->delay      = 0;
+    grain->remaining -= end - start;
+}
+
+void granular_voice_render(int voice_index, float speed, const granular_params_t* params, float* buffer, int frames) {
+    granular_voice_t* voice = &voices[voice_index];
+    if (!voice->active) {
+        voice->active    = true;
+        voice->countdown = 0.0f;
+    }
+
+    // Onsets due in this block, spaced 0.5 to 1.5 times the mean interval at random
+    const float interval = SAMPLE_RATE / params->density;
+    while (voice->countdown < frames) {
+        grain_t* grain = dsp_pool_get(&grain_pool);
+        if (grain != NULL) {
+            start_grain(grain, speed, params, (int)voice->countdown, &rng);
+            grain->next   = voice->grains;
+            voice->grains = grain;
+            stats.started++;
+        } else {
+            stats.dropped++;
+        }
+        voice->countdown += interval * (0.5f + random_unit(&rng));
+    }
+    voice->countdown -= frames;
+
+    memset(buffer, 0, sizeof(float) * frames);
+    grain_t** link = &voice->grains;
+    while (*link != NULL) {
+        grain_t* grain = *link;
+        render_grain(grain, buffer, frames);
+        if (grain->remaining == 0) {
+            *link = grain->next;
+            dsp_pool_put(&grain_pool, grain);
+        } else {
+            link = &grain->next;
+        }
+    }
+}
+
+void granular_voice_stop(int voice_index) {
+    granular_voice_t* voice = &voices[voice_index];
+    while (voice->grains != NULL) {
+        grain_t* grain = voice->grains;
+        voice->grains  = grain->next;
+        dsp_pool_put(&grain_pool, grain);
+    }
+    voice->active = false;
+}
+
+void granular_capture_start(void) {
+    capture_request = true;
+}
+
+void granular_capture_block(const float* mix, int frames) {
+    if (capture_request) {
+        capture_request  = false;
+        capture_position = 0;
+    }
+    if (capture_position < 0) return;
+
+    // Mono sum, saturated to int16; the guard sample follows the first one
+    int count = GRANULAR_SOURCE_FRAMES - capture_position;
+    if (count > frames) count = frames;
+    for (int i = 0; i < count; i++) {
+        float sample                 = 0.5f * (mix[i * 2] + mix[i * 2 + 1]) * 32768.0f;
+        source[capture_position + i] = (int16_t)fminf(fmaxf(sample, -32768.0f), 32767.0f);
+    }
+    if (capture_position == 0) source[GRANULAR_SOURCE_FRAMES] = source[0];
+    capture_position += count;
+    if (capture_position >= GRANULAR_SOURCE_FRAMES) capture_position = -1;
+    stats.capturing = capture_position >= 0;
+    stats.captured  = capture_position >= 0 ? capture_position : 0;
+}
+
+void granular_get_stats(granular_stats_t* out) {
+    *out        = stats;
+    out->active = grain_pool.in_use;
+    out->peak   = grain_pool.peak;
+}
+
+uint32_t granular_bench(int blocks) {
+    static float buffer[FRAMES_PER_WRITE];
+    if (source == NULL) return 0;
+
+    // Reads spread over the whole source with some pitch spread, as in a dense cloud
+    granular_params_t params;
+    granular_params_default(&params);
+    params.spray  = 1.0f;
+    params.jitter = 2.0f;
+
+    // Grains in internal RAM like the real pool, the source is the real one in PSRAM
+    grain_t* grains = heap_caps_malloc(sizeof(grain_t) * GRANULAR_MAX_GRAINS, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (grains == NULL) return 0;
+    uint32_t state = 1;
+    for (int i = 0; i < GRANULAR_MAX_GRAINS; i++) start_grain(&grains[i], 1.5f, &params, 0, &state);
+
+    // Every grain that ends is started again at once, so all of them sound in every block
+    int64_t start = esp_timer_get_time();
+    for (int block = 0; block < blocks; block++) {
+        memset(buffer, 0, sizeof(buffer));
+        for (int i = 0; i < GRANULAR_MAX_GRAINS; i++) {
+            render_grain(&grains[i], buffer, FRAMES_PER_WRITE);
+            if (grains[i].remaining == 0) start_grain(&grains[i], 1.5f, &params, 0, &state);
+        }
+    }
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    heap_caps_free(grains);
+    return elapsed;
+}
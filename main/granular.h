@@ -0,0 +1,92 @@
+// Granular voice engine: windowed grains sprayed from a source recording
+//
+// With the granular engine selected (synth_set_engine()), every sounding voice
+// emits short grains read from one source buffer in PSRAM instead of playing
+// the waveform. A grain starts near the play position (spread at random by
+// the spray), reads the source at the voice's pitch relative to C1, the pitch
+// the source plays at when read at speed 1, and is shaped by a window from a
+// lookup table. The voice's ADSR envelope then shapes the whole cloud like
+// any other note.
+//
+// Grains are the blocks of one fixed pool (dsp_pool_t) of GRANULAR_MAX_GRAINS
+// shared by all voices, and are scheduled once per block: each voice counts
+// down the frames to its next onset, and every onset that falls inside the
+// block takes a grain from the pool and starts it at its frame. With the pool
+// empty the onset is dropped; nothing is allocated while rendering.
+//
+// The source starts out as GRANULAR_SOURCE_SECONDS of a sawtooth-like tone at
+// C1 with a slow vibrato and swell, looping seamlessly. granular_capture_start()
+// replaces it with the next GRANULAR_SOURCE_SECONDS of the mix.
+
+#ifndef GRANULAR_H
+#define GRANULAR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define GRANULAR_MAX_GRAINS     64                                 // Grains sounding at once, all voices together
+#define GRANULAR_SOURCE_SECONDS 2                                  // Length of the source recording
+#define GRANULAR_SOURCE_FRAMES  (GRANULAR_SOURCE_SECONDS * 44100)  // Mono samples at SAMPLE_RATE
+#define GRANULAR_WINDOW_LENGTH  512                                // Table segments over one grain
+
+typedef enum {
+    GRANULAR_WINDOW_HANN = 0,  // Raised cosine, smooth clouds
+    GRANULAR_WINDOW_TUKEY,     // Flat top with cosine tapers over the outer quarters
+    GRANULAR_WINDOW_DECAY,     // Short attack and an exponential decay, for plucked clouds
+    GRANULAR_WINDOW_COUNT
+} granular_window_t;
+
+// Settings, any value in range may change at any time; each grain keeps the ones it started with
+typedef struct {
+    float             position;   // Where grains start in the source (0 .. 1)
+    float             spray;      // Random spread of the start around it (0 .. 1 of the source)
+    float             density;    // Grain onsets per second and voice (1 .. 1000)
+    float             length_ms;  // Grain length (5 .. 500)
+    float             jitter;     // Random pitch spread of every grain in semitones (0 .. 12)
+    granular_window_t window;
+} granular_params_t;
+
+typedef struct {
+    uint32_t started;    // Grains started since startup
+    uint32_t dropped;    // Onsets dropped because the pool was empty
+    int      active;     // Grains sounding now
+    int      peak;       // Most grains sounding at once
+    bool     capturing;  // The source is being recorded from the mix
+    int      captured;   // Frames recorded by the capture in progress
+} granular_stats_t;
+
+// Fill the window tables and the source, and carve the grain pool; call once after dsp_arena_init()
+bool granular_init(int voices);
+
+// Settings as the engine starts up with
+void granular_params_default(granular_params_t* params);
+
+// Check that all settings are in range
+bool granular_params_valid(const granular_params_t* params);
+
+// Human readable name ("hann", "tukey", "decay") and back (GRANULAR_WINDOW_COUNT if unknown)
+const char*       granular_window_name(granular_window_t window);
+granular_window_t granular_window_from_name(const char* name);
+
+// Render 'frames' frames of one voice's grains into 'buffer' (mono, overwritten), 'speed' being the
+// voice's pitch relative to C1; a voice that had no grains before starts with an onset at frame 0
+// Audio task only, like every function below that changes grains or the source
+void granular_voice_render(int voice, float speed, const granular_params_t* params, float* buffer, int frames);
+
+// Hand a voice's grains back to the pool, once the voice fell idle or the engine was switched away
+void granular_voice_stop(int voice);
+
+// Record the next GRANULAR_SOURCE_FRAMES frames of the mix into the source (from any task)
+void granular_capture_start(void);
+
+// Feed one mixed block (interleaved stereo at SAMPLE_RATE) to a capture in progress, returns at once otherwise
+void granular_capture_block(const float* mix, int frames);
+
+// Copy the statistics
+void granular_get_stats(granular_stats_t* stats);
+
+// Benchmark: time 'blocks' blocks of FRAMES_PER_WRITE frames with GRANULAR_MAX_GRAINS grains sounding
+// from the source, returns microseconds
+uint32_t granular_bench(int blocks);
+
+#endif  // GRANULAR_H
@@ -0,0 +1,25 @@
+// Auto-generated half-band filter coefficients for musical keyboard
+// 2x oversampling at 44100 Hz, length 47, Kaiser beta: 6.6
+// Passband ripple (0 - 18000 Hz): 0.0064 dB
+// Stopband attenuation (from 26100 Hz): 66.8 dB
+//
+// Generated by generate_halfband.pl
+
+#ifndef HALFBAND_COEFFS_H
+#define HALFBAND_COEFFS_H
+
+#define HALFBAND_TAPS    24
+#define HALFBAND_LATENCY 23  // Frames at the base rate through interpolator and decimator
+
+// The branch without the centre tap (every second coefficient, the others are
+// zero), symmetric, so the order of the taps does not matter
+static const float halfband_coeffs[24] = {
+    -1.187581128e-04, 4.965078075e-04, -1.277163064e-03, 2.677315726e-03,
+    -4.974724353e-03, 8.532862756e-03, -1.386744198e-02, 2.182581772e-02,
+    -3.410619784e-02, 5.506007271e-02, -1.007386767e-01, 3.164903853e-01,
+    3.164903853e-01, -1.007386767e-01, 5.506007271e-02, -3.410619784e-02,
+    2.182581772e-02, -1.386744198e-02, 8.532862756e-03, -4.974724353e-03,
+    2.677315726e-03, -1.277163064e-03, 4.965078075e-04, -1.187581128e-04
+};
+
+#endif // HALFBAND_COEFFS_H
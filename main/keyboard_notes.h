@@ -31,26 +31,27 @@ typedef struct {
     uint32_t scancode_press;   // Scancode when key is pressed
     uint32_t scancode_release; // Scancode when key is released
     bool is_black_key;         // true for sharps/flats, false for natural notes
+    uint8_t semitone;          // Semitones above C1 (0-12), pitch class is semitone % 12
 } note_def_t;
 
 // Note definitions (13 notes: C1 to C2 chromatic scale)
-const note_def_t note_defs[NUM_NOTES] = {
+static const note_def_t note_defs[NUM_NOTES] = {
     // White keys (ASDFGHJK row)
-    {"C1",  261.63, 0x1E, 0x9E, false},  // A key
-    {"D1",  293.66, 0x1F, 0x9F, false},  // S key
-    {"E1",  329.63, 0x20, 0xA0, false},  // D key
-    {"F1",  349.23, 0x21, 0xA1, false},  // F key
-    {"G1",  392.00, 0x22, 0xA2, false},  // G key
-    {"A1",  440.00, 0x23, 0xA3, false},  // H key
-    {"B1",  493.88, 0x24, 0xA4, false},  // J key
-    {"C2",  523.25, 0x25, 0xA5, false},  // K key
+    {"C1",  261.63, 0x1E, 0x9E, false,  0},  // A key
+    {"D1",  293.66, 0x1F, 0x9F, false,  2},  // S key
+    {"E1",  329.63, 0x20, 0xA0, false,  4},  // D key
+    {"F1",  349.23, 0x21, 0xA1, false,  5},  // F key
+    {"G1",  392.00, 0x22, 0xA2, false,  7},  // G key
+    {"A1",  440.00, 0x23, 0xA3, false,  9},  // H key
+    {"B1",  493.88, 0x24, 0xA4, false, 11},  // J key
+    {"C2",  523.25, 0x25, 0xA5, false, 12},  // K key
 
     // Black keys (QWRTY row)
-    {"C#1", 277.18, 0x10, 0x90, true},   // Q key (between C and D)
-    {"D#1", 311.13, 0x11, 0x91, true},   // W key (between D and E)
-    {"F#1", 369.99, 0x13, 0x93, true},   // R key (between F and G)
-    {"G#1", 415.30, 0x14, 0x94, true},   // T key (between G and A)
-    {"A#1", 466.16, 0x15, 0x95, true},   // Y key (between A and B)
+    {"C#1", 277.18, 0x10, 0x90, true,  1},   // Q key (between C and D)
+    {"D#1", 311.13, 0x11, 0x91, true,  3},   // W key (between D and E)
+    {"F#1", 369.99, 0x13, 0x93, true,  6},   // R key (between F and G)
+    {"G#1", 415.30, 0x14, 0x94, true,  8},   // T key (between G and A)
+    {"A#1", 466.16, 0x15, 0x95, true, 10},   // Y key (between A and B)
 };
 
 // Helper function: Find note index by scancode
@@ -0,0 +1,104 @@
+// Audio-reactive LED visualisation
+
+#include "led_visualizer.h"
+#include <math.h>
+#include <string.h>
+#include "bsp/led.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "keyboard_notes.h"
+#include "synth.h"
+#include "trace.h"
+
+#define LED_COUNT          6
+#define LED_UPDATE_MS      33  // ~30 Hz
+#define LED_MAX_BRIGHTNESS 64  // Per channel, the LEDs are very bright at full power
+#define LED_MIN_ENVELOPE   0.3f  // Brightness floor so quiet notes stay visible
+
+// Per note mapping, computed once at start
+static uint8_t note_led[NUM_NOTES];       // LED a note lights up (by pitch, left to right)
+static float   note_color[NUM_NOTES][3];  // RGB colour of a note (hue by pitch class)
+
+static uint8_t       led_data[LED_COUNT * 3];  // G, R, B per LED, as sent to the BSP
+static volatile bool led_enabled = true;
+
+// Helper function: Fully saturated colour for a hue in degrees
+static void hue_to_rgb(float hue, float rgb[3]) {
+    float h = fmodf(hue, 360.0f) / 60.0f;
+    float x = 1.0f - fabsf(fmodf(h, 2.0f) - 1.0f);
+    float r = 0.0f, g = 0.0f, b = 0.0f;
+    switch ((int)h) {
+        case 0: r = 1.0f; g = x; break;
+        case 1: r = x; g = 1.0f; break;
+        case 2: g = 1.0f; b = x; break;
+        case 3: g = x; b = 1.0f; break;
+        case 4: r = x; b = 1.0f; break;
+        default: r = 1.0f; b = x; break;
+    }
+    rgb[0] = r;
+    rgb[1] = g;
+    rgb[2] = b;
+}
+
+// Helper function: Build the LED colours for one frame, returns true if they changed
+static bool render_leds(void) {
+    synth_snapshot_t snapshot;
+    float            accum[LED_COUNT][3] = {0};
+    if (!synth_get_snapshot(&snapshot)) return false;  // Keep the last frame, try again next time
+
+    for (int i = 0; i < NUM_NOTES; i++) {
+        if (snapshot.note_level[i] <= 0.0f) continue;
+        for (int c = 0; c < 3; c++) accum[note_led[i]][c] += note_color[i][c] * snapshot.note_level[i];
+    }
+
+    // The mix envelope sets the overall brightness, so the LEDs pulse with the output
+    float brightness = LED_MAX_BRIGHTNESS * (LED_MIN_ENVELOPE + (1.0f - LED_MIN_ENVELOPE) * snapshot.envelope);
+
+    uint8_t frame[LED_COUNT * 3];
+    for (int led = 0; led < LED_COUNT; led++) {
+        uint8_t rgb[3];
+        for (int c = 0; c < 3; c++) {
+            float value = fminf(accum[led][c], 1.0f) * brightness;
+            rgb[c]      = (uint8_t)(led_enabled ? value + 0.5f : 0.0f);
+        }
+        frame[led * 3 + 0] = rgb[1];
+        frame[led * 3 + 1] = rgb[0];
+        frame[led * 3 + 2] = rgb[2];
+    }
+
+    if (memcmp(frame, led_data, sizeof(frame)) == 0) return false;
+    memcpy(led_data, frame, sizeof(frame));
+    return true;
+}
+
+static void led_task(void* arg) {
+    TickType_t last_wake = xTaskGetTickCount();
+    while (1) {
+        // One batched write per frame, and only if a colour changed
+        if (render_leds()) {
+            TRACE_BEGIN(TRACE_LED);
+            bsp_led_write(led_data, sizeof(led_data));
+            TRACE_END(TRACE_LED);
+        }
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(LED_UPDATE_MS));
+    }
+}
+
+void led_visualizer_start(void) {
+    // Spread the notes over the LEDs by pitch and colour them by pitch class
+    for (int i = 0; i < NUM_NOTES; i++) {
+        int semitone  = note_defs[i].semitone;
+        note_led[i]   = (uint8_t)(semitone * LED_COUNT / NUM_NOTES);
+        hue_to_rgb((semitone % 12) * 30.0f, note_color[i]);
+    }
+
+    memset(led_data, 0, sizeof(led_data));
+    bsp_led_write(led_data, sizeof(led_data));
+
+    // Same priority as the UI loop (main task) on core 0, far below audio
+    xTaskCreatePinnedToCore(led_task, "leds", 3072, NULL, tskIDLE_PRIORITY + 1, NULL, 0);
+}
+
+void led_visualizer_enable(bool enable) {
+    led_enabled = enable;
+}
@@ -0,0 +1,20 @@
+// Audio-reactive LED visualisation
+//
+// A low priority task on core 0 reads the per-note levels and the mix
+// envelope from the audio snapshot about 30 times per second, turns them
+// into one colour per LED and sends all LEDs in a single bsp_led_write() call,
+// only when something changed. Slow LED I/O therefore never holds up input
+// handling or the audio task.
+
+#ifndef LED_VISUALIZER_H
+#define LED_VISUALIZER_H
+
+#include <stdbool.h>
+
+// Clear the LEDs and start the update task
+void led_visualizer_start(void);
+
+// Turn the visualisation on or off (the LEDs are cleared when off)
+void led_visualizer_enable(bool enable);
+
+#endif  // LED_VISUALIZER_H
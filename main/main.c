@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include "bsp/device.h"
@@ -8,8 +9,13 @@
 #include "bsp/led.h"
 #include "bsp/power.h"
 #include "bsp/audio.h"
+#include "chord.h"
+#include "dsp_arena.h"
 #include "custom_certificates.h"
+#include "fb_region.h"
 #include "driver/gpio.h"
+#include "epaper.h"
+#include "fb_snapshot.h"
 #include "driver/i2s_std.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_types.h"
@@ -24,9 +30,16 @@
 #include "portmacro.h"
 #include "wifi_connection.h"
 #include "wifi_remote.h"
-#include "keyboard_waveform.h"
 #include "keyboard_notes.h"
+#include "led_visualizer.h"
 #include "logo_image.h"
+#include "net_midi.h"
+#include "perf_console.h"
+#include "piano_roll.h"
+#include "synth.h"
+#include "trace.h"
+#include "tutorial.h"
+#include "wavetable.h"
 
 //#define CAVAC_DEBUG
 
@@ -36,31 +49,6 @@
 // External BSP audio function (not in public header)
 extern void bsp_audio_initialize(uint32_t rate);
 
-// Audio constants
-#define MAX_ACTIVE_NOTES  13    // 8 white keys + 5 black keys
-#define FRAMES_PER_WRITE  64
-#define SAMPLE_RATE       44100
-
-// ADSR envelope states
-typedef enum {
-    ADSR_IDLE = 0,      // Note not playing
-    ADSR_ATTACK,        // Ramping up from 0% to 100%
-    ADSR_DECAY,         // Ramping down from 100% to sustain level
-    ADSR_SUSTAIN,       // Holding at sustain level while key pressed
-    ADSR_RELEASE        // Ramping down to 0% after key release
-} adsr_state_t;
-
-// Audio data structure for active notes
-typedef struct {
-    int note_index;             // Which note (0-12), or -1 if inactive
-    float playback_position;    // Fractional sample position in waveform
-    float playback_speed;       // Speed multiplier (frequency / base_freq)
-    adsr_state_t adsr_state;    // Current ADSR envelope state
-    uint32_t adsr_timer;        // Sample counter for ADSR timing
-    float adsr_level;           // Current envelope level (0.0 to 1.0)
-    bool key_held;              // Is the key currently pressed?
-} active_note_t;
-
 // Global variables
 static size_t                       display_h_res        = 0;
 static size_t                       display_v_res        = 0;
@@ -72,202 +60,210 @@ static QueueHandle_t                input_event_queue    = NULL;
 
 // Audio global variables
 static i2s_chan_handle_t i2s_handle = NULL;
-static active_note_t active_notes[MAX_ACTIVE_NOTES];
 static bool note_keys_pressed[NUM_NOTES] = {false};  // Track which keys are currently pressed
-static float current_normalization = 1.0f;  // Smoothed normalization factor
 static uint8_t audio_volume = 100;  // Current volume (0-100%)
 
 #if defined(CONFIG_BSP_TARGET_KAMI)
 // Temporary addition for supporting epaper devices (irrelevant for Tanmatsu)
 static pax_col_t palette[] = {0xffffffff, 0xff000000, 0xffff0000};  // white, black, red
+static bool      epaper_active = false;  // Panel updates go through epaper.c (batched partial refresh)
 #endif
 
-// Helper function: Get interpolated sample from waveform
-static inline float get_waveform_sample(float position) {
-    // Get integer and fractional parts
-    int pos_int = (int)position;
-    float pos_frac = position - pos_int;
+// Keyboard layout (optimized for 480x800 display in landscape/portrait)
+#define WHITE_KEY_WIDTH  60
+#define WHITE_KEY_HEIGHT 200
+#define BLACK_KEY_WIDTH  40
+#define BLACK_KEY_HEIGHT 130
+#define KEYBOARD_X       10
+#define KEYBOARD_MARGIN  20  // Space below the keyboard
+
+// Note indices and x offsets of the black keys (C#, D#, F#, G#, A#)
+static const int black_key_map[5]       = {8, 9, 10, 11, 12};
+static const int black_key_x_offsets[5] = {
+    40,   // C# (between C and D)
+    100,  // D# (between D and E)
+    220,  // F# (between F and G)
+    280,  // G# (between G and A)
+    340   // A# (between A and B)
+};
+
+// Chord name, shown to the right of the keyboard
+#define CHORD_LABEL_X    (KEYBOARD_X + 8 * WHITE_KEY_WIDTH + 20)
+#define CHORD_LABEL_H    60
+#define CHORD_FONT_SIZE  36
+
+// Regions of the screen that changed since the last update
+// Small changes (a key, the chord name) are redrawn and sent to the display on
+// their own, anything else falls back to a full redraw
+#define MAX_DIRTY_RECTS  8
+#define BLIT_STRIP_ROWS  16  // Rows packed per partial display transfer
+
+static pax_recti dirty_rects[MAX_DIRTY_RECTS];
+static int       dirty_count = 0;
+static bool      dirty_full  = true;
+static uint8_t*  blit_strip  = NULL;  // Scratch buffer for packing partial transfers
+
+// Key colours follow the voices, not just the keys: a released key fades out
+// with its release tail, in KEY_SHADES steps so a fade costs only a few redraws
+#define KEY_SHADES 8
+
+static uint8_t key_shade[NUM_NOTES];  // 0 = idle, KEY_SHADES = held
+
+// What is shown above the keyboard (F2 and F3 toggle the views)
+typedef enum {
+    VIEW_LOGO = 0,    // Logo and instructions
+    VIEW_TUTORIAL,    // Falling-notes play-along
+    VIEW_PIANO_ROLL,  // Scrolling history of the notes played
+} ui_view_t;
 
-    // Wrap around the waveform cycle
-    pos_int = pos_int % WAVEFORM_CYCLE_LENGTH;
-    int next_pos = (pos_int + 1) % WAVEFORM_CYCLE_LENGTH;
+static ui_view_t view = VIEW_LOGO;
 
-    // Linear interpolation
-    float sample1 = waveform_data[pos_int] / 32768.0f;
-    float sample2 = waveform_data[next_pos] / 32768.0f;
-    return sample1 + (sample2 - sample1) * pos_frac;
+void blit(void) {
+#if defined(CONFIG_BSP_TARGET_KAMI)
+    // Temporary addition for supporting epaper devices: the panel task sends the frame
+    if (epaper_active) {
+        epaper_damage((pax_recti){0, 0, pax_buf_get_width(&fb), pax_buf_get_height(&fb)});
+        return;
+    }
+#endif
+    TRACE_BEGIN(TRACE_BLIT);
+    bsp_display_blit(0, 0, display_h_res, display_v_res, pax_buf_get_pixels(&fb));
+    TRACE_END(TRACE_BLIT);
 }
 
-// Helper function: Update ADSR envelope for a note
-static inline void update_adsr(active_note_t* note) {
-    switch (note->adsr_state) {
-        case ADSR_IDLE:
-            note->adsr_level = 0.0f;
-            break;
-
-        case ADSR_ATTACK:
-            note->adsr_timer++;
-            note->adsr_level = (float)note->adsr_timer / ADSR_ATTACK_SAMPLES;
-            if (note->adsr_timer >= ADSR_ATTACK_SAMPLES) {
-                note->adsr_state = ADSR_DECAY;
-                note->adsr_timer = 0;
-                note->adsr_level = 1.0f;
-            }
-            break;
-
-        case ADSR_DECAY:
-            note->adsr_timer++;
-            float decay_progress = (float)note->adsr_timer / ADSR_DECAY_SAMPLES;
-            note->adsr_level = 1.0f - (1.0f - ADSR_SUSTAIN_LEVEL) * decay_progress;
-            if (note->adsr_timer >= ADSR_DECAY_SAMPLES) {
-                note->adsr_state = ADSR_SUSTAIN;
-                note->adsr_level = ADSR_SUSTAIN_LEVEL;
-            }
-            break;
-
-        case ADSR_SUSTAIN:
-            note->adsr_level = ADSR_SUSTAIN_LEVEL;
-            // Check if key was released
-            if (!note->key_held) {
-                note->adsr_state = ADSR_RELEASE;
-                note->adsr_timer = 0;
-            }
-            break;
-
-        case ADSR_RELEASE:
-            note->adsr_timer++;
-            float release_progress = (float)note->adsr_timer / ADSR_RELEASE_SAMPLES;
-            note->adsr_level = ADSR_SUSTAIN_LEVEL * (1.0f - release_progress);
-            if (note->adsr_timer >= ADSR_RELEASE_SAMPLES) {
-                note->adsr_state = ADSR_IDLE;
-                note->adsr_level = 0.0f;
-                note->note_index = -1;  // Mark slot as free
+// Send one region of the framebuffer (in screen coordinates) to the display
+void blit_region(pax_recti rect) {
+#if defined(CONFIG_BSP_TARGET_KAMI)
+    // Temporary addition for supporting epaper devices: partial refresh through the panel task
+    if (epaper_active) {
+        epaper_damage(rect);
+    } else {
+        blit();
+    }
+#else
+    int raw_w = display_h_res;
+    int raw_h = display_v_res;
+
+    // Map the region to panel coordinates, with one pixel of slack for
+    // anti-aliased edges, then clamp it to the panel
+    pax_recti raw = fb_region_to_raw(&fb, rect);
+    int x0 = raw.x - 1 < 0 ? 0 : raw.x - 1;
+    int y0 = raw.y - 1 < 0 ? 0 : raw.y - 1;
+    int x1 = raw.x + raw.w + 1 > raw_w ? raw_w : raw.x + raw.w + 1;
+    int y1 = raw.y + raw.h + 1 > raw_h ? raw_h : raw.y + raw.h + 1;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    int            bpp    = display_color_format == LCD_COLOR_PIXEL_FORMAT_RGB565 ? 2 : 3;
+    int            width  = x1 - x0;
+    const uint8_t* pixels = pax_buf_get_pixels(&fb);
+
+    TRACE_BEGIN(TRACE_BLIT);
+    if (width == raw_w) {
+        // Whole panel rows are already contiguous in the framebuffer
+        bsp_display_blit(0, y0, raw_w, y1 - y0, pixels + (size_t)y0 * raw_w * bpp);
+    } else if (blit_strip == NULL) {
+        bsp_display_blit(0, 0, raw_w, raw_h, pixels);
+    } else {
+        // Pack the rows of the region into the scratch strip, a few rows at a time
+        for (int y = y0; y < y1; y += BLIT_STRIP_ROWS) {
+            int rows = y1 - y < BLIT_STRIP_ROWS ? y1 - y : BLIT_STRIP_ROWS;
+            for (int row = 0; row < rows; row++) {
+                memcpy(blit_strip + (size_t)row * width * bpp, pixels + ((size_t)(y + row) * raw_w + x0) * bpp,
+                       (size_t)width * bpp);
             }
-            break;
+            bsp_display_blit(x0, y, width, rows, blit_strip);
+        }
     }
+    TRACE_END(TRACE_BLIT);
+#endif
 }
 
-// Audio mixing task
-void audio_task(void* arg) {
-    int16_t output_buffer[FRAMES_PER_WRITE * 2];  // Stereo: 2 channels per frame
-    size_t bytes_written;
-
-    while (1) {
-        // Mix all active notes into output buffer
-        for (int frame = 0; frame < FRAMES_PER_WRITE; frame++) {
-            float mix_left = 0.0f;
-            float mix_right = 0.0f;
-            int active_count = 0;
-
-            // Process each active note
-            for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
-                if (active_notes[i].adsr_state != ADSR_IDLE) {
-                    active_count++;
-
-                    // Get interpolated sample from waveform
-                    float sample = get_waveform_sample(active_notes[i].playback_position);
-
-                    // Update ADSR envelope
-                    update_adsr(&active_notes[i]);
-
-                    // Apply envelope
-                    sample *= active_notes[i].adsr_level;
-
-                    // Accumulate (mono to stereo)
-                    mix_left += sample;
-                    mix_right += sample;
-
-                    // Advance playback position at the correct speed
-                    // Speed is independent per note - this ensures correct pitch
-                    active_notes[i].playback_position += active_notes[i].playback_speed;
-
-                    // Keep position within reasonable bounds to prevent overflow
-                    if (active_notes[i].playback_position >= WAVEFORM_CYCLE_LENGTH * 1000) {
-                        active_notes[i].playback_position -= WAVEFORM_CYCLE_LENGTH * 1000;
-                    }
-                }
-            }
-
-            // Normalize by number of active notes to prevent clipping
-            // This ensures total output stays within -1.0 to 1.0 range
-            if (active_count > 0) {
-                // Calculate target normalization (sqrt for better perceived loudness)
-                float target_normalization = 1.0f / sqrtf((float)active_count);
-
-                // Smooth the normalization change to prevent clicks when notes start/stop
-                // Use exponential smoothing: smaller alpha = smoother but slower response
-                // Alpha of 0.01 means normalization reaches 99% of target in ~460 samples (~10ms)
-                float alpha = 0.01f;
-                current_normalization += alpha * (target_normalization - current_normalization);
-
-                mix_left *= current_normalization;
-                mix_right *= current_normalization;
-            } else {
-                // No active notes, reset normalization to 1.0
-                current_normalization = 1.0f;
-            }
-
-            // Soft clip to prevent distortion (should rarely trigger now)
-            mix_left = fminf(1.0f, fmaxf(-1.0f, mix_left));
-            mix_right = fminf(1.0f, fmaxf(-1.0f, mix_right));
+// Helper function: Queue a region for the next screen update
+static void mark_dirty(pax_recti rect) {
+#if defined(CONFIG_BSP_TARGET_KAMI)
+    // Temporary addition for supporting epaper devices: only full frames without the panel task
+    if (!epaper_active) dirty_full = true;
+#else
+    if (blit_strip == NULL) dirty_full = true;
+#endif
+    if (dirty_full) return;
+    if (dirty_count == MAX_DIRTY_RECTS) {
+        dirty_full = true;
+        return;
+    }
+    dirty_rects[dirty_count++] = rect;
+}
 
-            // Convert back to 16-bit stereo
-            output_buffer[frame * 2] = (int16_t)(mix_left * 32767.0f);
-            output_buffer[frame * 2 + 1] = (int16_t)(mix_right * 32767.0f);
+// Helper function: Screen area covered by a key
+static pax_recti key_rect(int note_idx, int height) {
+    int keyboard_start_y = height - WHITE_KEY_HEIGHT - KEYBOARD_MARGIN;
+    for (int i = 0; i < 5; i++) {
+        if (black_key_map[i] == note_idx) {
+            return (pax_recti){KEYBOARD_X + black_key_x_offsets[i], keyboard_start_y, BLACK_KEY_WIDTH,
+                               BLACK_KEY_HEIGHT};
         }
+    }
+    // White keys also cover the neighbouring black keys, which get redrawn on top
+    return (pax_recti){KEYBOARD_X + note_idx * WHITE_KEY_WIDTH, keyboard_start_y, WHITE_KEY_WIDTH, WHITE_KEY_HEIGHT};
+}
 
-        // Write to I2S (blocks until DMA buffer is ready, ~1.45ms)
-        // I2S output rate is constant at SAMPLE_RATE (44100 Hz)
-        // regardless of how many notes are playing
-        if (i2s_handle != NULL) {
-            i2s_channel_write(i2s_handle, output_buffer,
-                            sizeof(output_buffer), &bytes_written, portMAX_DELAY);
+// Helper function: Update the key shades from the audio snapshot, marks the keys that changed
+static void update_key_activity(int height) {
+    synth_snapshot_t snapshot;
+    bool             have_snapshot = synth_get_snapshot(&snapshot);
+
+    for (int i = 0; i < NUM_NOTES; i++) {
+        int shade = key_shade[i];
+        if (note_keys_pressed[i]) {
+            shade = KEY_SHADES;
+        } else if (have_snapshot) {
+            // Level relative to sustain, rounded up so the last bit of a tail still shows
+            shade = (int)ceilf(snapshot.note_level[i] / ADSR_SUSTAIN_LEVEL * KEY_SHADES);
+            if (snapshot.note_state[i] == SYNTH_NOTE_IDLE) shade = 0;
+            if (shade > KEY_SHADES) shade = KEY_SHADES;
+        }
+        if (shade != key_shade[i]) {
+            key_shade[i] = (uint8_t)shade;
+            mark_dirty(key_rect(i, height));
         }
     }
 }
 
-void blit(void) {
-    bsp_display_blit(0, 0, display_h_res, display_v_res, pax_buf_get_pixels(&fb));
+// Helper function: Colour between a key's idle and pressed colour for its shade
+static pax_col_t key_color(pax_col_t idle, pax_col_t pressed, int shade) {
+#if defined(CONFIG_BSP_TARGET_KAMI)
+    // Temporary addition for supporting epaper devices: no shades in a three colour palette
+    return shade > 0 ? pressed : idle;
+#else
+    return pax_col_lerp((uint8_t)(shade * 255 / KEY_SHADES), idle, pressed);
+#endif
 }
 
-// Helper function: Start playing a note
-void start_note(int note_index) {
-    if (note_index < 0 || note_index >= NUM_NOTES) return;
-
-    // Find a free slot or reuse a slot with the same note
-    int slot = -1;
-    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        if (active_notes[i].note_index == note_index) {
-            slot = i;  // Reuse existing slot for this note
-            break;
-        }
-        if (slot == -1 && active_notes[i].adsr_state == ADSR_IDLE) {
-            slot = i;  // Found a free slot
-        }
-    }
+// Helper function: Screen area of the chord name
+static pax_recti chord_rect(int width, int height) {
+    int w = width - CHORD_LABEL_X - 40;  // Stay clear of the volume indicator
+    return (pax_recti){CHORD_LABEL_X, height - WHITE_KEY_HEIGHT - KEYBOARD_MARGIN + 30, w > 0 ? w : 0, CHORD_LABEL_H};
+}
 
-    if (slot >= 0) {
-        // Start the note
-        active_notes[slot].note_index = note_index;
-        active_notes[slot].playback_position = 0.0f;
-        active_notes[slot].playback_speed = note_defs[note_index].frequency / WAVEFORM_BASE_FREQ;
-        active_notes[slot].adsr_state = ADSR_ATTACK;
-        active_notes[slot].adsr_timer = 0;
-        active_notes[slot].adsr_level = 0.0f;
-        active_notes[slot].key_held = true;
-    }
+// Helper function: Screen area of the tutorial and piano-roll views, above the keyboard
+static pax_recti lane_rect(int height) {
+    return (pax_recti){KEYBOARD_X, 0, 8 * WHITE_KEY_WIDTH - 2, height - WHITE_KEY_HEIGHT - KEYBOARD_MARGIN - 4};
 }
 
-// Helper function: Stop playing a note
-void stop_note(int note_index) {
-    if (note_index < 0 || note_index >= NUM_NOTES) return;
+// Helper function: Switch to a view, or back to the logo if it is already shown
+static void toggle_view(ui_view_t new_view, int height) {
+    view = view == new_view ? VIEW_LOGO : new_view;
 
-    // Find the active note and trigger release
-    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        if (active_notes[i].note_index == note_index) {
-            active_notes[i].key_held = false;  // Trigger release phase
-        }
+    pax_recti keys[NUM_NOTES];
+    for (int i = 0; i < NUM_NOTES; i++) {
+        keys[i] = key_rect(i, height);
+    }
+    if (view == VIEW_TUTORIAL) {
+        tutorial_start(lane_rect(height), keys);
+    } else if (view == VIEW_PIANO_ROLL) {
+        piano_roll_start(lane_rect(height), keys);
     }
+    dirty_full = true;
 }
 
 // Render on-screen keyboard
@@ -280,96 +276,96 @@ void render_keyboard(pax_buf_t* fb, int width, int height) {
     const pax_col_t COLOR_DARK_GREEN = 0xFF006400;  // Dark green for white keys
     const pax_col_t COLOR_BRIGHT_GREEN = 0xFF00FF00;  // Bright green for black keys
 
-    // Keyboard dimensions (optimized for 480x800 display in landscape/portrait)
-    const int white_key_width = 60;
-    const int white_key_height = 200;
-    const int black_key_width = 40;
-    const int black_key_height = 130;
-    const int keyboard_start_y = height - white_key_height - 20;
+    const int keyboard_start_y = height - WHITE_KEY_HEIGHT - KEYBOARD_MARGIN;
 
     // Keyboard key names for white keys (A, S, D, F, G, H, J, K)
     const char* white_key_names[8] = {"A", "S", "D", "F", "G", "H", "J", "K"};
 
     // Draw white keys (C, D, E, F, G, A, B, C)
     for (int i = 0; i < 8; i++) {
-        int x = 10 + i * white_key_width;
+        int x = KEYBOARD_X + i * WHITE_KEY_WIDTH;
         int y = keyboard_start_y;
 
-        // Check if key is pressed
-        bool is_pressed = note_keys_pressed[i];
-        pax_col_t key_color = is_pressed ? COLOR_BLUE : COLOR_WHITE;  // Blue when pressed
+        // Blue when pressed, fading back to white while the note rings out
+        pax_col_t color = key_color(COLOR_WHITE, COLOR_BLUE, key_shade[i]);
 
         // Draw key
-        pax_draw_rect(fb, key_color, x, y, white_key_width - 2, white_key_height);
-        pax_outline_rect(fb, COLOR_BLACK, x, y, white_key_width - 2, white_key_height);
+        pax_draw_rect(fb, color, x, y, WHITE_KEY_WIDTH - 2, WHITE_KEY_HEIGHT);
+        pax_outline_rect(fb, COLOR_BLACK, x, y, WHITE_KEY_WIDTH - 2, WHITE_KEY_HEIGHT);
 
         // Draw keyboard key name in dark green (above note name)
-        pax_draw_text(fb, COLOR_DARK_GREEN, pax_font_sky_mono, 14, x + 21, y + white_key_height - 50, white_key_names[i]);
+        pax_draw_text(fb, COLOR_DARK_GREEN, pax_font_sky_mono, 14, x + 21, y + WHITE_KEY_HEIGHT - 50, white_key_names[i]);
 
         // Draw note name
-        pax_draw_text(fb, COLOR_BLACK, pax_font_sky_mono, 12, x + 18, y + white_key_height - 30, note_defs[i].name);
+        pax_draw_text(fb, COLOR_BLACK, pax_font_sky_mono, 12, x + 18, y + WHITE_KEY_HEIGHT - 30, note_defs[i].name);
     }
 
     // Keyboard key names for black keys (Q, W, R, T, Y)
     const char* black_key_names[5] = {"Q", "W", "R", "T", "Y"};
 
     // Draw black keys (C#, D#, F#, G#, A#)
-    int black_key_map[5] = {8, 9, 10, 11, 12};  // Note indices for black keys
-    int black_key_x_offsets[5] = {
-        40,   // C# (between C and D)
-        100,  // D# (between D and E)
-        220,  // F# (between F and G)
-        280,  // G# (between G and A)
-        340   // A# (between A and B)
-    };
-
     for (int i = 0; i < 5; i++) {
-        int x = 10 + black_key_x_offsets[i];
+        int x = KEYBOARD_X + black_key_x_offsets[i];
         int y = keyboard_start_y;
         int note_idx = black_key_map[i];
 
-        // Check if key is pressed
-        bool is_pressed = note_keys_pressed[note_idx];
-        pax_col_t key_color = is_pressed ? COLOR_RED : COLOR_BLACK;  // Red when pressed
+        // Red when pressed, fading back to black while the note rings out
+        pax_col_t color = key_color(COLOR_BLACK, COLOR_RED, key_shade[note_idx]);
 
         // Draw key
-        pax_draw_rect(fb, key_color, x, y, black_key_width, black_key_height);
-        pax_outline_rect(fb, COLOR_WHITE, x, y, black_key_width, black_key_height);
+        pax_draw_rect(fb, color, x, y, BLACK_KEY_WIDTH, BLACK_KEY_HEIGHT);
+        pax_outline_rect(fb, COLOR_WHITE, x, y, BLACK_KEY_WIDTH, BLACK_KEY_HEIGHT);
 
         // Draw keyboard key name in bright green (above note name)
-        pax_draw_text(fb, COLOR_BRIGHT_GREEN, pax_font_sky_mono, 12, x + 12, y + black_key_height - 40, black_key_names[i]);
+        pax_draw_text(fb, COLOR_BRIGHT_GREEN, pax_font_sky_mono, 12, x + 12, y + BLACK_KEY_HEIGHT - 40, black_key_names[i]);
 
         // Draw note name
-        pax_draw_text(fb, COLOR_WHITE, pax_font_sky_mono, 10, x + 5, y + black_key_height - 20, note_defs[note_idx].name);
+        pax_draw_text(fb, COLOR_WHITE, pax_font_sky_mono, 10, x + 5, y + BLACK_KEY_HEIGHT - 20, note_defs[note_idx].name);
     }
 }
 
+// Render the name of the chord being held
+void render_chord(pax_buf_t* fb, int width, int height) {
+    const pax_col_t COLOR_WHITE = 0xFFFFFFFF;
+
+    pax_recti rect = chord_rect(width, height);
+    pax_draw_text(fb, COLOR_WHITE, pax_font_sky_mono, CHORD_FONT_SIZE, rect.x, rect.y + (CHORD_LABEL_H - CHORD_FONT_SIZE) / 2,
+                  chord_name());
+}
+
+// Volume bar dimensions
+#define VOLUME_BAR_WIDTH  20
+#define VOLUME_BAR_HEIGHT 100
+#define VOLUME_BAR_MARGIN 10
+
+// Helper function: Screen area of the volume indicator
+static pax_recti volume_rect(int width, int height) {
+    // Position: bottom right corner, just a few pixels from bottom
+    return (pax_recti){width - VOLUME_BAR_WIDTH - VOLUME_BAR_MARGIN, height - VOLUME_BAR_HEIGHT - VOLUME_BAR_MARGIN,
+                       VOLUME_BAR_WIDTH, VOLUME_BAR_HEIGHT};
+}
+
 // Render volume indicator
 void render_volume_indicator(pax_buf_t* fb, int width, int height) {
     const pax_col_t COLOR_WHITE = 0xFFFFFFFF;
     const pax_col_t COLOR_DARK_GREEN = 0xFF006400;
 
-    // Volume bar dimensions
-    const int bar_width = 20;
-    const int bar_height = 100;
-    const int margin = 10;
-
-    // Position: bottom right corner, just a few pixels from bottom
-    int x = width - bar_width - margin;
-    int y = height - bar_height - margin;
+    pax_recti bar = volume_rect(width, height);
+    int x = bar.x;
+    int y = bar.y;
 
     // Draw hollow white rectangle (full volume range)
-    pax_outline_rect(fb, COLOR_WHITE, x, y, bar_width, bar_height);
+    pax_outline_rect(fb, COLOR_WHITE, x, y, VOLUME_BAR_WIDTH, VOLUME_BAR_HEIGHT);
 
     // Calculate filled height based on volume (0-100%)
     // Account for borders (2 pixels: top and bottom)
-    int max_fill_height = bar_height - 2;
+    int max_fill_height = VOLUME_BAR_HEIGHT - 2;
     int filled_height = (max_fill_height * audio_volume) / 100;
 
     // Draw filled dark green bar from bottom up, staying inside the white border
     if (filled_height > 0) {
-        int filled_y = y + bar_height - 1 - filled_height;  // -1 for bottom border
-        pax_draw_rect(fb, COLOR_DARK_GREEN, x + 1, filled_y, bar_width - 2, filled_height);
+        int filled_y = y + VOLUME_BAR_HEIGHT - 1 - filled_height;  // -1 for bottom border
+        pax_draw_rect(fb, COLOR_DARK_GREEN, x + 1, filled_y, VOLUME_BAR_WIDTH - 2, filled_height);
     }
 }
 
@@ -401,28 +397,23 @@ void app_main(void) {
     bsp_audio_set_amplifier(true);   // Enable amplifier
     bsp_audio_set_volume(audio_volume);  // Set initial volume (100%)
 
-    // Initialize active notes array
-    memset(active_notes, 0, sizeof(active_notes));
-    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        active_notes[i].note_index = -1;  // Mark all slots as free
-        active_notes[i].adsr_state = ADSR_IDLE;
-    }
+    // Reserve the memory all DSP state is carved from
+    ESP_ERROR_CHECK(dsp_arena_init());
 
-    // Create audio mixing task on Core 1 with high priority
-    xTaskCreatePinnedToCore(
-        audio_task,
-        "audio",
-        4096,                           // Stack size
-        NULL,                           // Parameters
-        configMAX_PRIORITIES - 2,       // High priority
-        NULL,                           // Task handle
-        1                               // Pin to Core 1
-    );
-
-    uint8_t led_data[] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    };
-    bsp_led_write(led_data, sizeof(led_data));
+    // Start the synthesizer (audio task on Core 1)
+    synth_init(i2s_handle);
+
+    // Start the wavetable loader (builds user wavetables in the background)
+    wavetable_start();
+
+    // Start the performance console on the serial port
+    perf_console_start();
+
+    // Start the audio-reactive LEDs (cleared first, then updated at ~30 Hz)
+    led_visualizer_start();
+
+    // Join Wi-Fi and listen for network MIDI (in the background, the keyboard works without it)
+    net_midi_start();
 
     // Get display parameters and rotation
     res = bsp_display_get_parameters(&display_h_res, &display_v_res, &display_color_format, &display_data_endian);
@@ -489,6 +480,17 @@ void app_main(void) {
 #endif
     pax_buf_set_orientation(&fb, orientation);
 
+#if defined(CONFIG_BSP_TARGET_KAMI)
+    // Temporary addition for supporting epaper devices: slow panel updates run in their own task
+    epaper_active = epaper_start(&fb);
+#else
+    // Scratch rows for partial display updates (falls back to full frames if this fails)
+    blit_strip = malloc(display_h_res * 3 * BLIT_STRIP_ROWS);
+#endif
+
+    // Framebuffer snapshots for the 'fbsnap' console command
+    fb_snapshot_start(&fb, display_data_endian == LCD_RGB_DATA_ENDIAN_BIG);
+
     // Initialize logo buffer (already pre-rotated in the image data)
     pax_buf_init(&logo_buf, (void*)logo_image_data, LOGO_WIDTH, LOGO_HEIGHT, PAX_BUF_24_888RGB);
 
@@ -511,17 +513,18 @@ void app_main(void) {
     int fb_w = pax_buf_get_width(&fb);
     int fb_h = pax_buf_get_height(&fb);
 
-    // Track whether screen needs updating
-    bool screen_needs_update = true;
+    // Track when the screen was last updated (dirty_full forces the first frame)
     uint32_t last_update_time = 0;
     const uint32_t min_update_interval_ms = 33;  // Max 30 FPS to reduce DMA contention
+    const uint32_t tutorial_interval_ms = 16;  // 60 FPS while notes are falling
 
-    uint32_t delay = pdMS_TO_TICKS(10);  // 10ms timeout for input
+    const uint32_t max_delay_ms = 10;  // 10ms timeout for input
     while(1) {
         bsp_input_event_t event;
         bool input_received = false;
 
         // Process input events
+        TRACE_BEGIN(TRACE_INPUT);
         while (xQueueReceive(input_event_queue, &event, 0) == pdTRUE) {
             input_received = true;
             if (event.type == INPUT_EVENT_TYPE_SCANCODE) {
@@ -535,6 +538,19 @@ void app_main(void) {
                     bsp_device_restart_to_launcher();
                 }
 
+                // F1 dumps the trace buffer over the serial console (see trace_to_chrome.py)
+                if (key == 0x3B && is_key_press(scancode)) {
+                    trace_dump();
+                }
+
+                // F2 toggles the falling-notes tutorial, F3 the piano-roll history
+                if (key == 0x3C && is_key_press(scancode)) {
+                    toggle_view(VIEW_TUTORIAL, fb_h);
+                }
+                if (key == 0x3D && is_key_press(scancode)) {
+                    toggle_view(VIEW_PIANO_ROLL, fb_h);
+                }
+
                 // Check for volume keys (only on key press)
                 if (is_key_press(scancode)) {
                     bool volume_changed = false;
@@ -556,67 +572,151 @@ void app_main(void) {
 
                     if (volume_changed) {
                         bsp_audio_set_volume(audio_volume);
-                        screen_needs_update = true;  // Update screen to show new volume
+                        mark_dirty(volume_rect(fb_w, fb_h));  // Update screen to show new volume
                     }
                 }
 
                 int note_idx = find_note_by_scancode(scancode);
 
                 if (note_idx >= 0) {
-                    if (is_key_press(scancode)) {
-                        // Key pressed - start note
-                        note_keys_pressed[note_idx] = true;
-                        start_note(note_idx);
-                        screen_needs_update = true;  // Update screen to show pressed key
-                    } else if (is_key_release(scancode)) {
-                        // Key released - stop note
-                        note_keys_pressed[note_idx] = false;
-                        stop_note(note_idx);
-                        screen_needs_update = true;  // Update screen to show released key
+                    bool pressed = is_key_press(scancode);
+                    if (pressed || is_key_release(scancode)) {
+                        // Key pressed starts the note, key released stops it, from the next audio block
+                        synth_play_note(SYNTH_SOURCE_KEYBOARD, note_idx, pressed);
+
+                        // Update the chord name if it changed, the key follows in update_key_activity()
+                        // (key repeat sends repeated presses, those change nothing)
+                        if (note_keys_pressed[note_idx] != pressed) {
+                            note_keys_pressed[note_idx] = pressed;
+                            piano_roll_record(note_idx, pressed);
+                            if (chord_update(note_idx, pressed)) {
+                                mark_dirty(chord_rect(fb_w, fb_h));
+                            }
+                        }
                     }
                 }
                 // Ignore all other unmapped keys
             }
         }
+        TRACE_END(TRACE_INPUT);
+
+        // Keys light up with their voices, including release tails and stolen voices
+        update_key_activity(fb_h);
 
         // Only update screen if needed and enough time has passed
         uint32_t current_time = xTaskGetTickCount() * portTICK_PERIOD_MS;
-        if (screen_needs_update && (current_time - last_update_time >= min_update_interval_ms)) {
-            // Render display
-            pax_background(&fb, BLACK);
+        uint32_t update_interval_ms = view == VIEW_TUTORIAL ? tutorial_interval_ms : min_update_interval_ms;
+        if ((dirty_full || dirty_count > 0 || view != VIEW_LOGO) &&
+            (current_time - last_update_time >= update_interval_ms)) {
+            // Render display, either the whole frame or each dirty region clipped on its own
+            TRACE_BEGIN(TRACE_RENDER);
+            int regions = dirty_full ? 1 : dirty_count;
+            for (int region = 0; region < regions; region++) {
+                if (dirty_full) {
+                    pax_background(&fb, BLACK);
+                } else {
+                    pax_recti rect = dirty_rects[region];
+                    pax_clip(&fb, rect.x, rect.y, rect.w, rect.h);
+                    pax_draw_rect(&fb, BLACK, rect.x, rect.y, rect.w, rect.h);
+                }
 
-            // Draw centered logo
-            pax_draw_image_op(&fb, &logo_buf, (fb_w - LOGO_WIDTH) / 2, 20);
+                // The tutorial and piano-roll lane takes the place of the logo and instructions
+                if (view == VIEW_LOGO) {
+                    // Draw centered logo
+                    pax_draw_image_op(&fb, &logo_buf, (fb_w - LOGO_WIDTH) / 2, 20);
 
-            // Draw title
-            //pax_draw_text(&fb, WHITE, pax_font_sky_mono, 18, 120, 160, "Musical Keyboard");
+                    // Draw title
+                    //pax_draw_text(&fb, WHITE, pax_font_sky_mono, 18, 120, 160, "Musical Keyboard");
 
-            // Instructions
-            pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 60, 190, "Play notes using your keyboard");
-            pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 80, 210, "Press ESC to exit");
+                    // Instructions
+                    pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 60, 190, "Play notes using your keyboard");
+                    pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 80, 210, "Press ESC to exit");
+                }
 
 #ifdef CAVAC_DEBUG
-            pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 240, debugrotation);
-            pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 260, debugcolor);
-            pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 280, debugwidth);
-            pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 300, debugheight);
+                pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 240, debugrotation);
+                pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 260, debugcolor);
+                pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 280, debugwidth);
+                pax_draw_text(&fb, WHITE, pax_font_sky_mono, 12, 20, 300, debugheight);
 #endif // CAVAC_DEBUG
 
-            // Render keyboard
-            render_keyboard(&fb, fb_w, fb_h);
+                // Render keyboard
+                render_keyboard(&fb, fb_w, fb_h);
+
+                // Render chord name
+                render_chord(&fb, fb_w, fb_h);
+
+                // Render volume indicator
+                render_volume_indicator(&fb, fb_w, fb_h);
+
+                if (!dirty_full) {
+                    pax_noclip(&fb);
+                }
+            }
+
+            // Scroll the lane and draw only the rows that came into view
+            bool lane_changed = false;
+            if (view == VIEW_TUTORIAL) {
+                if (dirty_full) {
+                    tutorial_invalidate();
+                }
+                lane_changed = tutorial_render(&fb);
+            } else if (view == VIEW_PIANO_ROLL) {
+                if (dirty_full) {
+                    piano_roll_invalidate();
+                }
+                lane_changed = piano_roll_render(&fb);
+            }
+            TRACE_END(TRACE_RENDER);
 
-            // Render volume indicator
-            render_volume_indicator(&fb, fb_w, fb_h);
+            // Update display (DMA transfer to screen), only the changed regions if possible
+            if (dirty_full) {
+                blit();
+            } else {
+                for (int region = 0; region < dirty_count; region++) {
+                    blit_region(dirty_rects[region]);
+                }
+                if (lane_changed) {
+                    blit_region(lane_rect(fb_h));
+                }
+            }
 
-            // Update display (DMA transfer to screen)
-            blit();
+            // Snapshot exactly what was just sent to the display
+            if (fb_snapshot_wanted() == FB_SNAPSHOT_DIRTY && (dirty_full || dirty_count > 0 || lane_changed)) {
+                pax_recti sent[MAX_DIRTY_RECTS + 1];
+                int       sent_count = dirty_count;
+                memcpy(sent, dirty_rects, sizeof(pax_recti) * dirty_count);
+                if (lane_changed) {
+                    sent[sent_count++] = lane_rect(fb_h);
+                }
+                fb_snapshot_take(dirty_full ? NULL : sent, sent_count);
+            }
 
-            // Reset update flag and record time
-            screen_needs_update = false;
+            // Reset dirty regions and record time
+            dirty_full = false;
+            dirty_count = 0;
             last_update_time = current_time;
         }
 
+        // A full snapshot does not wait for the next screen update
+        if (fb_snapshot_wanted() == FB_SNAPSHOT_FULL) {
+            fb_snapshot_take(NULL, 0);
+        }
+
+#if defined(CONFIG_BSP_TARGET_KAMI)
+        // Temporary addition for supporting epaper devices: start a batched refresh if one is due
+        if (epaper_active) {
+            epaper_commit();
+        }
+#endif
+
         // Small delay to prevent busy-waiting and allow audio task to run
-        vTaskDelay(delay);
+        // Wake up early when the next frame is due, so scrolling views keep their frame rate
+        uint32_t since_update = xTaskGetTickCount() * portTICK_PERIOD_MS - last_update_time;
+        uint32_t delay_ms = max_delay_ms;
+        if (view != VIEW_LOGO && since_update < update_interval_ms && update_interval_ms - since_update < delay_ms) {
+            delay_ms = update_interval_ms - since_update;
+        }
+        vTaskDelay(pdMS_TO_TICKS(delay_ms) > 0 ? pdMS_TO_TICKS(delay_ms) : 1);
     }
 }
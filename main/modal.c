@@ -0,0 +1,372 @@
+// Modal voice engine: struck resonator banks for bells and mallets
+//
+// Every mode is a two-pole resonator, y[n] = 2 r cos(w) y[n - 1] - r^2 y[n - 2],
+// ringing at w radians per frame and falling by the pole radius r per frame.
+// A strike adds a * sin(w) to y[n - 1]: an impulse, which k frames later
+// rings as a * r^k * sin((k + 1) w), a sine of amplitude a that starts from
+// (almost) zero. The cosines, sines and decay rates of every preset and note
+// are worked out once at startup, so a strike only needs the helpers of
+// dsp_math.h.
+//
+// A voice owns a run of lane groups in the pass, enough for the modes of its
+// note, with the unused lanes of the last group silent. Voices join at the
+// end of the pass and leave it by moving the groups behind them down.
+
+#include "modal.h"
+#include <math.h>
+#include <string.h>
+#include "dsp_arena.h"
+#include "dsp_math.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "keyboard_notes.h"
+#include "synth.h"
+
+_Static_assert(MODAL_MAX_MODES % MODAL_LANES == 0, "Voices own whole lane groups");
+_Static_assert(MODAL_LANES == 4, "render_lanes() runs four lanes");
+
+#define MODAL_ROOT_HZ  261.63f                // C1, the note the decay times of the tables are for
+#define MODAL_MAX_HZ   (SAMPLE_RATE * 0.45f)  // Modes above are left out of a note
+#define MODAL_LEVEL    0.5f                   // Level of a note's modes added in power, as the built-in waveform
+#define MODAL_MAX_RATE 0.1f                   // Fastest decay per frame (decay_factor()'s range)
+#define MODAL_SILENCE  1e-12f                 // Modes below (-240 dB) are set to zero before they turn denormal
+#define LN_1000        6.9077553f             // A decay time is the time to fall by 60 dB
+
+// One mode of a preset table
+typedef struct {
+    float ratio;    // Frequency relative to the note
+    float decay_s;  // Time to fall by 60 dB at C1, higher notes ring shorter
+    float level;    // Relative level, the preset is normalised to MODAL_LEVEL
+} modal_mode_t;
+
+typedef struct {
+    const char*         name;
+    const modal_mode_t* modes;
+    int                 count;
+} modal_preset_def_t;
+
+// One mode of one note, worked out at startup
+typedef struct {
+    float cos_w;       // Frequency in radians per frame, as cosine and sine
+    float sin_w;
+    float rate;        // -ln(r) per frame at decay scale 1
+    float level;       // Normalised level
+    float log2_ratio;  // Octaves above the note, 0 for modes below it (the mallet hardness leaves them alone)
+} modal_coeffs_t;
+
+typedef struct {
+    int            count;  // Modes below MODAL_MAX_HZ
+    modal_coeffs_t modes[MODAL_MAX_MODES];
+} modal_note_t;
+
+// MODAL_LANES modes of one voice side by side
+typedef struct {
+    float c1[MODAL_LANES];  // 2 r cos(w)
+    float c2[MODAL_LANES];  // r^2
+    float y1[MODAL_LANES];  // Last output
+    float y2[MODAL_LANES];  // ... and the one before
+} modal_lanes_t;
+
+typedef struct {
+    int first;   // First lane group in the pass
+    int groups;  // Lane groups, 0 when not in the pass
+    int modes;   // Modes of the note last struck
+} modal_voice_t;
+
+// Tuned bar: the second and third mode tuned to two octaves and three octaves and a third
+static const modal_mode_t marimba_modes[] = {
+    {1.000f, 0.90f, 1.00f}, {3.984f, 0.35f, 0.50f}, {9.920f, 0.15f, 0.25f}, {13.20f, 0.09f, 0.10f},
+    {17.30f, 0.07f, 0.07f}, {21.90f, 0.05f, 0.05f}, {27.10f, 0.04f, 0.03f}, {33.10f, 0.03f, 0.02f},
+};
+
+// Aluminium bar tuned 1:4:10, bending modes with long decays and a few weak torsional ones between them
+static const modal_mode_t vibes_modes[] = {
+    {1.000f, 6.00f, 1.00f}, {4.000f, 2.50f, 0.40f}, {10.00f, 1.00f, 0.15f}, {2.900f, 0.80f, 0.05f},
+    {5.800f, 0.60f, 0.04f}, {14.70f, 0.50f, 0.08f}, {8.600f, 0.40f, 0.03f}, {20.10f, 0.30f, 0.05f},
+    {11.40f, 0.30f, 0.02f}, {26.30f, 0.20f, 0.03f}, {33.20f, 0.15f, 0.02f}, {40.90f, 0.10f, 0.01f},
+};
+
+// Church bell: hum, prime, minor third (tierce), quint and nominal, then the upper partials
+static const modal_mode_t bell_modes[] = {
+    {0.500f, 8.00f, 0.50f}, {1.000f, 5.00f, 0.80f}, {1.183f, 4.00f, 0.70f}, {1.506f, 3.00f, 0.40f},
+    {2.000f, 3.50f, 1.00f}, {2.514f, 2.00f, 0.35f}, {2.662f, 2.00f, 0.30f}, {3.011f, 1.60f, 0.30f},
+    {3.320f, 1.40f, 0.20f}, {4.000f, 1.20f, 0.30f}, {4.240f, 1.00f, 0.15f}, {5.000f, 0.80f, 0.15f},
+    {5.330f, 0.70f, 0.10f}, {6.000f, 0.60f, 0.10f}, {6.670f, 0.50f, 0.08f}, {8.000f, 0.40f, 0.06f},
+};
+
+// Circular membrane: ratios of the Bessel function zeros, the axisymmetric modes a little stronger
+static const modal_mode_t membrane_modes[] = {
+    {1.000f, 1.20f, 1.00f}, {1.593f, 0.69f, 0.44f}, {2.136f, 0.48f, 0.33f}, {2.295f, 0.44f, 0.44f},
+    {2.653f, 0.37f, 0.26f}, {2.917f, 0.33f, 0.24f}, {3.155f, 0.30f, 0.22f}, {3.500f, 0.27f, 0.20f},
+    {3.598f, 0.26f, 0.28f}, {3.647f, 0.25f, 0.19f}, {4.059f, 0.22f, 0.17f}, {4.132f, 0.22f, 0.17f},
+    {4.230f, 0.21f, 0.17f}, {4.601f, 0.19f, 0.15f}, {4.610f, 0.19f, 0.15f}, {4.832f, 0.18f, 0.14f},
+    {4.903f, 0.18f, 0.20f}, {5.084f, 0.17f, 0.14f}, {5.131f, 0.17f, 0.14f}, {5.412f, 0.16f, 0.13f},
+    {5.540f, 0.15f, 0.13f}, {5.553f, 0.15f, 0.13f}, {5.651f, 0.15f, 0.12f}, {5.977f, 0.14f, 0.12f},
+    {6.019f, 0.14f, 0.12f}, {6.153f, 0.14f, 0.11f}, {6.163f, 0.14f, 0.11f}, {6.209f, 0.13f, 0.16f},
+    {6.483f, 0.13f, 0.11f}, {6.529f, 0.13f, 0.11f}, {6.669f, 0.12f, 0.10f}, {6.746f, 0.12f, 0.10f},
+};
+
+#define PRESET(label, table) {label, table, sizeof(table) / sizeof(table[0])}
+
+static const modal_preset_def_t presets[MODAL_PRESET_COUNT] = {
+    [MODAL_PRESET_MARIMBA]  = PRESET("marimba", marimba_modes),
+    [MODAL_PRESET_VIBES]    = PRESET("vibes", vibes_modes),
+    [MODAL_PRESET_BELL]     = PRESET("bell", bell_modes),
+    [MODAL_PRESET_MEMBRANE] = PRESET("membrane", membrane_modes),
+};
+
+_Static_assert(sizeof(membrane_modes) / sizeof(membrane_modes[0]) == MODAL_MAX_MODES,
+               "The largest preset fills a voice");
+
+static modal_note_t*  notes       = NULL;  // In PSRAM, every preset and note; read once per strike
+static modal_lanes_t* lanes       = NULL;  // The pass, group_count groups in use
+static uint8_t*       lane_voice  = NULL;  // Voice of each group
+static modal_voice_t* voices      = NULL;
+static float*         output      = NULL;  // MODAL_CHUNK frames per voice
+static int            voice_count = 0;
+static int            group_count = 0;
+static modal_stats_t  stats;
+
+// Helper function: Work out the modes of every note of every preset
+static void init_notes(void) {
+    const float two_pi = 6.28318531f;
+    for (int preset = 0; preset < MODAL_PRESET_COUNT; preset++) {
+        const modal_preset_def_t* def = &presets[preset];
+
+        float power = 0.0f;
+        for (int i = 0; i < def->count; i++) power += def->modes[i].level * def->modes[i].level;
+        const float scale = MODAL_LEVEL / sqrtf(power);
+
+        for (int n = 0; n < NUM_NOTES; n++) {
+            const float   frequency = note_defs[n].frequency;
+            const float   stretch   = sqrtf(MODAL_ROOT_HZ / frequency);  // Decay times of this note
+            modal_note_t* note      = &notes[preset * NUM_NOTES + n];
+            note->count             = 0;
+            for (int i = 0; i < def->count; i++) {
+                const modal_mode_t* mode = &def->modes[i];
+                const float         hz   = frequency * mode->ratio;
+                if (hz > MODAL_MAX_HZ) continue;
+                const float w = two_pi * hz / SAMPLE_RATE;
+
+                note->modes[note->count++] = (modal_coeffs_t){
+                    .cos_w      = cosf(w),
+                    .sin_w      = sinf(w),
+                    .rate       = LN_1000 / (mode->decay_s * stretch * SAMPLE_RATE),
+                    .level      = mode->level * scale,
+                    .log2_ratio = fmaxf(log2f(mode->ratio), 0.0f),
+                };
+            }
+        }
+    }
+}
+
+bool modal_init(int voices_needed) {
+    const int groups = voices_needed * (MODAL_MAX_MODES / MODAL_LANES);
+    notes      = dsp_arena_alloc(DSP_ARENA_BULK, sizeof(modal_note_t) * MODAL_PRESET_COUNT * NUM_NOTES, "modal notes");
+    lanes      = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(modal_lanes_t) * groups, "modal modes");
+    lane_voice = dsp_arena_alloc(DSP_ARENA_FAST, groups, "modal modes");
+    voices     = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(modal_voice_t) * voices_needed, "modal voices");
+    output     = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * MODAL_CHUNK * voices_needed, "modal out");
+    if (notes == NULL || lanes == NULL || lane_voice == NULL || voices == NULL || output == NULL) return false;
+    voice_count = voices_needed;
+    init_notes();
+    return true;
+}
+
+void modal_params_default(modal_params_t* params) {
+    *params = (modal_params_t){
+        .preset   = MODAL_PRESET_BELL,
+        .hardness = 0.7f,
+        .decay    = 1.0f,
+    };
+}
+
+bool modal_params_valid(const modal_params_t* params) {
+    if (params->preset < 0 || params->preset >= MODAL_PRESET_COUNT) return false;
+    if (!(params->hardness >= 0.0f && params->hardness <= 1.0f)) return false;
+    if (!(params->decay >= 0.25f && params->decay <= 4.0f)) return false;
+    return true;
+}
+
+const char* modal_preset_name(modal_preset_t preset) {
+    if (preset < 0 || preset >= MODAL_PRESET_COUNT) return "?";
+    return presets[preset].name;
+}
+
+modal_preset_t modal_preset_from_name(const char* name) {
+    for (int preset = 0; preset < MODAL_PRESET_COUNT; preset++) {
+        if (strcmp(name, presets[preset].name) == 0) return preset;
+    }
+    return MODAL_PRESET_COUNT;
+}
+
+int modal_preset_modes(modal_preset_t preset) {
+    if (preset < 0 || preset >= MODAL_PRESET_COUNT) return 0;
+    return presets[preset].count;
+}
+
+// Helper function: Set one lane to a mode and strike it, 'softness' being the exponent of the octave weighting
+// The mallet damps what still rings to half, so striking a note again and again stays within twice its level
+static inline void strike_lane(modal_lanes_t* group, int lane, const modal_coeffs_t* mode, float inverse_decay,
+                               float softness) {
+    const float r   = decay_factor(fminf(mode->rate * inverse_decay, MODAL_MAX_RATE));
+    group->c1[lane] = 2.0f * r * mode->cos_w;
+    group->c2[lane] = r * r;
+    group->y1[lane] = 0.5f * group->y1[lane] + mode->level * exp2_approx(softness * mode->log2_ratio) * mode->sin_w;
+    group->y2[lane] = 0.5f * group->y2[lane];
+}
+
+void modal_voice_strike(int voice_index, int note_index, const modal_params_t* params) {
+    if (note_index < 0 || note_index >= NUM_NOTES) return;
+    const modal_note_t* note   = &notes[params->preset * NUM_NOTES + note_index];
+    const int           groups = (note->count + MODAL_LANES - 1) / MODAL_LANES;
+    modal_voice_t*      voice  = &voices[voice_index];
+
+    // Join the end of the pass, or start over there if the note needs another number of groups
+    if (voice->groups != groups) {
+        modal_voice_stop(voice_index);
+        memset(&lanes[group_count], 0, sizeof(modal_lanes_t) * groups);
+        memset(&lane_voice[group_count], voice_index, groups);
+        voice->first  = group_count;
+        voice->groups = groups;
+        group_count  += groups;
+    }
+    stats.modes  += note->count - voice->modes;
+    voice->modes  = note->count;
+    if (stats.modes > stats.peak) stats.peak = stats.modes;
+    stats.strikes++;
+
+    // The softest mallet weights every octave above the note by 1/4, the hardest leaves the levels alone
+    const float inverse_decay = 1.0f / params->decay;
+    const float softness      = -2.0f * (1.0f - params->hardness);
+    for (int i = 0; i < groups * MODAL_LANES; i++) {
+        modal_lanes_t* group = &lanes[voice->first + i / MODAL_LANES];
+        const int      lane  = i % MODAL_LANES;
+        if (i < note->count) {
+            strike_lane(group, lane, &note->modes[i], inverse_decay, softness);
+        } else {
+            group->c1[lane] = 0.0f;  // Padding, silent from the next frame on
+            group->c2[lane] = 0.0f;
+        }
+    }
+}
+
+void modal_voice_stop(int voice_index) {
+    modal_voice_t* voice = &voices[voice_index];
+    if (voice->groups == 0) return;
+
+    const int end = voice->first + voice->groups;
+    memmove(&lanes[voice->first], &lanes[end], sizeof(modal_lanes_t) * (group_count - end));
+    memmove(&lane_voice[voice->first], &lane_voice[end], group_count - end);
+    for (int i = 0; i < voice_count; i++) {
+        if (voices[i].groups > 0 && voices[i].first > voice->first) voices[i].first -= voice->groups;
+    }
+    group_count  -= voice->groups;
+    stats.modes  -= voice->modes;
+    voice->groups = 0;
+    voice->modes  = 0;
+}
+
+bool modal_voice_active(int voice_index) {
+    return voices[voice_index].groups > 0;
+}
+
+// Helper function: Add 'frames' frames of 'count' lane groups to the outputs of their voices
+// The lanes of a group are written out one by one so that their coefficients and state stay in registers
+static void render_lanes(modal_lanes_t* groups, const uint8_t* owners, int count, float* out, int frames) {
+    for (int g = 0; g < count; g++) {
+        modal_lanes_t* group     = &groups[g];
+        float*         voice_out = out + owners[g] * MODAL_CHUNK;
+
+        const float c1_0 = group->c1[0], c1_1 = group->c1[1], c1_2 = group->c1[2], c1_3 = group->c1[3];
+        const float c2_0 = group->c2[0], c2_1 = group->c2[1], c2_2 = group->c2[2], c2_3 = group->c2[3];
+        float       y1_0 = group->y1[0], y1_1 = group->y1[1], y1_2 = group->y1[2], y1_3 = group->y1[3];
+        float       y2_0 = group->y2[0], y2_1 = group->y2[1], y2_2 = group->y2[2], y2_3 = group->y2[3];
+        for (int i = 0; i < frames; i++) {
+            const float y_0  = c1_0 * y1_0 - c2_0 * y2_0;
+            const float y_1  = c1_1 * y1_1 - c2_1 * y2_1;
+            const float y_2  = c1_2 * y1_2 - c2_2 * y2_2;
+            const float y_3  = c1_3 * y1_3 - c2_3 * y2_3;
+            y2_0             = y1_0;
+            y2_1             = y1_1;
+            y2_2             = y1_2;
+            y2_3             = y1_3;
+            y1_0             = y_0;
+            y1_1             = y_1;
+            y1_2             = y_2;
+            y1_3             = y_3;
+            voice_out[i]    += (y_0 + y_1) + (y_2 + y_3);
+        }
+        group->y1[0] = y1_0;
+        group->y1[1] = y1_1;
+        group->y1[2] = y1_2;
+        group->y1[3] = y1_3;
+        group->y2[0] = y2_0;
+        group->y2[1] = y2_1;
+        group->y2[2] = y2_2;
+        group->y2[3] = y2_3;
+
+        for (int lane = 0; lane < MODAL_LANES; lane++) {
+            if (fabsf(group->y1[lane]) + fabsf(group->y2[lane]) < MODAL_SILENCE) {
+                group->y1[lane] = 0.0f;
+                group->y2[lane] = 0.0f;
+            }
+        }
+    }
+}
+
+void modal_render(int frames) {
+    for (int i = 0; i < voice_count; i++) {
+        if (voices[i].groups > 0) memset(&output[i * MODAL_CHUNK], 0, sizeof(float) * frames);
+    }
+    render_lanes(lanes, lane_voice, group_count, output, frames);
+}
+
+const float* modal_voice_output(int voice_index) {
+    return &output[voice_index * MODAL_CHUNK];
+}
+
+void modal_get_stats(modal_stats_t* out) {
+    *out = stats;
+}
+
+uint32_t modal_bench(int blocks) {
+    static float buffer[MAX_ACTIVE_NOTES * MODAL_CHUNK];
+    const int    groups_per_voice = MODAL_MAX_MODES / MODAL_LANES;
+    const int    count            = MAX_ACTIVE_NOTES * groups_per_voice;
+    if (notes == NULL) return 0;
+
+    // Lane groups in internal RAM like the real pass, freed again after the run
+    modal_lanes_t* groups = heap_caps_malloc(sizeof(modal_lanes_t) * count, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    uint8_t*       owners = heap_caps_malloc(count, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (groups == NULL || owners == NULL) {
+        heap_caps_free(groups);
+        heap_caps_free(owners);
+        return 0;
+    }
+    memset(groups, 0, sizeof(modal_lanes_t) * count);
+
+    // Every voice plays a membrane note, whose 32 modes all stay below MODAL_MAX_HZ; struck again every
+    // 64 blocks so the modes keep ringing instead of settling to zero
+    int64_t start = esp_timer_get_time();
+    for (int block = 0; block < blocks; block++) {
+        if (block % 64 == 0) {
+            for (int i = 0; i < count * MODAL_LANES; i++) {
+                const int           voice = i / MODAL_MAX_MODES;
+                const modal_note_t* note  = &notes[MODAL_PRESET_MEMBRANE * NUM_NOTES + voice % NUM_NOTES];
+                strike_lane(&groups[i / MODAL_LANES], i % MODAL_LANES, &note->modes[i % MODAL_MAX_MODES], 1.0f,
+                            -0.6f);  // Hardness 0.7
+                owners[i / MODAL_LANES] = voice;
+            }
+        }
+        for (int done = 0; done < FRAMES_PER_WRITE; done += MODAL_CHUNK) {
+            const int frames = FRAMES_PER_WRITE - done < MODAL_CHUNK ? FRAMES_PER_WRITE - done : MODAL_CHUNK;
+            memset(buffer, 0, sizeof(buffer));
+            render_lanes(groups, owners, count, buffer, frames);
+        }
+    }
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    heap_caps_free(groups);
+    heap_caps_free(owners);
+    return elapsed;
+}
@@ -0,0 +1,90 @@
+// Modal voice engine: struck resonator banks for bells and mallets
+//
+// With the modal engine selected (synth_set_engine()), every note strikes a
+// bank of two-pole resonators, one per mode of the instrument, instead of
+// playing the waveform. A preset is a table of modes: frequency ratio to the
+// note, decay time and level, 8 to MODAL_MAX_MODES of them. The strike is an
+// impulse into every resonator of the note, weighted by the mallet hardness
+// (a soft mallet hardly excites the high modes); striking a note that still
+// rings damps it to half and adds to what is left. The voice's ADSR envelope
+// then shapes the voice like any other note, so holding a key lets the modes
+// ring out and releasing it damps them.
+//
+// The resonators of all voices live side by side in one array, in groups of
+// MODAL_LANES modes of one voice (the lanes of a vector unit), and all of
+// them are run in one pass over the array per chunk of at most MODAL_CHUNK
+// frames. A group keeps the coefficients and state of its modes in registers
+// through the whole chunk and only adds their sum to its voice's output.
+
+#ifndef MODAL_H
+#define MODAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define MODAL_MAX_MODES 32  // Modes per voice, a multiple of MODAL_LANES
+#define MODAL_LANES     4   // Modes run side by side
+#define MODAL_CHUNK     64  // Most frames rendered in one pass
+
+typedef enum {
+    MODAL_PRESET_MARIMBA = 0,  // Tuned bar, 8 modes, short and woody
+    MODAL_PRESET_VIBES,        // Aluminium bar tuned 1:4:10, 12 modes, long
+    MODAL_PRESET_BELL,         // Church bell partials from the hum up, 16 modes
+    MODAL_PRESET_MEMBRANE,     // Circular membrane, 32 inharmonic modes
+    MODAL_PRESET_COUNT
+} modal_preset_t;
+
+// Settings, any value in range may change at any time; they apply from the next strike on
+typedef struct {
+    modal_preset_t preset;
+    float          hardness;  // Mallet hardness, 0 (soft, mostly the low modes) .. 1 (every mode at its level)
+    float          decay;     // Scale of the preset's decay times (0.25 .. 4)
+} modal_params_t;
+
+typedef struct {
+    uint32_t strikes;  // Notes struck since startup
+    int      modes;    // Modes sounding now, all voices together
+    int      peak;     // Most modes sounding at once
+} modal_stats_t;
+
+// Work out the resonator coefficients of every preset and note, and carve the state; call once after
+// dsp_arena_init()
+bool modal_init(int voices);
+
+// Settings as the engine starts up with
+void modal_params_default(modal_params_t* params);
+
+// Check that all settings are in range
+bool modal_params_valid(const modal_params_t* params);
+
+// Human readable name ("marimba", "vibes", "bell", "membrane") and back (MODAL_PRESET_COUNT if unknown)
+const char*    modal_preset_name(modal_preset_t preset);
+modal_preset_t modal_preset_from_name(const char* name);
+
+// Modes of a preset as listed in its table (high notes drop the ones that would come too close to Nyquist)
+int modal_preset_modes(modal_preset_t preset);
+
+// Strike note 'note_index' on a voice; a voice that is not sounding yet joins the pass
+// Audio task only, like every function below that changes voices
+void modal_voice_strike(int voice, int note_index, const modal_params_t* params);
+
+// Take a voice out of the pass, once it fell idle or the engine was switched away
+void modal_voice_stop(int voice);
+
+// True while a voice is in the pass
+bool modal_voice_active(int voice);
+
+// Render 'frames' frames (at most MODAL_CHUNK) of every voice in the pass in one go
+void modal_render(int frames);
+
+// Output of a voice in the last modal_render() (mono, 'frames' samples)
+const float* modal_voice_output(int voice);
+
+// Copy the statistics
+void modal_get_stats(modal_stats_t* stats);
+
+// Benchmark: time 'blocks' blocks of FRAMES_PER_WRITE frames with MAX_ACTIVE_NOTES voices of MODAL_MAX_MODES
+// modes each, returns microseconds
+uint32_t modal_bench(int blocks);
+
+#endif  // MODAL_H
@@ -0,0 +1,278 @@
+// Network MIDI: note events over UDP with a jitter buffer
+
+#include "net_midi.h"
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_netif.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "keyboard_notes.h"
+#include "lwip/sockets.h"
+#include "synth.h"
+#include "wifi_connection.h"
+#include "wifi_remote.h"
+
+#define HEADER_BYTES     12
+#define EVENT_BYTES      8
+#define MIDI_NOTE_FIRST  60        // MIDI note of note_defs semitone 0 (middle C)
+#define SENDER_RESYNC_US 10000000  // Sender clock jump taken as a restart of the sender
+#define SEQUENCE_RESYNC  1000      // Sequence jump taken as a restart of the sender
+
+static const char* TAG = "net_midi";
+
+// Mapping of the sender clock onto esp_timer time (network task)
+// 'offset' is arrival time minus sender time; its minimum over a sliding window is the packet that
+// waited least on the way, everything above that minimum is network jitter
+typedef struct {
+    bool     synced;         // A packet has been seen since the last restart
+    uint32_t sender_last;    // Sender clock of the last packet, as sent (wraps)
+    int64_t  sender_time;    // ... unwrapped
+    uint16_t sequence_last;  // Sequence number of the newest packet
+    int64_t  window_start;   // Arrival time the current window started
+    int64_t  offset_min;     // Smallest offset in the current window
+    int64_t  offset_prev;    // Smallest offset in the previous window
+    int64_t  transit_last;   // Transit of the last packet, for the jitter estimate
+    float    jitter;         // RFC 3550 interarrival jitter in microseconds
+} sender_clock_t;
+
+static sender_clock_t    sender_clock;
+static net_midi_stats_t  stats;              // Written by the network task only, under 'stats_seq'
+static atomic_uint       stats_seq     = 0;  // Odd while the network task updates 'stats'
+static volatile uint32_t playout_delay = NET_MIDI_DEFAULT_DELAY;
+static volatile bool     reset_request = false;
+static int8_t            midi_note_index[128];  // MIDI note number to note index
+
+// Helper function: Open (odd sequence number) and close (even again) an update of the statistics
+static void begin_stats_write(void) {
+    unsigned seq = atomic_load_explicit(&stats_seq, memory_order_relaxed);
+    atomic_store_explicit(&stats_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void end_stats_write(void) {
+    unsigned seq = atomic_load_explicit(&stats_seq, memory_order_relaxed);
+    atomic_store_explicit(&stats_seq, seq + 1, memory_order_release);
+}
+
+// Helper function: Read a little-endian integer of 'bytes' bytes
+static uint32_t read_le(const uint8_t* data, int bytes) {
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--) value = (value << 8) | data[i];
+    return value;
+}
+
+// Helper function: Map MIDI notes onto the 13 keys, folding other octaves into the keyboard's one
+static void build_note_map(void) {
+    for (int midi = 0; midi < 128; midi++) {
+        int semitone = midi - MIDI_NOTE_FIRST;
+        if (semitone < 0 || semitone > 12) semitone = ((semitone % 12) + 12) % 12;
+        midi_note_index[midi] = -1;
+        for (int i = 0; i < NUM_NOTES; i++) {
+            if (note_defs[i].semitone == semitone) midi_note_index[midi] = (int8_t)i;
+        }
+    }
+}
+
+// Helper function: Smallest offset over the last half to full window
+static inline int64_t clock_base(const sender_clock_t* clock) {
+    return clock->offset_min < clock->offset_prev ? clock->offset_min : clock->offset_prev;
+}
+
+// Helper function: Fold the sender clock of a packet into the mapping, returns the sender time unwrapped
+static int64_t update_sender_clock(uint16_t sequence, uint32_t sender, int64_t arrival) {
+    sender_clock_t* clock = &sender_clock;
+
+    // A sender that restarted (or a different sender) starts a new mapping
+    int32_t sender_step   = (int32_t)(sender - clock->sender_last);
+    int16_t sequence_step = (int16_t)(sequence - (uint16_t)(clock->sequence_last + 1));
+    if (clock->synced && (abs(sender_step) > SENDER_RESYNC_US || abs(sequence_step) > SEQUENCE_RESYNC)) {
+        ESP_LOGI(TAG, "Sender restarted, resynchronising");
+        clock->synced = false;
+    }
+    if (!clock->synced) {
+        *clock = (sender_clock_t){
+            .synced        = true,
+            .sender_last   = sender,
+            .sender_time   = sender,
+            .sequence_last = sequence,
+            .window_start  = arrival,
+            .offset_min    = arrival - (int64_t)sender,
+            .offset_prev   = arrival - (int64_t)sender,
+        };
+        sequence_step = 0;
+        sender_step   = 0;
+    }
+
+    // Sequence gaps are lost packets, until the missing packet turns up late
+    if (sequence_step > 0) {
+        stats.lost += sequence_step;
+    } else if (sequence_step < 0) {
+        stats.reordered++;
+        if (stats.lost > 0) stats.lost--;
+    }
+    if (sequence_step >= 0) clock->sequence_last = sequence;
+
+    int64_t sender_time = clock->sender_time + sender_step;
+    if (sender_step > 0) {
+        clock->sender_last = sender;
+        clock->sender_time = sender_time;
+    }
+
+    // Two half windows: the minimum always covers between half and all of NET_MIDI_WINDOW_US, so
+    // the mapping follows clock drift and route changes without forgetting the fastest packet at once
+    int64_t offset = arrival - sender_time;
+    if (arrival - clock->window_start > NET_MIDI_WINDOW_US / 2) {
+        clock->offset_prev  = clock->offset_min;
+        clock->offset_min   = offset;
+        clock->window_start = arrival;
+    } else if (offset < clock->offset_min) {
+        clock->offset_min = offset;
+    }
+    if (offset < clock->offset_prev) clock->offset_prev = offset;
+
+    int64_t transit = offset - clock_base(clock);
+    clock->jitter += ((float)llabs(transit - clock->transit_last) - clock->jitter) / 16.0f;
+    clock->transit_last = transit;
+
+    stats.transit_us_last = (uint32_t)transit;
+    stats.transit_us_avg =
+        (uint32_t)(((uint64_t)stats.transit_us_avg * stats.packets + (uint64_t)transit) / (stats.packets + 1));
+    if (stats.transit_us_last > stats.transit_us_max) stats.transit_us_max = stats.transit_us_last;
+    stats.jitter_us = (uint32_t)clock->jitter;
+    stats.packets++;
+    return sender_time;
+}
+
+// Helper function: Check one datagram and schedule its note events
+static void handle_packet(const uint8_t* packet, int length, int64_t arrival) {
+    if (length < HEADER_BYTES || memcmp(packet, "NMID", 4) != 0) {
+        stats.invalid++;
+        return;
+    }
+    int count = packet[6];
+    if (count > NET_MIDI_MAX_EVENTS || length != HEADER_BYTES + count * EVENT_BYTES) {
+        stats.invalid++;
+        return;
+    }
+
+    uint32_t sender      = read_le(packet + 8, 4);
+    int64_t  sender_time = update_sender_clock((uint16_t)read_le(packet + 4, 2), sender, arrival);
+
+    // Sender time + the window's smallest offset is the earliest the event could have arrived,
+    // the playout delay on top leaves room for the packets that take longer
+    int64_t anchor = clock_base(&sender_clock) + playout_delay;
+
+    for (int i = 0; i < count; i++) {
+        const uint8_t* event  = packet + HEADER_BYTES + i * EVENT_BYTES;
+        int32_t        ahead  = (int32_t)(read_le(event, 4) - sender);
+        uint8_t        status = event[4] & 0xF0;
+        int            note   = midi_note_index[event[5] & 0x7F];
+        if (note < 0 || (status != 0x80 && status != 0x90)) continue;
+
+        // Events far ahead would sit in the synth's short schedule for minutes and crowd out the rest
+        if (ahead > NET_MIDI_MAX_AHEAD) {
+            stats.too_far_ahead++;
+            continue;
+        }
+
+        // Note on with velocity 0 is a note off (running status senders use it)
+        bool on = status == 0x90 && event[6] > 0;
+        if (synth_schedule_note(note, on, sender_time + ahead + anchor)) stats.events++;
+    }
+}
+
+// Helper function: Log the address to send to
+static void log_address(void) {
+    esp_netif_ip_info_t ip_info;
+    esp_netif_t*        netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+    if (netif != NULL && esp_netif_get_ip_info(netif, &ip_info) == ESP_OK) {
+        ESP_LOGI(TAG, "Listening on " IPSTR ":%d", IP2STR(&ip_info.ip), NET_MIDI_PORT);
+    } else {
+        ESP_LOGI(TAG, "Listening on UDP port %d", NET_MIDI_PORT);
+    }
+}
+
+static void net_midi_task(void* arg) {
+    // Wi-Fi runs on the radio coprocessor, connected with the networks stored by the launcher
+    if (wifi_remote_initialize() != ESP_OK) {
+        ESP_LOGW(TAG, "No Wi-Fi radio, network MIDI disabled");
+        vTaskDelete(NULL);
+    }
+    wifi_connection_init_stack();
+    if (wifi_connect_try_all() != ESP_OK) {
+        ESP_LOGW(TAG, "No stored Wi-Fi network in range, network MIDI disabled");
+        vTaskDelete(NULL);
+    }
+
+    int                sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct sockaddr_in addr = {
+        .sin_family      = AF_INET,
+        .sin_port        = htons(NET_MIDI_PORT),
+        .sin_addr.s_addr = htonl(INADDR_ANY),
+    };
+    if (sock < 0 || bind(sock, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+        ESP_LOGE(TAG, "Failed to bind UDP port %d", NET_MIDI_PORT);
+        if (sock >= 0) close(sock);
+        vTaskDelete(NULL);
+    }
+    log_address();
+    begin_stats_write();
+    stats.listening = true;
+    end_stats_write();
+
+    // One byte more than the largest packet, so oversized datagrams fail the length check
+    static uint8_t packet[HEADER_BYTES + NET_MIDI_MAX_EVENTS * EVENT_BYTES + 1];
+    while (1) {
+        int     length  = recv(sock, packet, sizeof(packet), 0);
+        int64_t arrival = esp_timer_get_time();  // Right after the wakeup, before any parsing
+        if (length < 0) {
+            vTaskDelay(pdMS_TO_TICKS(100));
+            continue;
+        }
+        begin_stats_write();
+        if (reset_request) {
+            memset(&stats, 0, sizeof(stats));
+            stats.listening     = true;
+            sender_clock.synced = false;
+            reset_request       = false;
+        }
+        handle_packet(packet, length, arrival);
+        end_stats_write();
+    }
+}
+
+void net_midi_start(void) {
+    build_note_map();
+
+    // Above the UI on core 0, so arrival times are taken as soon as the packet is in;
+    // the audio task on core 1 is not affected
+    xTaskCreatePinnedToCore(net_midi_task, "net_midi", 4096, NULL, tskIDLE_PRIORITY + 3, NULL, 0);
+}
+
+esp_err_t net_midi_set_delay(uint32_t delay_us) {
+    if (delay_us > NET_MIDI_MAX_DELAY) return ESP_ERR_INVALID_ARG;
+    playout_delay = delay_us;
+    return ESP_OK;
+}
+
+void net_midi_get_stats(net_midi_stats_t* out) {
+    // The network task holds the odd sequence number for one packet; if it was preempted in the
+    // middle, give it a tick to finish
+    while (1) {
+        unsigned before = atomic_load_explicit(&stats_seq, memory_order_acquire);
+        if ((before & 1) == 0) {
+            memcpy(out, &stats, sizeof(*out));
+            atomic_thread_fence(memory_order_acquire);
+            if (atomic_load_explicit(&stats_seq, memory_order_relaxed) == before) break;
+        }
+        vTaskDelay(1);
+    }
+    out->playout_delay_us = playout_delay;
+}
+
+void net_midi_reset_stats(void) {
+    reset_request = true;
+}
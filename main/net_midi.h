@@ -0,0 +1,71 @@
+// Network MIDI: play the synth from a laptop or another badge over UDP
+//
+// A sender streams note events in small UDP datagrams to NET_MIDI_PORT. Every
+// datagram carries the sender's clock, and every event the sender time it is
+// meant to sound. The receiver maps the sender clock onto esp_timer time and
+// holds each event back by a fixed playout delay (the jitter buffer), so events
+// sound with the spacing they were sent with, not the spacing the network
+// delivered them with. The synth then starts each note at its sample frame
+// inside the block (synth_schedule_note()).
+//
+// Packet layout, all fields little-endian:
+//
+//   0   char[4]   magic "NMID"
+//   4   uint16    sequence number, +1 per packet (gaps count as lost packets)
+//   6   uint8     number of events (0 .. NET_MIDI_MAX_EVENTS, 0 = clock only)
+//   7   uint8     reserved, 0
+//   8   uint32    sender clock when the packet was sent, in microseconds (wraps)
+//   12  events, 8 bytes each:
+//       uint32    sender clock time the event should sound (may lie ahead, by at most NET_MIDI_MAX_AHEAD)
+//       uint8[3]  MIDI message: note on (0x9n) or note off (0x8n), note, velocity
+//       uint8     reserved, 0
+//
+// net_midi_send.py sends this format and has a loopback receiver that applies
+// the same clock mapping and statistics on a PC. host/net_midi_test builds
+// this receiver on the PC and plays net_midi_send.py's patterns through it.
+
+#ifndef NET_MIDI_H
+#define NET_MIDI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define NET_MIDI_PORT          5504
+#define NET_MIDI_MAX_EVENTS    32
+#define NET_MIDI_DEFAULT_DELAY 10000  // Playout delay in microseconds
+#define NET_MIDI_MAX_DELAY     200000
+#define NET_MIDI_WINDOW_US     2000000  // Window of the fastest-packet search that anchors the sender clock
+
+// Furthest an event may lie ahead of its packet, later ones are dropped
+#define NET_MIDI_MAX_AHEAD (NET_MIDI_MAX_DELAY + NET_MIDI_WINDOW_US)
+
+// Receiver statistics, updated by the network task for every packet
+typedef struct {
+    bool     listening;         // Wi-Fi is up and the socket is bound
+    uint32_t packets;           // Valid packets received
+    uint32_t invalid;           // Datagrams that were not network MIDI packets
+    uint32_t lost;              // Packets missing from the sequence
+    uint32_t reordered;         // Packets that arrived after a later one
+    uint32_t events;            // Note events handed to the synth
+    uint32_t too_far_ahead;     // Note events dropped for lying more than NET_MIDI_MAX_AHEAD ahead of their packet
+    uint32_t transit_us_last;   // Delay of the last packet above the fastest one in the window
+    uint32_t transit_us_avg;    // ... running average
+    uint32_t transit_us_max;    // ... worst case
+    uint32_t jitter_us;         // Interarrival jitter estimate (RFC 3550)
+    uint32_t playout_delay_us;  // Current jitter buffer depth
+} net_midi_stats_t;
+
+// Bring up Wi-Fi with the stored network settings and start listening, in a task on core 0
+void net_midi_start(void);
+
+// Jitter buffer depth, events arriving later than this after the fastest packet play late
+esp_err_t net_midi_set_delay(uint32_t delay_us);
+
+// Copy the current statistics
+void net_midi_get_stats(net_midi_stats_t* stats);
+
+// Clear the statistics (done by the network task before the next packet)
+void net_midi_reset_stats(void);
+
+#endif  // NET_MIDI_H
@@ -0,0 +1,98 @@
+// Output stage: float mix to I2S sample format conversion
+//
+// The dither generator runs DITHER_LANES independent xorshift32 generators side
+// by side. Every lane only uses shifts and xors on its own state, so the inner
+// loops have no cross-lane dependency and the compiler can unroll or vectorise
+// them. One 32-bit random word yields a full TPDF value: the difference of its
+// two 16-bit halves is triangularly distributed over +/-1 LSB.
+
+#include "output_stage.h"
+#include <math.h>
+
+#define DITHER_LANES 4
+
+static uint32_t dither_state[DITHER_LANES] = {0x9E3779B9, 0x7F4A7C15, 0x85EBCA6B, 0xC2B2AE35};
+
+static const char* const format_names[OUTPUT_FORMAT_COUNT] = {
+    [OUTPUT_FORMAT_16] = "16",
+    [OUTPUT_FORMAT_24] = "24",
+    [OUTPUT_FORMAT_32] = "32",
+};
+
+int output_format_bytes(output_format_t format) {
+    return format == OUTPUT_FORMAT_16 ? sizeof(int16_t) : sizeof(int32_t);
+}
+
+i2s_data_bit_width_t output_format_bit_width(output_format_t format) {
+    return format == OUTPUT_FORMAT_16 ? I2S_DATA_BIT_WIDTH_16BIT : I2S_DATA_BIT_WIDTH_32BIT;
+}
+
+const char* output_format_name(output_format_t format) {
+    if (format < 0 || format >= OUTPUT_FORMAT_COUNT) return "?";
+    return format_names[format];
+}
+
+// Helper function: Advance one dither lane and return TPDF noise in LSB units (-1.0 to 1.0)
+static inline float dither_next(uint32_t* state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (float)((int32_t)(x >> 16) - (int32_t)(x & 0xFFFF)) * (1.0f / 65536.0f);
+}
+
+// Helper function: Gain, dither, clip and round one sample to a signed integer of 'scale' full range
+static inline int32_t quantize(float sample, float gain, float scale, float dither) {
+    float value = sample * gain * scale + dither;
+    value       = fminf(scale, fmaxf(-scale - 1.0f, value));
+    return (int32_t)lrintf(value);
+}
+
+void output_stage_process(output_format_t format, const float* in, void* out, int samples, float gain) {
+    uint32_t lanes[DITHER_LANES];
+    for (int lane = 0; lane < DITHER_LANES; lane++) lanes[lane] = dither_state[lane];
+
+    int i = 0;
+    switch (format) {
+        case OUTPUT_FORMAT_16: {
+            int16_t* dst = (int16_t*)out;
+            for (; i + DITHER_LANES <= samples; i += DITHER_LANES) {
+                for (int lane = 0; lane < DITHER_LANES; lane++) {
+                    dst[i + lane] = (int16_t)quantize(in[i + lane], gain, 32767.0f, dither_next(&lanes[lane]));
+                }
+            }
+            for (; i < samples; i++) {
+                dst[i] = (int16_t)quantize(in[i], gain, 32767.0f, dither_next(&lanes[0]));
+            }
+            break;
+        }
+
+        case OUTPUT_FORMAT_24: {
+            // 24-bit value left-justified in the 32-bit slot
+            int32_t* dst = (int32_t*)out;
+            for (; i + DITHER_LANES <= samples; i += DITHER_LANES) {
+                for (int lane = 0; lane < DITHER_LANES; lane++) {
+                    dst[i + lane] = quantize(in[i + lane], gain, 8388607.0f, dither_next(&lanes[lane])) * 256;
+                }
+            }
+            for (; i < samples; i++) {
+                dst[i] = quantize(in[i], gain, 8388607.0f, dither_next(&lanes[0])) * 256;
+            }
+            break;
+        }
+
+        case OUTPUT_FORMAT_32:
+        default: {
+            // Largest float below 2^31, so a full scale sample cannot overflow the conversion
+            int32_t* dst = (int32_t*)out;
+            for (; i < samples; i++) {
+                float value = fminf(1.0f, fmaxf(-1.0f, in[i] * gain));
+                dst[i]      = (int32_t)lrintf(value * 2147483520.0f);
+            }
+            break;
+        }
+    }
+
+    for (int lane = 0; lane < DITHER_LANES; lane++) dither_state[lane] = lanes[lane];
+}
@@ -0,0 +1,35 @@
+// Output stage: float mix to I2S sample format conversion
+//
+// Applies master gain, clipping, TPDF dither and quantisation in a single pass
+// over an interleaved stereo block. 16-bit output is dithered with triangular
+// noise of +/-1 LSB; 24-bit output is dithered at the 24-bit LSB and sent
+// left-justified in a 32-bit slot; 32-bit output is not dithered (the float mix
+// only carries 24 bits of mantissa anyway).
+
+#ifndef OUTPUT_STAGE_H
+#define OUTPUT_STAGE_H
+
+#include <stdint.h>
+#include "driver/i2s_std.h"
+
+typedef enum {
+    OUTPUT_FORMAT_16 = 0,  // 16-bit slots, TPDF dithered (default, matches the BSP setup)
+    OUTPUT_FORMAT_24,      // 24-bit samples in 32-bit slots, TPDF dithered
+    OUTPUT_FORMAT_32,      // 32-bit slots, no dither
+    OUTPUT_FORMAT_COUNT
+} output_format_t;
+
+// Bytes per sample in the buffer handed to i2s_channel_write
+int output_format_bytes(output_format_t format);
+
+// I2S data/slot width needed for a format
+i2s_data_bit_width_t output_format_bit_width(output_format_t format);
+
+// Human readable name ("16", "24", "32")
+const char* output_format_name(output_format_t format);
+
+// Convert 'samples' interleaved float samples (nominally -1.0 to 1.0) into 'out'
+// 'out' must hold samples * output_format_bytes(format) bytes
+void output_stage_process(output_format_t format, const float* in, void* out, int samples, float gain);
+
+#endif  // OUTPUT_STAGE_H
@@ -0,0 +1,275 @@
+// Capture of the audio output over the serial console
+
+#include "pcm_capture.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "dsp_arena.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "synth.h"
+
+#define METHOD_VERBATIM 0
+#define METHOD_ORDER1   1
+#define METHOD_ORDER2   2
+
+#define RECORD_ALIGN       4
+#define RECORD_PAYLOAD_MAX (2 * (2 + MAX_FRAMES_PER_WRITE * 4))  // Two verbatim 32-bit channels and their fields
+#define WRITER_POLL_MS     10
+
+static const char* TAG = "pcm_capture";
+
+// Encoded block in the ring, followed by 'length' payload bytes
+typedef struct {
+    uint16_t length;  // Payload bytes
+    uint16_t frames;
+    uint32_t block;
+    uint32_t underruns;
+    uint32_t rate;
+    uint8_t  bits;  // Sample format: 16, 24 or 32
+} record_header_t;
+
+typedef struct {
+    uint8_t* out;
+    uint64_t acc;   // Bits not yet written, right aligned
+    int      bits;  // Number of bits in 'acc'
+} bit_writer_t;
+
+// Ring of encoded blocks: written by the audio task, read by the writer task
+// A record never wraps; where the rest of the ring is too short for the largest record both sides
+// skip to the start, so no filler has to be written
+static uint8_t*      ring         = NULL;  // PSRAM, only ever touched in order
+static atomic_uint   ring_head    = 0;     // Bytes ever written
+static atomic_uint   ring_tail    = 0;     // Bytes ever read
+static int32_t*      samples_buf  = NULL;  // One channel of the block (fast arena)
+static uint32_t*     residual_buf = NULL;  // Zigzag mapped residuals (fast arena)
+static volatile bool enabled      = false;
+
+static pcm_capture_stats_t stats;
+
+static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Helper function: Append the low 'count' bits (0 to 32) of 'value'
+static inline void put_bits(bit_writer_t* bw, uint32_t value, int count) {
+    bw->acc  = (bw->acc << count) | (value & (uint32_t)((1ull << count) - 1));
+    bw->bits += count;
+    while (bw->bits >= 8) {
+        bw->bits -= 8;
+        *bw->out++ = (uint8_t)(bw->acc >> bw->bits);
+    }
+}
+
+// Helper function: Append one Rice code
+static inline void put_rice(bit_writer_t* bw, uint32_t value, int k) {
+    uint32_t quotient = value >> k;
+    while (quotient >= 32) {
+        put_bits(bw, 0, 32);
+        quotient -= 32;
+    }
+    put_bits(bw, 1, (int)quotient + 1);
+    put_bits(bw, value, k);
+}
+
+// Helper function: Map signed residuals to unsigned ones, small magnitudes first (0, -1, 1, -2, ...)
+static inline uint64_t zigzag(int64_t value) {
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+// Helper function: Code one channel of a block, picking the predictor and Rice parameter that fit it best
+static void encode_channel(bit_writer_t* bw, const void* block, int frames, int channel, bool wide) {
+    int32_t* x        = samples_buf;
+    uint32_t bits_set = 0;
+    if (wide) {
+        const int32_t* in = block;
+        for (int i = 0; i < frames; i++) bits_set |= (uint32_t)(x[i] = in[i * 2 + channel]);
+    } else {
+        const int16_t* in = block;
+        for (int i = 0; i < frames; i++) bits_set |= (uint32_t)(x[i] = in[i * 2 + channel]);
+    }
+
+    // Drop the low bits that are zero throughout (the padding of 24-bit samples, or a silent block)
+    int shift = bits_set == 0 ? 0 : __builtin_ctz(bits_set);
+    if (shift > 0) {
+        for (int i = 0; i < frames; i++) x[i] >>= shift;
+    }
+    int sample_bits = (wide ? 32 : 16) - shift;
+
+    // Cost estimate of both predictors in one pass
+    uint64_t sum1 = 0, sum2 = 0;
+    for (int i = 2; i < frames; i++) {
+        int64_t d1 = (int64_t)x[i] - x[i - 1];
+        int64_t d2 = d1 - ((int64_t)x[i - 1] - x[i - 2]);
+        sum1 += zigzag(d1);
+        sum2 += zigzag(d2);
+    }
+    int      order = sum2 < sum1 ? METHOD_ORDER2 : METHOD_ORDER1;
+    int      count = frames - order;
+    uint64_t mean  = (order == METHOD_ORDER2 ? sum2 : sum1) / (uint64_t)(frames > 2 ? frames - 2 : 1);
+    int      k     = mean == 0 ? 0 : 63 - __builtin_clzll(mean);
+    if (k > 30) k = 30;
+
+    // Residuals, and the exact code size for k and its neighbours
+    uint64_t size[3] = {0, 0, 0};  // k - 1, k, k + 1
+    bool     fits    = true;
+    for (int i = order; i < frames; i++) {
+        int64_t prediction = order == METHOD_ORDER2 ? 2 * (int64_t)x[i - 1] - x[i - 2] : x[i - 1];
+        uint64_t u         = zigzag(x[i] - prediction);
+        if (u > UINT32_MAX) fits = false;
+        residual_buf[i] = (uint32_t)u;
+        size[0] += k > 0 ? u >> (k - 1) : u;
+        size[1] += u >> k;
+        size[2] += u >> (k + 1);
+    }
+    int      best      = k > 0 && size[0] + (uint64_t)count * k < size[1] + (uint64_t)count * (k + 1) ? 0 : 1;
+    uint64_t best_bits = size[best] + (uint64_t)count * (k + best);
+    if (size[2] + (uint64_t)count * (k + 2) < best_bits) {
+        best      = 2;
+        best_bits = size[2] + (uint64_t)count * (k + 2);
+    }
+    k += best - 1;
+
+    if (!fits || best_bits + 5 >= (uint64_t)count * sample_bits) {
+        put_bits(bw, METHOD_VERBATIM, 2);
+        put_bits(bw, (uint32_t)shift, 5);
+        for (int i = 0; i < frames; i++) put_bits(bw, (uint32_t)x[i], sample_bits);
+        return;
+    }
+    put_bits(bw, (uint32_t)order, 2);
+    put_bits(bw, (uint32_t)shift, 5);
+    put_bits(bw, (uint32_t)k, 5);
+    for (int i = 0; i < order; i++) put_bits(bw, (uint32_t)x[i], sample_bits);
+    for (int i = order; i < frames; i++) put_rice(bw, residual_buf[i], k);
+}
+
+void pcm_capture_block(const void* samples, int frames, output_format_t format, uint32_t rate, uint32_t block,
+                       uint32_t underruns) {
+    if (!enabled) return;
+    int64_t start = esp_timer_get_time();
+
+    // Room for the largest possible record in one piece, wrapping to the start of the ring if needed
+    const size_t record_max = sizeof(record_header_t) + RECORD_PAYLOAD_MAX;
+    unsigned     head       = atomic_load_explicit(&ring_head, memory_order_relaxed);
+    unsigned     tail       = atomic_load_explicit(&ring_tail, memory_order_acquire);
+    size_t       space      = PCM_CAPTURE_RING_BYTES - (head - tail);
+    size_t       position   = head % PCM_CAPTURE_RING_BYTES;
+    size_t       contiguous = PCM_CAPTURE_RING_BYTES - position;
+    if (contiguous < record_max) {
+        if (space < contiguous + record_max) {
+            stats.dropped++;
+            return;
+        }
+        head     += contiguous;
+        position  = 0;
+    } else if (space < record_max) {
+        stats.dropped++;
+        return;
+    }
+
+    bool         wide   = format != OUTPUT_FORMAT_16;
+    uint8_t*     record = ring + position;
+    bit_writer_t bw     = {.out = record + sizeof(record_header_t)};
+    encode_channel(&bw, samples, frames, 0, wide);
+    encode_channel(&bw, samples, frames, 1, wide);
+    if (bw.bits > 0) put_bits(&bw, 0, 8 - bw.bits);
+
+    size_t length = bw.out - (record + sizeof(record_header_t));
+    *(record_header_t*)record = (record_header_t){
+        .length    = (uint16_t)length,
+        .frames    = (uint16_t)frames,
+        .block     = block,
+        .underruns = underruns,
+        .rate      = rate,
+        .bits      = (uint8_t)(format == OUTPUT_FORMAT_16 ? 16 : format == OUTPUT_FORMAT_24 ? 24 : 32),
+    };
+    size_t record_bytes = (sizeof(record_header_t) + length + RECORD_ALIGN - 1) & ~(size_t)(RECORD_ALIGN - 1);
+    atomic_store_explicit(&ring_head, head + record_bytes, memory_order_release);
+
+    uint32_t encode_us = (uint32_t)(esp_timer_get_time() - start);
+    if (encode_us > stats.encode_us_max) stats.encode_us_max = encode_us;
+    stats.blocks++;
+    stats.raw_bytes   += (uint64_t)frames * 2 * output_format_bytes(format);
+    stats.coded_bytes += length;
+}
+
+// Helper function: Print a buffer as base64, in pieces so no large line buffer is needed
+static void print_base64(const uint8_t* data, size_t length) {
+    char piece[64];
+    int  used = 0;
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t group = (uint32_t)data[i] << 16;
+        if (i + 1 < length) group |= (uint32_t)data[i + 1] << 8;
+        if (i + 2 < length) group |= data[i + 2];
+        piece[used++] = base64_chars[(group >> 18) & 63];
+        piece[used++] = base64_chars[(group >> 12) & 63];
+        piece[used++] = i + 1 < length ? base64_chars[(group >> 6) & 63] : '=';
+        piece[used++] = i + 2 < length ? base64_chars[group & 63] : '=';
+        if (used == 64) {
+            fwrite(piece, 1, used, stdout);
+            used = 0;
+        }
+    }
+    fwrite(piece, 1, used, stdout);
+}
+
+// Prints encoded blocks as they come in, at low priority on core 0
+static void writer_task(void* arg) {
+    while (1) {
+        unsigned tail = atomic_load_explicit(&ring_tail, memory_order_relaxed);
+        unsigned head = atomic_load_explicit(&ring_head, memory_order_acquire);
+        if (tail == head) {
+            vTaskDelay(pdMS_TO_TICKS(WRITER_POLL_MS));
+            continue;
+        }
+
+        size_t                 position   = tail % PCM_CAPTURE_RING_BYTES;
+        size_t                 contiguous = PCM_CAPTURE_RING_BYTES - position;
+        const record_header_t* record     = (const record_header_t*)(ring + position);
+        if (contiguous < sizeof(record_header_t) + RECORD_PAYLOAD_MAX) {
+            // The audio task skipped the rest of the ring here
+            atomic_store_explicit(&ring_tail, tail + contiguous, memory_order_release);
+            continue;
+        }
+
+        printf("PCM %lu %lu %lu %u %u ", (unsigned long)record->block, (unsigned long)record->underruns,
+               (unsigned long)record->rate, record->bits, record->frames);
+        print_base64((const uint8_t*)(record + 1), record->length);
+        printf("\n");
+
+        size_t record_bytes =
+            (sizeof(record_header_t) + record->length + RECORD_ALIGN - 1) & ~(size_t)(RECORD_ALIGN - 1);
+        atomic_store_explicit(&ring_tail, tail + record_bytes, memory_order_release);
+    }
+}
+
+esp_err_t pcm_capture_enable(bool enable) {
+    if (enable && ring == NULL) {
+        // Encoding touches the block twice per sample, the ring is written once in order
+        if (samples_buf == NULL) {
+            samples_buf = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(int32_t) * MAX_FRAMES_PER_WRITE, "capture samples");
+        }
+        if (residual_buf == NULL) {
+            residual_buf = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(uint32_t) * MAX_FRAMES_PER_WRITE, "capture residuals");
+        }
+        if (samples_buf == NULL || residual_buf == NULL) return ESP_ERR_NO_MEM;
+        ring = dsp_arena_alloc(DSP_ARENA_BULK, PCM_CAPTURE_RING_BYTES, "capture ring");
+        if (ring == NULL) return ESP_ERR_NO_MEM;
+
+        // Below the UI on core 0: a slow console drops capture blocks, never audio or frames
+        if (xTaskCreatePinnedToCore(writer_task, "pcm_capture", 3072, NULL, tskIDLE_PRIORITY + 1, NULL, 0) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to start the writer task");
+            return ESP_FAIL;
+        }
+    }
+    if (enable && !enabled) {
+        memset(&stats, 0, sizeof(stats));
+    }
+    enabled       = enable;
+    stats.enabled = enable;
+    return ESP_OK;
+}
+
+void pcm_capture_get_stats(pcm_capture_stats_t* out) {
+    *out = stats;
+}
@@ -0,0 +1,57 @@
+// Capture of the audio output over the serial console
+//
+// While enabled, every block handed to i2s_channel_write is compressed in the
+// audio task and printed by a low priority task on core 0 as one text line:
+//
+//   PCM <block> <underruns> <rate> <bits> <frames> <base64 payload>
+//
+// <block> counts every block the synth rendered, so blocks the capture had to
+// drop (the console could not keep up) show up as gaps. <underruns> is the I2S
+// underrun counter after the block. Capture the console with
+//     idf.py monitor | tee capture.log
+// and rebuild the audio with pcm_capture_to_wav.py, which marks dropped blocks
+// and underruns.
+//
+// Payload: for the left then the right channel, MSB first bit fields
+//   2 bits   method: 0 verbatim, 1 first order delta, 2 second order prediction
+//   5 bits   shift: low bits that are zero in every sample of the block (24-bit
+//            samples in 32-bit slots have at least 8), removed before coding
+//   5 bits   Rice parameter k (not present for verbatim)
+//   warm-up  'method' samples (all samples for verbatim), two's complement, in
+//            (16 or 32) - shift bits
+//   residuals, zigzag mapped and Rice coded: (r >> k) zero bits, a one bit,
+//            then the low k bits of r
+// The payload is padded with zero bits to a whole byte.
+
+#ifndef PCM_CAPTURE_H
+#define PCM_CAPTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "output_stage.h"
+
+#define PCM_CAPTURE_RING_BYTES (128 * 1024)  // Encoded blocks waiting for the console (PSRAM)
+
+// Capture statistics
+typedef struct {
+    bool     enabled;
+    uint32_t blocks;         // Blocks encoded
+    uint32_t dropped;        // Blocks that did not fit in the ring
+    uint64_t raw_bytes;      // Size of the encoded blocks as handed to the I2S driver
+    uint64_t coded_bytes;    // ... and after compression
+    uint32_t encode_us_max;  // Slowest block to encode
+} pcm_capture_stats_t;
+
+// Start or stop capturing; the buffers are carved from the DSP arena on first use
+esp_err_t pcm_capture_enable(bool enable);
+
+// Encode one output block (audio task), does nothing unless capture is enabled
+// 'samples' holds 'frames' interleaved stereo frames in 'format'
+void pcm_capture_block(const void* samples, int frames, output_format_t format, uint32_t rate, uint32_t block,
+                       uint32_t underruns);
+
+// Copy the current statistics
+void pcm_capture_get_stats(pcm_capture_stats_t* stats);
+
+#endif  // PCM_CAPTURE_H
@@ -0,0 +1,749 @@
+// Interactive performance console
+
+#include "perf_console.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "chorus.h"
+#include "dsp_arena.h"
+#include "dsp_bench.h"
+#include "esp_console.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "fb_snapshot.h"
+#include "fx_chain.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "granular.h"
+#include "led_visualizer.h"
+#include "modal.h"
+#include "net_midi.h"
+#include "nvs.h"
+#include "pcm_capture.h"
+#include "resampler.h"
+#include "speaker_eq.h"
+#include "synth.h"
+#include "trace.h"
+#include "waveshaper.h"
+#include "wavetable.h"
+
+static char const TAG[] = "console";
+
+// Command: stats [reset]
+static int cmd_stats(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        synth_reset_stats();
+        printf("Statistics reset\n");
+        return 0;
+    }
+
+    synth_stats_t stats;
+    synth_get_stats(&stats);
+    printf("Blocks:        %lu (%d frames, deadline %lu us)\n", (unsigned long)stats.blocks,
+           synth_get_block_frames(), (unsigned long)stats.deadline_us);
+    printf("Block time:    last %lu us, max %lu us\n", (unsigned long)stats.block_us_last,
+           (unsigned long)stats.block_us_max);
+    printf("Audio load:    avg %.1f%%, peak %.1f%%\n", stats.load_avg * 100.0f, stats.load_peak * 100.0f);
+    printf("Voices:        %d active, polyphony %d\n", stats.active_voices, synth_get_polyphony());
+    printf("Underruns:     %lu\n", (unsigned long)stats.underruns);
+    if (stats.latency_count > 0) {
+        printf("Note latency:  min %lu us, avg %lu us, max %lu us (%lu notes)\n",
+               (unsigned long)stats.latency_us_min, (unsigned long)stats.latency_us_avg,
+               (unsigned long)stats.latency_us_max, (unsigned long)stats.latency_count);
+    } else {
+        printf("Note latency:  no notes played yet\n");
+    }
+    printf("Interpolation: %s\n", synth_interp_name(synth_get_interpolation()));
+    printf("Load shedding: %s, level %s, raised %lu times, %lu voices stolen\n",
+           synth_get_load_shedding() ? "on" : "off", synth_shed_name(stats.shed_level),
+           (unsigned long)stats.shed_events, (unsigned long)stats.voices_stolen);
+    printf("Scheduled:     %lu events, %lu late (worst %lu us), %lu dropped\n", (unsigned long)stats.events_played,
+           (unsigned long)stats.events_late, (unsigned long)stats.late_us_max, (unsigned long)stats.events_dropped);
+    return 0;
+}
+
+// Command: netmidi [delay <ms>|reset]
+static int cmd_netmidi(int argc, char** argv) {
+    if (argc > 2 && strcmp(argv[1], "delay") == 0) {
+        if (net_midi_set_delay((uint32_t)(atof(argv[2]) * 1000.0f)) != ESP_OK) {
+            printf("Delay must be 0 to %d ms\n", NET_MIDI_MAX_DELAY / 1000);
+            return 1;
+        }
+    } else if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        net_midi_reset_stats();
+        synth_reset_stats();
+        printf("Statistics reset\n");
+        return 0;
+    } else if (argc > 1) {
+        printf("Usage: netmidi [delay <ms>|reset]\n");
+        return 1;
+    }
+
+    net_midi_stats_t net;
+    synth_stats_t    stats;
+    net_midi_get_stats(&net);
+    synth_get_stats(&stats);
+    if (!net.listening) {
+        printf("Not listening (no Wi-Fi connection yet)\n");
+        return 0;
+    }
+    printf("Port:          %d, playout delay %.1f ms\n", NET_MIDI_PORT, net.playout_delay_us / 1000.0f);
+    printf("Packets:       %lu, %lu lost, %lu reordered, %lu invalid\n", (unsigned long)net.packets,
+           (unsigned long)net.lost, (unsigned long)net.reordered, (unsigned long)net.invalid);
+    printf("Transit:       last %lu us, avg %lu us, max %lu us (above the fastest packet)\n",
+           (unsigned long)net.transit_us_last, (unsigned long)net.transit_us_avg, (unsigned long)net.transit_us_max);
+    printf("Jitter:        %lu us\n", (unsigned long)net.jitter_us);
+    printf("Events:        %lu received, %lu too far ahead, %lu played, %lu late (worst %lu us), %lu dropped\n",
+           (unsigned long)net.events, (unsigned long)net.too_far_ahead, (unsigned long)stats.events_played,
+           (unsigned long)stats.events_late, (unsigned long)stats.late_us_max, (unsigned long)stats.events_dropped);
+    return 0;
+}
+
+// Command: stack
+static int cmd_stack(int argc, char** argv) {
+    // ESP-IDF stacks are sized in bytes, so the high-water mark is in bytes too
+    TaskHandle_t audio = synth_get_task();
+    TaskHandle_t main  = xTaskGetHandle("main");
+    if (audio != NULL) {
+        printf("audio:   %u bytes never used (of 4096)\n", (unsigned)uxTaskGetStackHighWaterMark(audio));
+    }
+    if (main != NULL) {
+        printf("main:    %u bytes never used\n", (unsigned)uxTaskGetStackHighWaterMark(main));
+    }
+    printf("console: %u bytes never used\n", (unsigned)uxTaskGetStackHighWaterMark(NULL));
+    return 0;
+}
+
+// Command: tasks
+static int cmd_tasks(int argc, char** argv) {
+#if defined(CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS) && defined(CONFIG_FREERTOS_USE_STATS_FORMATTING_FUNCTIONS)
+    static char buffer[2048];
+    vTaskGetRunTimeStats(buffer);
+    printf("Task            Runtime         Share\n%s", buffer);
+    return 0;
+#else
+    printf("Runtime stats need CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS and "
+           "CONFIG_FREERTOS_USE_STATS_FORMATTING_FUNCTIONS\n");
+    return 1;
+#endif
+}
+
+// Command: blocksize [frames]
+static int cmd_blocksize(int argc, char** argv) {
+    if (argc > 1 && !synth_set_block_frames(atoi(argv[1]))) {
+        printf("Block size must be %d to %d frames\n", MIN_FRAMES_PER_WRITE, MAX_FRAMES_PER_WRITE);
+        return 1;
+    }
+    int frames = synth_get_block_frames();
+    printf("Block size: %d frames (%.2f ms)\n", frames, frames * 1000.0f / SAMPLE_RATE);
+    return 0;
+}
+
+// Command: polyphony [voices]
+static int cmd_polyphony(int argc, char** argv) {
+    if (argc > 1 && !synth_set_polyphony(atoi(argv[1]))) {
+        printf("Polyphony must be 1 to %d voices\n", MAX_ACTIVE_NOTES);
+        return 1;
+    }
+    printf("Polyphony: %d voices\n", synth_get_polyphony());
+    return 0;
+}
+
+// Command: interp [nearest|linear|cubic]
+static int cmd_interp(int argc, char** argv) {
+    if (argc > 1) {
+        synth_interp_t mode = SYNTH_INTERP_COUNT;
+        for (int i = 0; i < SYNTH_INTERP_COUNT; i++) {
+            if (strcmp(argv[1], synth_interp_name(i)) == 0) mode = i;
+        }
+        if (!synth_set_interpolation(mode)) {
+            printf("Unknown mode '%s' (nearest, linear, cubic)\n", argv[1]);
+            return 1;
+        }
+    }
+    printf("Interpolation: %s\n", synth_interp_name(synth_get_interpolation()));
+    return 0;
+}
+
+// Command: shed [on|off]
+static int cmd_shed(int argc, char** argv) {
+    if (argc > 1) {
+        if (strcmp(argv[1], "on") == 0) {
+            synth_set_load_shedding(true);
+        } else if (strcmp(argv[1], "off") == 0) {
+            synth_set_load_shedding(false);
+        } else {
+            printf("Usage: shed [on|off]\n");
+            return 1;
+        }
+    }
+    printf("Load shedding: %s (level %s)\n", synth_get_load_shedding() ? "on" : "off",
+           synth_shed_name(synth_get_shed_level()));
+    return 0;
+}
+
+// Command: outfmt [16|24|32]
+static int cmd_outfmt(int argc, char** argv) {
+    if (argc > 1) {
+        output_format_t format = OUTPUT_FORMAT_COUNT;
+        for (int i = 0; i < OUTPUT_FORMAT_COUNT; i++) {
+            if (strcmp(argv[1], output_format_name(i)) == 0) format = i;
+        }
+        if (!synth_set_output_format(format)) {
+            printf("Unknown format '%s' (16, 24, 32)\n", argv[1]);
+            return 1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(20));  // Let the audio task switch over
+    }
+    printf("Output format: %s-bit\n", output_format_name(synth_get_output_format()));
+    return 0;
+}
+
+// Command: rate [44100|48000]
+static int cmd_rate(int argc, char** argv) {
+    if (argc > 1) {
+        if (!synth_set_output_rate(strtoul(argv[1], NULL, 10))) {
+            printf("Rate must be %d or %d\n", SAMPLE_RATE, RESAMPLER_OUTPUT_RATE);
+            return 1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(20));  // Let the audio task switch over
+    }
+    uint32_t rate = synth_get_output_rate();
+    printf("Output rate: %lu Hz%s\n", (unsigned long)rate, rate != SAMPLE_RATE ? " (resampled)" : "");
+    return 0;
+}
+
+// Command: gain [value]
+static int cmd_gain(int argc, char** argv) {
+    if (argc > 1 && !synth_set_master_gain(strtof(argv[1], NULL))) {
+        printf("Gain must be 0.0 to 4.0\n");
+        return 1;
+    }
+    printf("Master gain: %.2f\n", synth_get_master_gain());
+    return 0;
+}
+
+// Command: speaker [on|off] [bass]
+static int cmd_speaker(int argc, char** argv) {
+    speaker_eq_params_t params;
+    synth_get_speaker_eq(&params);
+    if (argc > 1) {
+        if ((strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0) || argc > 3) {
+            printf("Usage: speaker [on|off] [bass]\n");
+            return 1;
+        }
+        params.eq = strcmp(argv[1], "on") == 0;
+        if (argc == 3) params.bass = strtof(argv[2], NULL);
+        if (!synth_set_speaker_eq(&params)) {
+            printf("Bass must be 0.0 to 1.0\n");
+            return 1;
+        }
+    }
+    printf("Speaker EQ: %s, bass harmonics %.2f%s\n", params.eq ? "on" : "off", params.bass,
+           params.bass > 0.0f ? "" : " (off)");
+    return 0;
+}
+
+// Command: bench [name] [blocks]
+// Runs on the console core, so the numbers are free of audio task interference
+static int cmd_bench(int argc, char** argv) {
+    int blocks = argc > 2 ? atoi(argv[2]) : 1000;
+    if (blocks < 1) blocks = 1;
+    if (!dsp_bench_run(argc > 1 ? argv[1] : NULL, blocks)) {
+        printf("Unknown benchmark '%s'\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
+
+// Command: nvsstress [seconds]
+// Holds a chord and writes NVS back to back (page erases included), then reports what the audio task saw
+static int cmd_nvsstress(int argc, char** argv) {
+    static const int chord[] = {0, 4, 7};
+    const int        seconds = argc > 1 && atoi(argv[1]) > 0 ? atoi(argv[1]) : 10;
+
+    nvs_handle_t nvs;
+    esp_err_t    res = nvs_open("stress", NVS_READWRITE, &nvs);
+    if (res != ESP_OK) {
+        printf("Cannot open NVS: %s\n", esp_err_to_name(res));
+        return 1;
+    }
+
+    for (size_t i = 0; i < sizeof(chord) / sizeof(chord[0]); i++) {
+        synth_play_note(SYNTH_SOURCE_CONSOLE, chord[i], true);
+    }
+    vTaskDelay(pdMS_TO_TICKS(100));  // Past the attack, so every block mixes all voices
+    synth_reset_stats();
+    printf("Writing NVS for %d s while playing, statistics were reset\n", seconds);
+
+    uint8_t  blob[256];
+    uint32_t writes = 0, failures = 0, write_us_max = 0;
+    int64_t  end    = esp_timer_get_time() + seconds * 1000000LL;
+    while (esp_timer_get_time() < end) {
+        // New contents every time, so each write appends entries and full pages get erased
+        char key[8];
+        snprintf(key, sizeof(key), "k%lu", (unsigned long)(writes % 16));
+        memset(blob, (uint8_t)writes, sizeof(blob));
+
+        int64_t start = esp_timer_get_time();
+        res           = nvs_set_blob(nvs, key, blob, sizeof(blob));
+        if (res == ESP_OK) res = nvs_commit(nvs);
+        uint32_t write_us = (uint32_t)(esp_timer_get_time() - start);
+        if (write_us > write_us_max) write_us_max = write_us;
+        if (res != ESP_OK) failures++;
+        writes++;
+        vTaskDelay(1);  // Leave the rest of core 0 some time
+    }
+
+    synth_stats_t stats;
+    synth_get_stats(&stats);
+    for (size_t i = 0; i < sizeof(chord) / sizeof(chord[0]); i++) {
+        synth_play_note(SYNTH_SOURCE_CONSOLE, chord[i], false);
+    }
+    nvs_erase_all(nvs);
+    nvs_commit(nvs);
+    nvs_close(nvs);
+
+    printf("NVS writes: %lu (%lu failed), slowest write + commit %lu us\n", (unsigned long)writes,
+           (unsigned long)failures, (unsigned long)write_us_max);
+    printf("Audio:      %lu blocks, slowest %lu us of %lu us, %lu underruns\n", (unsigned long)stats.blocks,
+           (unsigned long)stats.block_us_max, (unsigned long)stats.deadline_us, (unsigned long)stats.underruns);
+    printf("Result:     %s\n", stats.underruns == 0 ? "PASS, no dropouts" : "FAIL, the audio dropped out");
+    return stats.underruns == 0 ? 0 : 1;
+}
+
+// Command: capture [on|off]
+static int cmd_capture(int argc, char** argv) {
+    if (argc > 1) {
+        if (strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0) {
+            printf("Usage: capture [on|off]\n");
+            return 1;
+        }
+        bool      enable = strcmp(argv[1], "on") == 0;
+        esp_err_t res    = pcm_capture_enable(enable);
+        if (res != ESP_OK) {
+            printf("Failed to start the capture: %s\n", esp_err_to_name(res));
+            return 1;
+        }
+        if (enable) return 0;  // Everything printed from here on is part of the capture log
+    }
+
+    pcm_capture_stats_t stats;
+    pcm_capture_get_stats(&stats);
+    printf("Capture:   %s\n", stats.enabled ? "on" : "off");
+    printf("Blocks:    %lu encoded, %lu dropped\n", (unsigned long)stats.blocks, (unsigned long)stats.dropped);
+    if (stats.coded_bytes > 0) {
+        printf("Size:      %llu of %llu bytes (%.1f%%), slowest block %lu us\n", (unsigned long long)stats.coded_bytes,
+               (unsigned long long)stats.raw_bytes, stats.coded_bytes * 100.0f / stats.raw_bytes,
+               (unsigned long)stats.encode_us_max);
+    }
+    return 0;
+}
+
+// Command: chorus [off|chorus|flanger] [rate_hz delay_ms depth_ms feedback mix]
+// A mode alone loads its preset, the numbers override it
+static int cmd_chorus(int argc, char** argv) {
+    chorus_params_t params;
+    synth_get_chorus(&params);
+    if (argc > 1) {
+        chorus_mode_t mode = CHORUS_MODE_COUNT;
+        for (int i = 0; i < CHORUS_MODE_COUNT; i++) {
+            if (strcmp(argv[1], chorus_mode_name(i)) == 0) mode = i;
+        }
+        if (mode == CHORUS_MODE_COUNT || (argc > 2 && argc != 7)) {
+            printf("Usage: chorus [off|chorus|flanger] [rate_hz delay_ms depth_ms feedback mix]\n");
+            return 1;
+        }
+        if (mode == CHORUS_OFF) {
+            params.mode = CHORUS_OFF;  // Keep the settings for switching back on
+        } else {
+            chorus_preset(mode, &params);
+        }
+        if (argc == 7) {
+            params.rate_hz  = atof(argv[2]);
+            params.delay_ms = atof(argv[3]);
+            params.depth_ms = atof(argv[4]);
+            params.feedback = atof(argv[5]);
+            params.mix      = atof(argv[6]);
+        }
+        if (!synth_set_chorus(&params)) {
+            printf("Invalid settings: rate 0.01-10 Hz, depth <= delay, delay + depth <= %.0f ms, feedback "
+                   "-0.95-0.95, mix 0-1\n",
+                   CHORUS_MAX_DELAY_MS);
+            return 1;
+        }
+    }
+    printf("Chorus: %s, rate %.2f Hz, delay %.1f ms +/- %.1f ms, feedback %.2f, mix %.2f\n",
+           chorus_mode_name(params.mode), params.rate_hz, params.delay_ms, params.depth_ms, params.feedback,
+           params.mix);
+    return 0;
+}
+
+// Command: drive [off|tanh|soft|hard] [drive level]
+static int cmd_drive(int argc, char** argv) {
+    waveshaper_params_t params;
+    synth_get_waveshaper(&params);
+    if (argc > 1) {
+        waveshaper_curve_t curve = WAVESHAPER_CURVE_COUNT;
+        for (int i = 0; i < WAVESHAPER_CURVE_COUNT; i++) {
+            if (strcmp(argv[1], waveshaper_curve_name(i)) == 0) curve = i;
+        }
+        if (curve == WAVESHAPER_CURVE_COUNT || (argc > 2 && argc != 4)) {
+            printf("Usage: drive [off|tanh|soft|hard] [drive level]\n");
+            return 1;
+        }
+        params.curve = curve;
+        if (argc == 4) {
+            params.drive = atof(argv[2]);
+            params.level = atof(argv[3]);
+        }
+        if (!synth_set_waveshaper(&params)) {
+            printf("Invalid settings: drive 1-32, level 0-1\n");
+            return 1;
+        }
+    }
+    printf("Drive: %s, drive %.1f, level %.2f, latency %d frames when on\n", waveshaper_curve_name(params.curve),
+           params.drive, params.level, HALFBAND_LATENCY);
+    return 0;
+}
+
+// Helper function: Print the effects patch, one chain per line
+static void print_fx_patch(const fx_patch_t* patch) {
+    static const char* const chain_names[FX_CHAIN_COUNT] = {"Voice", "Bus A", "Bus B", "Master"};
+    for (int chain = 0; chain < FX_CHAIN_COUNT; chain++) {
+        printf("%-6s:", chain_names[chain]);
+        if (patch->chain[chain][0] == FX_NONE) printf(" -");
+        for (int i = 0; i < FX_CHAIN_LENGTH && patch->chain[chain][i] != FX_NONE; i++) {
+            printf(" %s", fx_kind_name(patch->chain[chain][i]));
+        }
+        if (chain == FX_CHAIN_BUS_A || chain == FX_CHAIN_BUS_B) {
+            int bus = chain - FX_CHAIN_BUS_A;
+            printf(" (send %.2f, return %.2f)", patch->send[bus], patch->ret[bus]);
+        }
+        printf("\n");
+    }
+}
+
+// Command: fx [voice|a|b|master [effect...]|send <a> <b>|return <a> <b>|default]
+// A chain without effects is cleared; 'drive' and 'chorus' set what the effects do
+static int cmd_fx(int argc, char** argv) {
+    static const char* const chain_args[FX_CHAIN_COUNT] = {"voice", "a", "b", "master"};
+    fx_patch_t               patch;
+    synth_get_fx_patch(&patch);
+    if (argc > 1) {
+        int chain = -1;
+        for (int i = 0; i < FX_CHAIN_COUNT; i++) {
+            if (strcmp(argv[1], chain_args[i]) == 0) chain = i;
+        }
+        if (chain >= 0 && argc - 2 <= FX_CHAIN_LENGTH) {
+            for (int i = 0; i < FX_CHAIN_LENGTH; i++) {
+                patch.chain[chain][i] = i + 2 < argc ? fx_kind_from_name(argv[i + 2]) : FX_NONE;
+            }
+        } else if ((strcmp(argv[1], "send") == 0 || strcmp(argv[1], "return") == 0) && argc == 4) {
+            float* levels = strcmp(argv[1], "send") == 0 ? patch.send : patch.ret;
+            levels[0]     = atof(argv[2]);
+            levels[1]     = atof(argv[3]);
+        } else if (strcmp(argv[1], "default") == 0 && argc == 2) {
+            fx_patch_default(&patch);
+        } else {
+            printf("Usage: fx [voice|a|b|master [effect...]|send <a> <b>|return <a> <b>|default]\n");
+            return 1;
+        }
+        if (!synth_set_fx_patch(&patch)) {
+            printf("Invalid patch: effects drive and chorus, each once on the buses and master, only drive on "
+                   "the voices, levels 0-1\n");
+            return 1;
+        }
+    }
+    print_fx_patch(&patch);
+    return 0;
+}
+
+// Command: fbsnap [full|dirty]
+static int cmd_fbsnap(int argc, char** argv) {
+    fb_snapshot_mode_t mode = FB_SNAPSHOT_FULL;
+    if (argc > 1) {
+        if (strcmp(argv[1], "dirty") == 0) {
+            mode = FB_SNAPSHOT_DIRTY;
+        } else if (strcmp(argv[1], "full") != 0) {
+            printf("Usage: fbsnap [full|dirty]\n");
+            return 1;
+        }
+    }
+    esp_err_t res = fb_snapshot_request(mode);
+    if (res != ESP_OK) {
+        printf("Failed to take a snapshot: %s\n", esp_err_to_name(res));
+        return 1;
+    }
+    return 0;
+}
+
+// Command: leds on|off
+static int cmd_leds(int argc, char** argv) {
+    if (argc < 2 || (strcmp(argv[1], "on") != 0 && strcmp(argv[1], "off") != 0)) {
+        printf("Usage: leds on|off\n");
+        return 1;
+    }
+    led_visualizer_enable(strcmp(argv[1], "on") == 0);
+    return 0;
+}
+
+// Command: arena
+static int cmd_arena(int argc, char** argv) {
+    dsp_arena_report();
+    return 0;
+}
+
+// Command: trace [dump|clear]
+static int cmd_trace(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "clear") == 0) {
+        trace_clear();
+        return 0;
+    }
+    trace_dump();
+    return 0;
+}
+
+// Wavetable slot and morph bank states, as the wave and morph commands print them
+static const char* const state_names[] = {
+    [WAVETABLE_EMPTY]   = "empty",
+    [WAVETABLE_LOADING] = "loading",
+    [WAVETABLE_READY]   = "ready",
+    [WAVETABLE_FAILED]  = "failed",
+};
+
+// Command: wave [load <slot> <path>|use <slot>|builtin|mount]
+static int cmd_wave(int argc, char** argv) {
+    esp_err_t res = ESP_OK;
+    if (argc > 1 && strcmp(argv[1], "mount") == 0) {
+        res = wavetable_mount_sd();
+        printf("SD card %s\n", res == ESP_OK ? "mounted on /sd" : esp_err_to_name(res));
+        return res == ESP_OK ? 0 : 1;
+    } else if (argc > 3 && strcmp(argv[1], "load") == 0) {
+        res = wavetable_load(atoi(argv[2]), argv[3]);
+        if (res == ESP_OK) printf("Loading %s in the background\n", argv[3]);
+    } else if (argc > 2 && strcmp(argv[1], "use") == 0) {
+        res = wavetable_select(atoi(argv[2]));
+        if (res == ESP_OK) printf("Switching to slot %s once any queued load is done\n", argv[2]);
+    } else if (argc > 1 && strcmp(argv[1], "builtin") == 0) {
+        res = wavetable_select(-1);
+        if (res == ESP_OK) printf("Switching to the built-in waveform once any queued load is done\n");
+    } else if (argc > 1) {
+        printf("Usage: wave [load <slot> <path>|use <slot>|builtin|mount]\n");
+        return 1;
+    }
+    if (res != ESP_OK) {
+        printf("Failed: %s\n", esp_err_to_name(res));
+        return 1;
+    }
+
+    int selected = wavetable_selected();
+    printf("Playing: %s\n", wavetable_bank_selected() ? "morph bank"
+                             : selected < 0           ? "built-in waveform"
+                                                      : wavetable_get_slot(selected)->name);
+    for (int i = 0; i < WAVETABLE_SLOTS; i++) {
+        const wavetable_slot_t* slot = wavetable_get_slot(i);
+        if (slot->state == WAVETABLE_EMPTY) continue;
+        printf("%c%d %-8s %-24s", i == selected ? '*' : ' ', i, state_names[slot->state], slot->name);
+        if (slot->table != NULL) printf(" %d samples, %d harmonics", slot->source_length, slot->harmonics);
+        if (slot->error != ESP_OK) printf(" (last load: %s)", esp_err_to_name(slot->error));
+        printf("\n");
+    }
+    return 0;
+}
+
+// Command: morph [load <path> [frame]|pulse|use|<position> [<lfo_hz> <depth>]]
+static int cmd_morph(int argc, char** argv) {
+    esp_err_t res = ESP_OK;
+    if (argc > 2 && strcmp(argv[1], "load") == 0) {
+        res = wavetable_load_bank(argv[2], argc > 3 ? atoi(argv[3]) : WAVETABLE_LENGTH);
+        if (res == ESP_OK) printf("Loading %s in the background\n", argv[2]);
+    } else if (argc > 1 && strcmp(argv[1], "pulse") == 0) {
+        res = wavetable_load_bank(NULL, WAVETABLE_LENGTH);
+        if (res == ESP_OK) printf("Building the pulse bank in the background\n");
+    } else if (argc > 1 && strcmp(argv[1], "use") == 0) {
+        res = wavetable_select_bank();
+        if (res == ESP_OK) printf("Switching to the bank once any queued load is done\n");
+    } else if (argc > 1) {
+        float lfo_rate = argc > 2 ? atof(argv[2]) : 0.0f;
+        float depth    = argc > 3 ? atof(argv[3]) : 0.0f;
+        if (!synth_set_morph(atof(argv[1]), lfo_rate, depth)) {
+            printf("Usage: morph [load <path> [frame]|pulse|use|<0.0-1.0> [<lfo_hz> <depth>]]\n");
+            return 1;
+        }
+    }
+    if (res != ESP_OK) {
+        printf("Failed: %s\n", esp_err_to_name(res));
+        return 1;
+    }
+
+    const wavetable_bank_slot_t* bank = wavetable_get_bank();
+    float                        position, lfo_rate, depth;
+    synth_get_morph(&position, &lfo_rate, &depth);
+    printf("Bank:     %s %s", state_names[bank->state], bank->name);
+    if (bank->bank != NULL) printf(", %d frames of %d samples", bank->bank->frames, bank->frame_length);
+    if (bank->error != ESP_OK) printf(" (last load: %s)", esp_err_to_name(bank->error));
+    printf("%s\n", wavetable_bank_selected() ? ", playing" : "");
+    printf("Position: %.3f, LFO %.2f Hz depth %.3f\n", position, lfo_rate, depth);
+    return 0;
+}
+
+// Command: engine [wave|grain|modal]
+static int cmd_engine(int argc, char** argv) {
+    if (argc > 1) {
+        synth_engine_t engine = SYNTH_ENGINE_COUNT;
+        for (int i = 0; i < SYNTH_ENGINE_COUNT; i++) {
+            if (strcmp(argv[1], synth_engine_name(i)) == 0) engine = i;
+        }
+        if (!synth_set_engine(engine)) {
+            printf("Usage: engine [wave|grain|modal]\n");
+            return 1;
+        }
+    }
+    printf("Engine: %s\n", synth_engine_name(synth_get_engine()));
+    return 0;
+}
+
+// Command: grain [capture|<window> [position spray density length_ms jitter]]
+// A window alone keeps the other settings
+static int cmd_grain(int argc, char** argv) {
+    granular_params_t params;
+    synth_get_granular(&params);
+    if (argc > 1 && strcmp(argv[1], "capture") == 0) {
+        granular_capture_start();
+        printf("Recording the next %d s of the mix into the grain source\n", GRANULAR_SOURCE_SECONDS);
+        return 0;
+    }
+    if (argc > 1) {
+        granular_window_t window = granular_window_from_name(argv[1]);
+        if (window == GRANULAR_WINDOW_COUNT || (argc > 2 && argc != 7)) {
+            printf("Usage: grain [capture|hann|tukey|decay [position spray density length_ms jitter]]\n");
+            return 1;
+        }
+        params.window = window;
+        if (argc == 7) {
+            params.position  = atof(argv[2]);
+            params.spray     = atof(argv[3]);
+            params.density   = atof(argv[4]);
+            params.length_ms = atof(argv[5]);
+            params.jitter    = atof(argv[6]);
+        }
+        if (!synth_set_granular(&params)) {
+            printf("Invalid settings: position 0-1, spray 0-1, density 1-1000 per s, length 5-500 ms, jitter "
+                   "0-12 semitones\n");
+            return 1;
+        }
+    }
+
+    granular_stats_t stats;
+    granular_get_stats(&stats);
+    printf("Grains: %s window, position %.2f +/- %.2f, %.0f per s, %.0f ms, jitter %.2f semitones\n",
+           granular_window_name(params.window), params.position, params.spray, params.density, params.length_ms,
+           params.jitter);
+    printf("Pool:   %d of %d sounding (peak %d), %lu started, %lu dropped\n", stats.active, GRANULAR_MAX_GRAINS,
+           stats.peak, (unsigned long)stats.started, (unsigned long)stats.dropped);
+    if (stats.capturing) {
+        printf("Source: recording, %.2f of %d s\n", (float)stats.captured / SAMPLE_RATE, GRANULAR_SOURCE_SECONDS);
+    }
+    if (synth_get_engine() != SYNTH_ENGINE_GRANULAR) {
+        printf("Engine: %s ('engine grain' plays the grains)\n", synth_engine_name(synth_get_engine()));
+    }
+    return 0;
+}
+
+// Command: modal [<preset> [hardness decay]]
+// A preset alone keeps the other settings
+static int cmd_modal(int argc, char** argv) {
+    modal_params_t params;
+    synth_get_modal(&params);
+    if (argc > 1) {
+        modal_preset_t preset = modal_preset_from_name(argv[1]);
+        if (preset == MODAL_PRESET_COUNT || (argc > 2 && argc != 4)) {
+            printf("Usage: modal [marimba|vibes|bell|membrane [hardness decay]]\n");
+            return 1;
+        }
+        params.preset = preset;
+        if (argc == 4) {
+            params.hardness = atof(argv[2]);
+            params.decay    = atof(argv[3]);
+        }
+        if (!synth_set_modal(&params)) {
+            printf("Invalid settings: hardness 0-1, decay 0.25-4\n");
+            return 1;
+        }
+    }
+
+    modal_stats_t stats;
+    modal_get_stats(&stats);
+    printf("Modal:  %s, %d modes, hardness %.2f, decay x%.2f\n", modal_preset_name(params.preset),
+           modal_preset_modes(params.preset), params.hardness, params.decay);
+    printf("Pass:   %d modes sounding (peak %d of %d), %lu strikes\n", stats.modes, stats.peak,
+           MAX_ACTIVE_NOTES * MODAL_MAX_MODES, (unsigned long)stats.strikes);
+    if (synth_get_engine() != SYNTH_ENGINE_MODAL) {
+        printf("Engine: %s ('engine modal' plays the resonators)\n", synth_engine_name(synth_get_engine()));
+    }
+    return 0;
+}
+
+static const esp_console_cmd_t commands[] = {
+    {.command = "stats", .help = "Audio load, voices, underruns and note latency", .hint = "[reset]", .func = cmd_stats},
+    {.command = "stack", .help = "Stack high-water marks of the audio, main and console tasks", .func = cmd_stack},
+    {.command = "tasks", .help = "FreeRTOS runtime statistics", .func = cmd_tasks},
+    {.command = "blocksize", .help = "Get or set the audio block size", .hint = "[frames]", .func = cmd_blocksize},
+    {.command = "polyphony", .help = "Get or set the number of voices", .hint = "[voices]", .func = cmd_polyphony},
+    {.command = "interp", .help = "Get or set waveform interpolation", .hint = "[nearest|linear|cubic]", .func = cmd_interp},
+    {.command = "shed", .help = "Enable or disable load shedding", .hint = "[on|off]", .func = cmd_shed},
+    {.command = "outfmt", .help = "Get or set the I2S sample format", .hint = "[16|24|32]", .func = cmd_outfmt},
+    {.command = "rate", .help = "Get or set the I2S output rate", .hint = "[44100|48000]", .func = cmd_rate},
+    {.command = "bench", .help = "Run DSP benchmarks (all by default)", .hint = "[name] [blocks]", .func = cmd_bench},
+    {.command = "speaker", .help = "Get or set the speaker EQ and bass enhancer", .hint = "[on|off] [bass]", .func = cmd_speaker},
+    {.command = "gain", .help = "Get or set the digital master gain", .hint = "[value]", .func = cmd_gain},
+    {.command = "nvsstress", .help = "Write NVS while playing and count audio dropouts", .hint = "[seconds]", .func = cmd_nvsstress},
+    {.command = "netmidi", .help = "Network MIDI statistics and jitter buffer depth", .hint = "[delay <ms>|reset]", .func = cmd_netmidi},
+    {.command = "chorus", .help = "Get or set the chorus/flanger", .hint = "[off|chorus|flanger] [rate_hz delay_ms depth_ms feedback mix]", .func = cmd_chorus},
+    {.command = "drive", .help = "Get or set the oversampled overdrive", .hint = "[off|tanh|soft|hard] [drive level]", .func = cmd_drive},
+    {.command = "fx", .help = "Get or set the effects chains: voice inserts, send buses A and B, master", .hint = "[voice|a|b|master [effect...]|send <a> <b>|return <a> <b>|default]", .func = cmd_fx},
+    {.command = "capture", .help = "Stream the audio output over the console (see pcm_capture_to_wav.py)", .hint = "[on|off]", .func = cmd_capture},
+    {.command = "fbsnap", .help = "Stream the framebuffer, or the next screen update, over the console (see fb_snapshot_to_png.py)", .hint = "[full|dirty]", .func = cmd_fbsnap},
+    {.command = "leds", .help = "Enable or disable the LED visualisation", .hint = "on|off", .func = cmd_leds},
+    {.command = "arena", .help = "DSP memory usage and allocations refused while rendering", .func = cmd_arena},
+    {.command = "trace", .help = "Dump (default) or clear the trace buffer", .hint = "[dump|clear]", .func = cmd_trace},
+    {.command = "wave", .help = "List, load or select user wavetables", .hint = "[load <slot> <path>|use <slot>|builtin|mount]", .func = cmd_wave},
+    {.command = "morph", .help = "Load or play a morph bank, set its position and LFO", .hint = "[load <path> [frame]|pulse|use|<position> [<lfo_hz> <depth>]]", .func = cmd_morph},
+    {.command = "engine", .help = "Get or set the sound engine of all voices", .hint = "[wave|grain|modal]", .func = cmd_engine},
+    {.command = "grain", .help = "Get or set the granular engine, record its source from the mix", .hint = "[capture|<window> [position spray density length_ms jitter]]", .func = cmd_grain},
+    {.command = "modal", .help = "Get or set the modal engine's preset and mallet", .hint = "[<preset> [hardness decay]]", .func = cmd_modal},
+};
+
+void perf_console_start(void) {
+    esp_console_repl_t*       repl        = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt                    = "synth>";
+    repl_config.task_priority             = 1;  // Same as the UI loop (main task), far below audio
+    repl_config.task_core_id              = 0;  // Keep core 1 free for audio
+
+    esp_err_t res;
+#if defined(CONFIG_IDF_TARGET_LINUX)
+    res = esp_console_new_repl_stdio(&repl_config, &repl);
+#elif defined(CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG)
+    esp_console_dev_usb_serial_jtag_config_t hw_config = ESP_CONSOLE_DEV_USB_SERIAL_JTAG_CONFIG_DEFAULT();
+    res = esp_console_new_repl_usb_serial_jtag(&hw_config, &repl_config, &repl);
+#else
+    esp_console_dev_uart_config_t hw_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    res = esp_console_new_repl_uart(&hw_config, &repl_config, &repl);
+#endif
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create console: %s", esp_err_to_name(res));
+        return;
+    }
+
+    esp_console_register_help_command();
+    for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++) {
+        esp_console_cmd_register(&commands[i]);
+    }
+
+    res = esp_console_start_repl(repl);
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start console: %s", esp_err_to_name(res));
+    }
+}
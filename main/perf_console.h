@@ -0,0 +1,13 @@
+// Interactive performance console
+//
+// Starts an esp_console REPL on the serial console (USB serial/JTAG on the
+// Tanmatsu, stdin/stdout on the Linux target) with commands for inspecting and
+// tuning the synthesizer while it plays. Type "help" for the command list.
+
+#ifndef PERF_CONSOLE_H
+#define PERF_CONSOLE_H
+
+// Register all commands and start the REPL task on core 0
+void perf_console_start(void);
+
+#endif  // PERF_CONSOLE_H
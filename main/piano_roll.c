@@ -0,0 +1,143 @@
+// Scrolling piano-roll of recently played notes
+
+#include "piano_roll.h"
+#include <stdint.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "fb_region.h"
+
+#define NOTE_INSET_PX    4  // Space between a note and the edges of its key
+
+#define COLOR_LANE       0xFF202020
+#define COLOR_DIVIDER    0xFF404040
+#define COLOR_WHITE_NOTE 0xFF4444FF  // Same colours as a pressed key
+#define COLOR_BLACK_NOTE 0xFFFF0000
+
+typedef struct {
+    uint32_t time_ms;  // esp_timer time of the event
+    uint8_t  note;     // Index into note_defs
+    bool     pressed;  // true for note on, false for note off
+} roll_event_t;
+
+static roll_event_t events[PIANO_ROLL_EVENTS];
+static uint32_t     events_written = 0;  // Total events logged, the ring index is this modulo the size
+static uint32_t     events_drawn   = 0;  // Events already drawn into the lane
+
+static pax_recti lane;                   // Screen area of the roll
+static pax_recti columns[NUM_NOTES];     // Key below each note column
+static int32_t   note_on_px[NUM_NOTES];  // Roll position at which a held note started, or -1
+static int32_t   lane_position = 0;      // Roll position (px) just below the bottom row of the lane
+static bool      lane_dirty    = true;   // Replay the whole roll on the next frame
+
+// Helper function: Roll position of a time, the roll moves PIANO_ROLL_PX_PER_S pixels per second
+static int32_t time_to_px(uint32_t time_ms) {
+    return (int32_t)((int64_t)time_ms * PIANO_ROLL_PX_PER_S / 1000);
+}
+
+// Helper function: Draw a note held from roll position 'on' up to 'off' (exclusive),
+// skipping the part above 'from' that is already on screen
+// Row y of the lane shows roll position lane_position - lane.h + y
+static void draw_note(pax_buf_t* fb, int note, int32_t on, int32_t off, int32_t from) {
+    if (off <= on) off = on + 1;  // Taps shorter than a pixel still show up
+    if (on < from) on = from;
+    if (off <= on) return;
+
+    int y0 = on - (lane_position - lane.h);
+    int y1 = off - (lane_position - lane.h);
+    if (y0 < 0) y0 = 0;
+    if (y1 <= y0) return;
+
+    pax_recti column = columns[note];
+    pax_col_t color  = note_defs[note].is_black_key ? COLOR_BLACK_NOTE : COLOR_WHITE_NOTE;
+    pax_draw_rect(fb, color, column.x + NOTE_INSET_PX, lane.y + y0, column.w - 2 * NOTE_INSET_PX, y1 - y0);
+}
+
+// Helper function: Draw the bottom rows of the lane, roll positions [from, lane_position),
+// from the events logged since 'first'
+// Events in the row that is still in progress are left for the next frame
+static void draw_rows(pax_buf_t* fb, uint32_t first, int32_t from) {
+    int rows = lane_position - from;
+    pax_draw_rect(fb, COLOR_LANE, lane.x, lane.y + lane.h - rows, lane.w, rows);
+
+    // Dividers between the white key columns
+    for (int i = 1; i < 8; i++) {
+        pax_draw_rect(fb, COLOR_DIVIDER, columns[i].x - 1, lane.y + lane.h - rows, 1, rows);
+    }
+
+    // Black key columns overlap the white ones, so draw them in a second pass on top
+    // (as on the keyboard) to get the same image however the rows were split into frames
+    int32_t  on_px[NUM_NOTES];
+    uint32_t i = first;
+    for (int pass = 0; pass < 2; pass++) {
+        bool black = pass == 1;
+        memcpy(on_px, note_on_px, sizeof(on_px));
+        for (i = first; i != events_written; i++) {
+            const roll_event_t* event = &events[i % PIANO_ROLL_EVENTS];
+            int32_t             px    = time_to_px(event->time_ms);
+            if (px >= lane_position) break;
+            if (event->pressed) {
+                if (on_px[event->note] < 0) on_px[event->note] = px;
+            } else if (on_px[event->note] >= 0) {
+                if (note_defs[event->note].is_black_key == black) {
+                    draw_note(fb, event->note, on_px[event->note], px, from);
+                }
+                on_px[event->note] = -1;
+            }
+        }
+
+        // Notes still held reach down to the newest row
+        for (int note = 0; note < NUM_NOTES; note++) {
+            if (on_px[note] >= 0 && note_defs[note].is_black_key == black) {
+                draw_note(fb, note, on_px[note], lane_position, from);
+            }
+        }
+    }
+    memcpy(note_on_px, on_px, sizeof(on_px));
+    events_drawn = i;
+}
+
+void piano_roll_record(int note_index, bool pressed) {
+    if (note_index < 0 || note_index >= NUM_NOTES) return;
+    roll_event_t* event = &events[events_written % PIANO_ROLL_EVENTS];
+    event->time_ms      = (uint32_t)(esp_timer_get_time() / 1000);
+    event->note         = (uint8_t)note_index;
+    event->pressed      = pressed;
+    events_written++;
+}
+
+void piano_roll_start(pax_recti lane_rect, const pax_recti keys[NUM_NOTES]) {
+    lane = lane_rect;
+    for (int i = 0; i < NUM_NOTES; i++) {
+        columns[i] = keys[i];
+    }
+    lane_dirty = true;
+}
+
+void piano_roll_invalidate(void) {
+    lane_dirty = true;
+}
+
+bool piano_roll_render(pax_buf_t* fb) {
+    int32_t position = time_to_px((uint32_t)(esp_timer_get_time() / 1000));
+    int32_t scroll   = position - lane_position;
+    if (scroll <= 0 && !lane_dirty) return false;
+
+    // Events older than the ring buffer are gone, the lost ones fall out of view first
+    uint32_t oldest = events_written > PIANO_ROLL_EVENTS ? events_written - PIANO_ROLL_EVENTS : 0;
+
+    if (!lane_dirty && scroll < lane.h && events_drawn >= oldest && fb_region_scroll(fb, lane, 0, -scroll)) {
+        // Move what is already drawn up, then draw only the new rows
+        int32_t from  = lane_position;
+        lane_position = position;
+        draw_rows(fb, events_drawn, from);
+    } else {
+        // Replay everything still in the ring buffer into the whole lane
+        for (int note = 0; note < NUM_NOTES; note++) {
+            note_on_px[note] = -1;
+        }
+        lane_position = position;
+        draw_rows(fb, oldest, position - lane.h);
+    }
+    lane_dirty = false;
+    return true;
+}
@@ -0,0 +1,37 @@
+// Scrolling piano-roll of recently played notes
+//
+// Every key press and release is logged with its time in a fixed ring buffer.
+// The roll is drawn above the on-screen keyboard with one column per key: new
+// notes appear at the bottom, right above their key, and rise as time passes.
+// Each frame shifts the existing image up in the framebuffer and only draws
+// the newest rows from the events logged since the previous frame, so the cost
+// stays the same however dense the history is. The whole roll is replayed from
+// the ring buffer only when the view is (re)opened.
+
+#ifndef PIANO_ROLL_H
+#define PIANO_ROLL_H
+
+#include <stdbool.h>
+#include "keyboard_notes.h"
+#include "pax_gfx.h"
+
+// Number of note on/off events kept (must be a power of two)
+#define PIANO_ROLL_EVENTS 512
+
+// Speed at which the roll scrolls, the lane height divided by this is the visible history
+#define PIANO_ROLL_PX_PER_S 50
+
+// Log a key press (true) or release (false), call this from the UI task only
+void piano_roll_record(int note_index, bool pressed);
+
+// Show the roll in the given lane, with one screen column per note (the key below it)
+void piano_roll_start(pax_recti lane, const pax_recti keys[NUM_NOTES]);
+
+// Redraw the whole roll on the next piano_roll_render() (after the screen was cleared)
+void piano_roll_invalidate(void);
+
+// Scroll the roll to the current time and draw the newest rows
+// Returns true if the lane changed and has to be sent to the display
+bool piano_roll_render(pax_buf_t* fb);
+
+#endif  // PIANO_ROLL_H
@@ -0,0 +1,88 @@
+// Fixed-ratio polyphase resampler, 44100 Hz -> 48000 Hz
+//
+// Output sample n sits at input time n * DOWN / UP. Its integer part selects the
+// newest input sample, its fractional part (in 1/UP steps) selects one of the
+// UP coefficient rows. Each output is then a TAPS long dot product over the
+// input history, with both channels sharing the coefficient loads. The history
+// is kept de-interleaved and linear so the dot product never wraps.
+
+#include "resampler.h"
+#include <math.h>
+#include <string.h>
+#include "esp_timer.h"
+
+void resampler_reset(resampler_t* resampler) {
+    memset(resampler, 0, sizeof(*resampler));
+}
+
+int resampler_input_frames(const resampler_t* resampler, int output_frames) {
+    return (resampler->phase + output_frames * RESAMPLER_DOWN) / RESAMPLER_UP;
+}
+
+void resampler_process(resampler_t* resampler, const float* in, float* out, int output_frames) {
+    const int input_frames = resampler_input_frames(resampler, output_frames);
+    float*    left         = resampler->history[0];
+    float*    right        = resampler->history[1];
+
+    // Append the new input after the TAPS samples of history
+    for (int i = 0; i < input_frames; i++) {
+        left[RESAMPLER_TAPS + i]  = in[i * 2];
+        right[RESAMPLER_TAPS + i] = in[i * 2 + 1];
+    }
+
+    int phase  = resampler->phase;
+    int offset = 0;  // Input samples consumed so far
+    for (int n = 0; n < output_frames; n++) {
+        const float* coeffs = resampler_coeffs[phase];
+        const float* l      = &left[offset];
+        const float* r      = &right[offset];
+
+        // Four partial sums per channel break the add dependency chain
+        float l0 = 0.0f, l1 = 0.0f, l2 = 0.0f, l3 = 0.0f;
+        float r0 = 0.0f, r1 = 0.0f, r2 = 0.0f, r3 = 0.0f;
+        for (int tap = 0; tap < RESAMPLER_TAPS; tap += 4) {
+            l0 += l[tap] * coeffs[tap];
+            l1 += l[tap + 1] * coeffs[tap + 1];
+            l2 += l[tap + 2] * coeffs[tap + 2];
+            l3 += l[tap + 3] * coeffs[tap + 3];
+            r0 += r[tap] * coeffs[tap];
+            r1 += r[tap + 1] * coeffs[tap + 1];
+            r2 += r[tap + 2] * coeffs[tap + 2];
+            r3 += r[tap + 3] * coeffs[tap + 3];
+        }
+        out[n * 2]     = (l0 + l1) + (l2 + l3);
+        out[n * 2 + 1] = (r0 + r1) + (r2 + r3);
+
+        // DOWN < UP, so at most one input sample is consumed per output
+        phase += RESAMPLER_DOWN;
+        if (phase >= RESAMPLER_UP) {
+            phase -= RESAMPLER_UP;
+            offset++;
+        }
+    }
+
+    // Keep the newest TAPS samples as history for the next block
+    memmove(left, &left[input_frames], RESAMPLER_TAPS * sizeof(float));
+    memmove(right, &right[input_frames], RESAMPLER_TAPS * sizeof(float));
+    resampler->phase = phase;
+}
+
+_Static_assert(RESAMPLER_TAPS % 4 == 0, "The dot product is unrolled by 4");
+
+uint32_t resampler_bench(int blocks) {
+    static resampler_t bench_resampler;
+    static float       in[RESAMPLER_MAX_INPUT * 2];
+    static float       out[FRAMES_PER_WRITE * 2];
+
+    resampler_reset(&bench_resampler);
+    for (int i = 0; i < RESAMPLER_MAX_INPUT; i++) {
+        in[i * 2]     = sinf(i * 0.0627f);  // ~440 Hz at 44.1 kHz
+        in[i * 2 + 1] = in[i * 2];
+    }
+
+    int64_t start = esp_timer_get_time();
+    for (int block = 0; block < blocks; block++) {
+        resampler_process(&bench_resampler, in, out, FRAMES_PER_WRITE);
+    }
+    return (uint32_t)(esp_timer_get_time() - start);
+}
@@ -0,0 +1,37 @@
+// Fixed-ratio polyphase resampler, 44100 Hz -> 48000 Hz
+//
+// Lets the synth keep rendering at the 44.1 kHz rate its waveform and
+// envelopes are authored for while the codec runs at 48 kHz. The filter
+// coefficients are generated by generate_resampler.pl (resampler_coeffs.h),
+// which also reports the passband ripple and stopband attenuation.
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include <stdint.h>
+#include "resampler_coeffs.h"
+#include "synth.h"
+
+// Most input frames a single call can consume (enough for MAX_FRAMES_PER_WRITE outputs)
+#define RESAMPLER_MAX_INPUT ((MAX_FRAMES_PER_WRITE * RESAMPLER_DOWN) / RESAMPLER_UP + 1)
+
+// Resampler state for one interleaved stereo stream
+typedef struct {
+    int   phase;  // Position between input samples in units of 1/RESAMPLER_UP
+    float history[2][RESAMPLER_TAPS + RESAMPLER_MAX_INPUT];  // Per channel, newest input last
+} resampler_t;
+
+// Clear the filter history
+void resampler_reset(resampler_t* resampler);
+
+// Number of new input frames the next resampler_process() call needs to produce 'output_frames'
+int resampler_input_frames(const resampler_t* resampler, int output_frames);
+
+// Consume resampler_input_frames(output_frames) interleaved stereo frames from 'in'
+// and write 'output_frames' interleaved stereo frames to 'out'
+void resampler_process(resampler_t* resampler, const float* in, float* out, int output_frames);
+
+// Benchmark: time 'blocks' conversions of FRAMES_PER_WRITE output frames, returns microseconds
+uint32_t resampler_bench(int blocks);
+
+#endif  // RESAMPLER_H
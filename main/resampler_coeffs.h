@@ -0,0 +1,2263 @@
+// Auto-generated polyphase resampler coefficients for musical keyboard
+// Ratio: 44100 Hz -> 48000 Hz (interpolate by 160, decimate by 147)
+// Taps per phase: 48, Kaiser beta: 7
+// Passband ripple (0 - 20000 Hz): 0.0045 dB
+// Stopband attenuation (from 24100 Hz): 72.0 dB
+//
+// Generated by generate_resampler.pl
+
+#ifndef RESAMPLER_COEFFS_H
+#define RESAMPLER_COEFFS_H
+
+#define RESAMPLER_INPUT_RATE  44100
+#define RESAMPLER_OUTPUT_RATE 48000
+#define RESAMPLER_UP          160
+#define RESAMPLER_DOWN        147
+#define RESAMPLER_TAPS        48
+
+// One row per phase, taps stored oldest input first so each output is a
+// contiguous dot product over the input history
+static const float resampler_coeffs[160][48] = {
+    {
+        -1.828614753e-06, 3.484231724e-06, -5.916879337e-06, 9.338615224e-06,
+        -1.399237003e-05, 2.015401303e-05, -2.813551989e-05, 3.829014176e-05,
+        -5.102093625e-05, 6.679475021e-05, -8.616494883e-05, 1.098082666e-04,
+        -1.385849137e-04, 1.736381961e-04, -2.165641413e-04, 2.697118786e-04,
+        -3.367446686e-04, 4.237643493e-04, -5.417858735e-04, 7.129205657e-04,
+        -9.889098005e-04, 1.525163835e-03, -3.097623654e-03, 9.999838813e-01,
+        3.117263855e-03, -1.530153294e-03, 9.911827586e-04, -7.142388445e-04,
+        5.426581959e-04, -4.243903716e-04, 3.372182873e-04, -2.700829467e-04,
+        2.168615939e-04, -1.738800607e-04, 1.387831227e-04, -1.099711616e-04,
+        8.629866446e-05, -6.690401422e-05, 5.110954702e-05, -3.836125949e-05,
+        2.819184599e-05, -2.019790075e-05, 1.402589220e-05, -9.363605457e-06,
+        5.934956946e-06, -3.496817360e-06, 1.836941244e-06, -7.724074909e-07
+    },
+    {
+        -5.460232391e-06, 1.041369064e-05, -1.769424668e-05, 2.793742843e-05,
+        -4.187133850e-05, 6.032283595e-05, -8.422701046e-05, 1.146426392e-04,
+        -1.527776968e-04, 2.000311703e-04, -2.580610318e-04, 3.288944432e-04,
+        -4.151074947e-04, 5.201230622e-04, -6.487178767e-04, 8.079202004e-04,
+        -1.008685808e-03, 1.269255389e-03, -1.622538101e-03, 2.134544051e-03,
+        -2.959557284e-03, 4.560028240e-03, -9.233489288e-03, 9.998549376e-01,
+        9.410242117e-03, -4.604928464e-03, 2.980011448e-03, -2.146407089e-03,
+        1.630388016e-03, -1.274888877e-03, 1.012947835e-03, -8.112593869e-04,
+        6.513946080e-04, -5.222995653e-04, 4.168911474e-04, -3.303603104e-04,
+        2.592643185e-04, -2.010144205e-04, 1.535750916e-04, -1.152826168e-04,
+        8.473388050e-05, -6.071777487e-05, 4.217299950e-05, -2.816231182e-05,
+        1.785692441e-05, -1.052694696e-05, 5.535161305e-06, -2.332338211e-06
+    },
+    {
+        -9.056662907e-06, 1.728908854e-05, -2.939286335e-05, 4.642599013e-05,
+        -6.960066917e-05, 1.002935749e-04, -1.400615958e-04, 1.906675088e-04,
+        -2.541223527e-04, 3.327548886e-04, -4.293245181e-04, 5.472043535e-04,
+        -6.906797813e-04, 8.654431620e-04, -1.079435834e-03, 1.344338304e-03,
+        -1.678351401e-03, 2.111764812e-03, -2.699195100e-03, 3.550108536e-03,
+        -4.920057420e-03, 7.573458467e-03, -1.528942597e-02, 9.995970803e-01,
+        1.578035615e-02, -7.698154021e-03, 4.976860878e-03, -3.583053247e-03,
+        2.720994937e-03, -2.127409426e-03, 1.690187352e-03, -1.353611456e-03,
+        1.086869299e-03, -8.714874575e-04, 6.956331039e-04, -5.512751641e-04,
+        4.326661250e-04, -3.354854396e-04, 2.563367709e-04, -1.924447692e-04,
+        1.414692078e-04, -1.013903469e-04, 7.043840224e-05, -4.705050670e-05,
+        2.984463074e-05, -1.760360937e-05, 9.264745972e-06, -3.911999572e-06
+    },
+    {
+        -1.261668342e-05, 2.410799422e-05, -4.100850512e-05, 6.479753643e-05,
+        -9.717012633e-05, 1.400513796e-04, -1.956184306e-04, 2.663362609e-04,
+        -3.550168154e-04, 4.649159117e-04, -5.998907882e-04, 7.646555295e-04,
+        -9.651976017e-04, 1.209467935e-03, -1.508555239e-03, 1.878763722e-03,
+        -2.345489301e-03, 2.950976760e-03, -3.771356335e-03, 4.959095139e-03,
+        -6.869714831e-03, 1.056448653e-02, -2.126455085e-02, 9.992103695e-01,
+        2.222662730e-02, -1.080880960e-02, 6.981009450e-03, -5.023642750e-03,
+        3.814067897e-03, -2.981628551e-03, 2.368678913e-03, -1.896932148e-03,
+        1.523119247e-03, -1.221310209e-03, 9.749023867e-04, -7.726312537e-04,
+        6.064378215e-04, -4.702657354e-04, 3.593554076e-04, -2.698183533e-04,
+        1.983762909e-04, -1.422002278e-04, 9.881145358e-05, -6.602112007e-05,
+        4.189363053e-05, -2.472421973e-05, 1.302437100e-05, -5.510869726e-06
+    },
+    {
+        -1.613909728e-05, 3.086801682e-05, -5.253700659e-05, 8.304538586e-05,
+        -1.245695861e-04, 1.795815479e-04, -2.508768612e-04, 3.416206504e-04,
+        -4.554233038e-04, 5.964646279e-04, -7.696956939e-04, 9.811660806e-04,
+        -1.238557490e-03, 1.552067686e-03, -1.935914379e-03, 2.410995314e-03,
+        -3.009849041e-03, 3.786577566e-03, -4.838624260e-03, 6.360989356e-03,
+        -8.807841266e-03, 1.353215818e-02, -2.715800546e-02, 9.986948953e-01,
+        2.874805345e-02, -1.393586238e-02, 8.991729588e-03, -6.467637575e-03,
+        4.909193572e-03, -3.837221181e-03, 3.048163384e-03, -2.441013511e-03,
+        1.959977273e-03, -1.571633675e-03, 1.254591881e-03, -9.943436881e-04,
+        7.805127964e-04, -6.053036832e-04, 4.625915883e-04, -3.473738144e-04,
+        2.554334392e-04, -1.831319080e-04, 1.272814134e-04, -8.506701145e-05,
+        5.399942682e-05, -3.188615680e-05, 1.681268776e-05, -7.128411581e-06
+    },
+    {
+        -1.962273437e-05, 3.756680661e-05, -6.397426262e-05, 1.011629417e-04,
+        -1.517890402e-04, 2.188695307e-04, -3.058164337e-04, 4.164926871e-04,
+        -5.553043581e-04, 7.273518262e-04, -9.386755816e-04, 1.196654724e-03,
+        -1.510656725e-03, 1.893113630e-03, -2.361352666e-03, 2.940833335e-03,
+        -3.671181926e-03, 4.618255870e-03, -5.900604467e-03, 7.755281235e-03,
+        -1.073375581e-02, 1.647553310e-02, -3.296895591e-02, 9.980507780e-01,
+        3.534360922e-02, -1.707826738e-02, 1.100828798e-02, -7.914496429e-03,
+        6.005956529e-03, -4.693860754e-03, 3.728380522e-03, -2.985646732e-03,
+        2.397275506e-03, -1.922323141e-03, 1.534594003e-03, -1.216327187e-03,
+        9.548241136e-04, -7.405473898e-04, 5.660056782e-04, -4.250814168e-04,
+        3.126188170e-04, -2.241697623e-04, 1.558374519e-04, -1.041809725e-04,
+        6.615747266e-05, -3.908676385e-05, 2.062832364e-05, -8.764072917e-06
+    },
+    {
+        -2.306645143e-05, 4.420205567e-05, -7.531622966e-05, 1.191436942e-04,
+        -1.788185991e-04, 2.579009377e-04, -3.604169005e-04, 4.909246456e-04,
+        -6.546228535e-04, 8.575287139e-04, -1.106767316e-03, 1.411040813e-03,
+        -1.781393368e-03, 2.232477943e-03, -2.784710696e-03, 3.468079512e-03,
+        -4.329241121e-03, 5.445702729e-03, -6.956905819e-03, 9.141465548e-03,
+        -1.264678510e-02, 1.939368519e-02, -3.869659300e-02, 9.972781676e-01,
+        4.201224620e-02, -2.023496769e-02, 1.302994582e-02, -9.363674943e-03,
+        7.103939370e-03, -5.551219345e-03, 4.409069070e-03, -3.530622207e-03,
+        2.834845443e-03, -2.273243379e-03, 1.814800740e-03, -1.438496111e-03,
+        1.129304538e-03, -8.759447122e-04, 6.695578358e-04, -5.029112555e-04,
+        3.699104510e-04, -2.652980567e-04, 1.844686541e-04, -1.233557297e-04,
+        7.836317271e-05, -4.632334958e-05, 2.446988247e-05, -1.041728652e-05
+    },
+    {
+        -2.646913237e-05, 5.077149861e-05, -8.655892700e-05, 1.369812227e-04,
+        -2.056484955e-04, 2.966615418e-04, -4.146582280e-04, 5.648890757e-04,
+        -7.533420131e-04, 9.869469340e-04, -1.273908301e-03, 1.624244371e-03,
+        -2.050666298e-03, 2.570033808e-03, -3.205830304e-03, 3.992537116e-03,
+        -4.983781742e-03, 6.268611729e-03, -8.007140594e-03, 1.051904197e-02,
+        -1.454626355e-02, 2.228570275e-02, -4.434013242e-02, 9.963772443e-01,
+        4.875289313e-02, -2.340489481e-02, 1.505595904e-02, -1.081462586e-02,
+        8.202722892e-03, -6.408967786e-03, 5.089966855e-03, -4.075729627e-03,
+        3.272518015e-03, -2.624258694e-03, 2.095103693e-03, -1.660764497e-03,
+        1.303886561e-03, -1.011443278e-03, 7.732080280e-04, -5.808332674e-04,
+        4.272862392e-04, -3.065009529e-04, 2.131640233e-04, -1.425839466e-04,
+        9.061188483e-05, -5.359318900e-05, 2.833594496e-05, -1.208747034e-05
+    },
+    {
+        -2.982968851e-05, 5.727291323e-05, -9.769843811e-05, 1.546691979e-04,
+        -2.322690880e-04, 3.351372843e-04, -4.685206037e-04, 6.383588115e-04,
+        -8.514254217e-04, 1.115558583e-03, -1.440036508e-03, 1.836186114e-03,
+        -2.318375251e-03, 2.905655460e-03, -3.624554623e-03, 4.514011032e-03,
+        -5.634560946e-03, 7.086679098e-03, -9.050924618e-03, 1.188751524e-02,
+        -1.643153353e-02, 2.515068874e-02, -4.989881485e-02, 9.953482180e-01,
+        5.556445618e-02, -2.658696885e-02, 1.708557858e-02, -1.226679924e-02,
+        9.301886237e-03, -7.266775786e-03, 5.770810887e-03, -4.620758054e-03,
+        3.710123649e-03, -2.975232979e-03, 2.375394115e-03, -1.883046088e-03,
+        1.478502426e-03, -1.146990505e-03, 8.769160451e-04, -6.588172421e-04,
+        4.847239583e-04, -3.477625154e-04, 2.419124850e-04, -1.618582270e-04,
+        1.028989217e-04, -6.089352436e-05, 3.222506916e-05, -1.377402759e-05
+    },
+    {
+        -3.314705887e-05, 6.370412117e-05, -1.087309118e-04, 1.722013837e-04,
+        -2.586708639e-04, 3.733142801e-04, -5.219844428e-04, 7.113069818e-04,
+        -9.488370387e-04, 1.243316230e-03, -1.605090491e-03, 2.046787486e-03,
+        -2.584420858e-03, 3.239218231e-03, -4.040728145e-03, 5.032307835e-03,
+        -6.281338016e-03, 7.899603811e-03, -1.008787740e-02, 1.324639534e-02,
+        -1.830194563e-02, 2.798776096e-02, -5.537190610e-02, 9.941913285e-01,
+        6.244581916e-02, -2.978009893e-02, 1.911805063e-02, -1.371964266e-02,
+        1.040100705e-02, -8.124312056e-03, 6.451337460e-03, -5.165496000e-03,
+        4.147492336e-03, -3.326029762e-03, 2.655562958e-03, -2.105254370e-03,
+        1.653084153e-03, -1.282533620e-03, 9.806415164e-04, -7.368328338e-04,
+        5.422012730e-04, -3.890667166e-04, 2.707028919e-04, -1.811711173e-04,
+        1.152195526e-04, -6.822156613e-05, 3.613579091e-05, -1.547634698e-05
+    },
+    {
+        -3.642021042e-05, 7.006298854e-05, -1.196525636e-04, 1.895716395e-04,
+        -2.848444426e-04, 4.111788217e-04, -5.750303953e-04, 7.837070190e-04,
+        -1.045541211e-03, 1.370172929e-03, -1.769009414e-03, 2.255970682e-03,
+        -2.848704676e-03, 3.570598602e-03, -4.454196772e-03, 5.547235853e-03,
+        -6.923874450e-03, 8.707087696e-03, -1.111762227e-02, 1.459519765e-02,
+        -2.015685877e-02, 3.079605228e-02, -6.075869724e-02, 9.929068455e-01,
+        6.939584374e-02, -3.298318336e-02, 2.115261687e-02, -1.517260137e-02,
+        1.149966163e-02, -8.981244437e-03, 7.131282249e-03, -5.709731510e-03,
+        4.584453691e-03, -3.676512265e-03, 2.935500906e-03, -2.327302598e-03,
+        1.827563567e-03, -1.418019683e-03, 1.084343925e-03, -8.148495725e-04,
+        5.996957435e-04, -4.303974433e-04, 2.995240268e-04, -2.005151092e-04,
+        1.275690050e-04, -7.557449392e-05, 4.006662432e-05, -1.719380281e-05
+    },
+    {
+        -3.964813833e-05, 7.634742651e-05, -1.304596765e-04, 2.067739222e-04,
+        -3.107805790e-04, 4.487173848e-04, -6.276393527e-04, 8.555326690e-04,
+        -1.141502685e-03, 1.496082241e-03, -1.931733073e-03, 2.463658682e-03,
+        -3.111129230e-03, 3.899674239e-03, -4.864807876e-03, 6.058605242e-03,
+        -7.561934049e-03, 9.508835547e-03, -1.213978650e-02, 1.593344312e-02,
+        -2.199564049e-02, 3.357471087e-02, -6.605850474e-02, 9.914950682e-01,
+        7.641336975e-02, -3.619511001e-02, 2.318851472e-02, -1.662511857e-02,
+        1.259742509e-02, -9.837240019e-03, 7.810380411e-03, -6.253252243e-03,
+        5.020837021e-03, -4.026543451e-03, 3.215098425e-03, -2.549103836e-03,
+        2.001872323e-03, -1.553395600e-03, 1.187982624e-03, -8.928368757e-04,
+        6.571848346e-04, -4.717385024e-04, 3.283646078e-04, -2.198826426e-04,
+        1.399424663e-04, -8.294945752e-05, 4.401606226e-05, -1.892575518e-05
+    },
+    {
+        -4.282986616e-05, 8.255539189e-05, -1.411486027e-04, 2.238022879e-04,
+        -3.364701660e-04, 4.859166321e-04, -6.797924544e-04, 9.267579997e-04,
+        -1.236686620e-03, 1.620998247e-03, -2.093201913e-03, 2.669775272e-03,
+        -3.371598043e-03, 4.226324042e-03, -5.272410352e-03, 6.566228051e-03,
+        -8.195282994e-03, 1.030455522e-02, -1.315400144e-02, 1.726065841e-02,
+        -2.381766707e-02, 3.632290035e-02, -7.127067054e-02, 9.899563254e-01,
+        8.349721540e-02, -3.941475660e-02, 2.522497764e-02, -1.807663552e-02,
+        1.369387152e-02, -1.069196527e-02, 8.488366685e-03, -6.795845551e-03,
+        5.456471390e-03, -4.375986077e-03, 3.494245800e-03, -2.770570990e-03,
+        2.175941931e-03, -1.688608151e-03, 1.291516850e-03, -9.707640600e-04,
+        7.146459241e-04, -5.130736274e-04, 3.572132921e-04, -2.392661086e-04,
+        1.523350857e-04, -9.034357789e-05, 4.798257688e-05, -2.067155019e-05
+    },
+    {
+        -4.596444609e-05, 8.868488771e-05, -1.517157641e-04, 2.406508938e-04,
+        -3.619042381e-04, 5.227634185e-04, -7.314710947e-04, 9.973574106e-04,
+        -1.331058600e-03, 1.744875566e-03, -2.253357054e-03, 2.874245077e-03,
+        -3.630015672e-03, 4.550428190e-03, -5.676854672e-03, 7.069918292e-03,
+        -8.823689938e-03, 1.109395774e-02, -1.415990266e-02, 1.857637607e-02,
+        -2.562232379e-02, 3.903980001e-02, -7.639456218e-02, 9.882909755e-01,
+        9.064617756e-02, -4.264099099e-02, 2.726123535e-02, -1.952659184e-02,
+        1.478857414e-02, -1.154508616e-02, 9.164975498e-03, -7.337298559e-03,
+        5.891185686e-03, -4.724702752e-03, 3.772833181e-03, -2.991616834e-03,
+        2.349703783e-03, -1.823604006e-03, 1.394905743e-03, -1.048600353e-03,
+        7.720563114e-04, -5.543864841e-04, 3.860586802e-04, -2.586578518e-04,
+        1.647419757e-04, -9.775394818e-05, 5.196462012e-05, -2.243052009e-05
+    },
+    {
+        -4.905095912e-05, 9.473396370e-05, -1.621576539e-04, 2.573140003e-04,
+        -3.870739738e-04, 5.592447948e-04, -7.826569284e-04, 1.067305642e-03,
+        -1.424584647e-03, 1.867669371e-03, -2.412140309e-03, 3.076993584e-03,
+        -3.886287746e-03, 4.871868178e-03, -6.077992942e-03, 7.569492005e-03,
+        -9.446926081e-03, 1.187675741e-02, -1.515713003e-02, 1.988013469e-02,
+        -2.740900504e-02, 4.172460502e-02, -8.142957290e-02, 9.864994063e-01,
+        9.785903201e-02, -4.587267150e-02, 2.929651409e-02, -2.097442562e-02,
+        1.588110545e-02, -1.239626829e-02, 9.839941058e-03, -7.877398254e-03,
+        6.324808684e-03, -5.072555981e-03, 4.050750621e-03, -3.212154055e-03,
+        2.523089181e-03, -1.958329748e-03, 1.498108358e-03, -1.126314905e-03,
+        8.293932263e-04, -5.956606774e-04, 4.148893203e-04, -2.780501737e-04,
+        1.771582142e-04, -1.051776348e-04, 5.596062421e-05, -2.420198352e-05
+    },
+    {
+        -5.208851522e-05, 1.007007169e-04, -1.724708371e-04, 2.737859727e-04,
+        -4.119706989e-04, 5.953480125e-04, -8.333318778e-04, 1.136577781e-03,
+        -1.517231230e-03, 1.989335404e-03, -2.569494209e-03, 3.277947172e-03,
+        -4.140320994e-03, 5.190526866e-03, -6.475678949e-03, 8.064767323e-03,
+        -1.006476526e-02, 1.265267189e-02, -1.614532791e-02, 2.117147904e-02,
+        -2.917711456e-02, 4.437652656e-02, -8.637512168e-02, 9.845820348e-01,
+        1.051345338e-01, -4.910864722e-02, 3.133003693e-02, -2.241957370e-02,
+        1.697103742e-02, -1.324517703e-02, 1.051299746e-02, -8.415931557e-03,
+        6.757169114e-03, -5.419408228e-03, 4.327888124e-03, -3.432095277e-03,
+        2.696029363e-03, -2.092731891e-03, 1.601083681e-03, -1.203876802e-03,
+        8.866338375e-04, -6.368797570e-04, 4.436937128e-04, -2.974353354e-04,
+        1.895788464e-04, -1.126116784e-04, 5.996900227e-05, -2.598524569e-05
+    },
+    {
+        -5.507625353e-05, 1.065832919e-04, -1.826519519e-04, 2.900612828e-04,
+        -4.365858889e-04, 6.310605280e-04, -8.834781381e-04, 1.205149276e-03,
+        -1.608965279e-03, 2.109829992e-03, -2.725362015e-03, 3.477033134e-03,
+        -4.392023280e-03, 5.506288517e-03, -6.869768220e-03, 8.555564537e-03,
+        -1.067698401e-02, 1.342142232e-02, -1.712414520e-02, 2.244996023e-02,
+        -3.092606560e-02, 4.699479205e-02, -9.123065341e-02, 9.825393075e-01,
+        1.124714173e-01, -5.234775836e-02, 3.336102398e-02, -2.386147182e-02,
+        1.805794161e-02, -1.409147761e-02, 1.118387880e-02, -8.952685416e-03,
+        7.188095728e-03, -5.765121963e-03, 4.604135684e-03, -3.651353102e-03,
+        2.868455527e-03, -2.226756904e-03, 1.703790648e-03, -1.281255073e-03,
+        9.437552618e-04, -6.780272243e-04, 4.724603146e-04, -3.168055604e-04,
+        2.019988861e-04, -1.200530951e-04, 6.398814883e-05, -2.777959861e-05
+    },
+    {
+        -5.801334248e-05, 1.123798817e-04, -1.926977105e-04, 3.061345105e-04,
+        -4.609111721e-04, 6.663700063e-04, -9.330781838e-04, 1.272995939e-03,
+        -1.699754195e-03, 2.229110060e-03, -2.879687747e-03, 3.674179708e-03,
+        -4.641303639e-03, 5.819038840e-03, -7.260118067e-03, 9.041706161e-03,
+        -1.128336167e-02, 1.418273340e-02, -1.809323551e-02, 2.371513585e-02,
+        -3.265528106e-02, 4.957864528e-02, -9.599563884e-02, 9.803716995e-01,
+        1.198683968e-01, -5.558883651e-02, 3.538869270e-02, -2.529955488e-02,
+        1.914138938e-02, -1.493483529e-02, 1.185231926e-02, -9.487446878e-03,
+        7.617417364e-03, -6.109559715e-03, 4.879383326e-03, -3.869840138e-03,
+        3.040298863e-03, -2.360351228e-03, 1.806188160e-03, -1.358418711e-03,
+        1.000734573e-03, -7.190865382e-04, 5.011775435e-04, -3.361530377e-04,
+        2.144133184e-04, -1.274988775e-04, 6.801644038e-05, -2.958432133e-05
+    },
+    {
+        -6.089897995e-05, 1.180887279e-04, -2.026049001e-04, 3.220003457e-04,
+        -4.849383318e-04, 7.012643256e-04, -9.821147744e-04, 1.340093954e-03,
+        -1.789565862e-03, 2.347133150e-03, -3.032416197e-03, 3.869316095e-03,
+        -4.888072304e-03, 6.128665027e-03, -7.646587642e-03, 9.523016992e-03,
+        -1.188368045e-02, 1.493633349e-02, -1.905225727e-02, 2.496657011e-02,
+        -3.436419373e-02, 5.212734660e-02, -1.006695748e-01, 9.780797153e-01,
+        1.273241666e-01, -5.883070504e-02, 3.741225815e-02, -2.673325709e-02,
+        2.022095201e-02, -1.577491547e-02, 1.251805320e-02, -1.002000318e-02,
+        8.044963016e-03, -6.452584133e-03, 5.153521157e-03, -4.087469039e-03,
+        3.211490575e-03, -2.493461302e-03, 1.908235096e-03, -1.435336676e-03,
+        1.057548809e-03, -7.600411220e-04, 5.298337827e-04, -3.554699249e-04,
+        2.268171007e-04, -1.349459958e-04, 7.205223602e-05, -3.139868015e-05
+    },
+    {
+        -6.373239338e-05, 1.237081209e-04, -2.123703835e-04, 3.376535900e-04,
+        -5.086593092e-04, 7.357315805e-04, -1.030570960e-03, 1.406419891e-03,
+        -1.878368661e-03, 2.463857435e-03, -3.183492951e-03, 4.062372490e-03,
+        -5.132240742e-03, 6.435055797e-03, -8.029037983e-03, 9.999324175e-03,
+        -1.247772547e-02, 1.568195472e-02, -2.000087382e-02, 2.620383399e-02,
+        -3.605224639e-02, 5.464017308e-02, -1.052519840e-01, 9.756638877e-01,
+        1.348374015e-01, -6.207217937e-02, 3.943093328e-02, -2.816201224e-02,
+        2.129620087e-02, -1.661138382e-02, 1.318081530e-02, -1.055014183e-02,
+        8.470561899e-03, -6.794058030e-03, 5.426439399e-03, -4.304152536e-03,
+        3.381961911e-03, -2.626033578e-03, 2.009890333e-03, -1.511977912e-03,
+        1.114174985e-03, -8.008743696e-04, 5.584173852e-04, -3.747483511e-04,
+        2.392051655e-04, -1.423913989e-04, 7.609387797e-05, -3.322192886e-05
+    },
+    {
+        -6.651283985e-05, 1.292364008e-04, -2.219911002e-04, 3.530891575e-04,
+        -5.320662059e-04, 7.697600866e-04, -1.078430088e-03, 1.471950708e-03,
+        -1.966131472e-03, 2.579241727e-03, -3.332864410e-03, 4.253280106e-03,
+        -5.373721680e-03, 6.738101432e-03, -8.407332064e-03, 1.047045726e-02,
+        -1.306528491e-02, 1.641933303e-02, -2.093875354e-02, 2.742650538e-02,
+        -3.771889200e-02, 5.711641863e-02, -1.097424155e-01, 9.731247787e-01,
+        1.424067568e-01, -6.531206734e-02, 4.144392918e-02, -2.958525385e-02,
+        2.236670761e-02, -1.744390642e-02, 1.384034065e-02, -1.107765068e-02,
+        8.894043516e-03, -7.133844444e-03, 5.698028439e-03, -4.519803471e-03,
+        3.551644187e-03, -2.758014548e-03, 2.111112760e-03, -1.588311357e-03,
+        1.170590098e-03, -8.415696521e-04, 5.869166786e-04, -3.939804198e-04,
+        2.515724216e-04, -1.498320157e-04, 8.013969223e-05, -3.505330903e-05
+    },
+    {
+        -6.923960623e-05, 1.346719573e-04, -2.314640673e-04, 3.683020772e-04,
+        -5.551512860e-04, 8.033383835e-04, -1.125675804e-03, 1.536663760e-03,
+        -2.052823693e-03, 2.693245500e-03, -3.480477802e-03, 4.441971192e-03,
+        -5.612429140e-03, 7.037693815e-03, -8.781334845e-03, 1.093624826e-02,
+        -1.364615001e-02, 1.714820833e-02, -2.186556997e-02, 2.863416919e-02,
+        -3.936359386e-02, 5.955539419e-02, -1.141404442e-01, 9.704629783e-01,
+        1.500308689e-01, -6.854916956e-02, 4.345045539e-02, -3.100241546e-02,
+        2.343204430e-02, -1.827214984e-02, 1.449636481e-02, -1.160231803e-02,
+        9.315237723e-03, -7.471806690e-03, 5.968178871e-03, -4.734334832e-03,
+        3.720468820e-03, -2.889350761e-03, 2.211861295e-03, -1.664305959e-03,
+        1.226771139e-03, -8.821103241e-04, 6.153199694e-04, -4.131582124e-04,
+        2.639137565e-04, -1.572647560e-04, 8.418798917e-05, -3.689205023e-05
+    },
+    {
+        -7.191200921e-05, 1.400132305e-04, -2.407863800e-04, 3.832874935e-04,
+        -5.779069785e-04, 8.364552387e-04, -1.172292066e-03, 1.600536807e-03,
+        -2.138415249e-03, 2.805828899e-03, -3.626281206e-03, 4.628379062e-03,
+        -5.848278468e-03, 7.333726472e-03, -9.150913316e-03, 1.139653172e-02,
+        -1.422011519e-02, 1.786832454e-02, -2.278100191e-02, 2.982641751e-02,
+        -4.098582574e-02, 6.195642785e-02, -1.184456715e-01, 9.676791050e-01,
+        1.577083554e-01, -7.178227969e-02, 4.544972015e-02, -3.241293074e-02,
+        2.449178361e-02, -1.909578137e-02, 1.514862398e-02, -1.212393269e-02,
+        9.733974801e-03, -7.807808411e-03, 6.236781538e-03, -4.947659790e-03,
+        3.888367347e-03, -3.019988845e-03, 2.312094901e-03, -1.739930684e-03,
+        1.282695099e-03, -9.224797308e-04, 6.436155479e-04, -4.322737907e-04,
+        2.762240384e-04, -1.646865120e-04, 8.823706420e-05, -3.873737030e-05
+    },
+    {
+        -7.452939539e-05, 1.452587106e-04, -2.499552126e-04, 3.980406685e-04,
+        -6.003258800e-04, 8.690996511e-04, -1.218263139e-03, 1.663548023e-03,
+        -2.222876596e-03, 2.916952753e-03, -3.770223567e-03, 4.812438117e-03,
+        -6.081186359e-03, 7.626094603e-03, -9.515936544e-03, 1.185114475e-02,
+        -1.478697809e-02, 1.857942970e-02, -2.368473349e-02, 3.100284972e-02,
+        -4.258507206e-02, 6.431886496e-02, -1.226577247e-01, 9.647738056e-01,
+        1.654378158e-01, -7.501018487e-02, 4.744093069e-02, -3.381623379e-02,
+        2.554549895e-02, -1.991446903e-02, 1.579685505e-02, -1.264228408e-02,
+        1.015008552e-02, -8.141713636e-03, 6.503727573e-03, -5.159691728e-03,
+        4.055271461e-03, -3.149875530e-03, 2.411772603e-03, -1.815154529e-03,
+        1.338338982e-03, -9.626612140e-04, 6.717916925e-04, -4.513192006e-04,
+        2.884981178e-04, -1.720941593e-04, 9.228519835e-05, -4.058847566e-05
+    },
+    {
+        -7.709114130e-05, 1.504069388e-04, -2.589678187e-04, 4.125569826e-04,
+        -6.224007563e-04, 9.012608544e-04, -1.263573608e-03, 1.725676000e-03,
+        -2.306178738e-03, 3.026578588e-03, -3.912254714e-03, 4.994083865e-03,
+        -6.311070892e-03, 7.914695121e-03, -9.876275717e-03, 1.229992711e-02,
+        -1.534653966e-02, 1.928127604e-02, -2.457645434e-02, 3.216307262e-02,
+        -4.416082799e-02, 6.664206832e-02, -1.267762574e-01, 9.617477547e-01,
+        1.732178312e-01, -7.823166600e-02, 4.942329353e-02, -3.521175932e-02,
+        2.659276465e-02, -2.072788178e-02, 1.644079574e-02, -1.315716229e-02,
+        1.056340120e-02, -8.473386834e-03, 6.768908449e-03, -5.370344281e-03,
+        4.221113030e-03, -3.278957668e-03, 2.510853502e-03, -1.889946537e-03,
+        1.393679811e-03, -1.002638119e-03, 6.998366744e-04, -4.702864749e-04,
+        3.007308300e-04, -1.794845580e-04, 9.633065896e-05, -4.244456155e-05
+    },
+    {
+        -7.959665349e-05, 1.554565072e-04, -2.678215327e-04, 4.268319358e-04,
+        -6.441245447e-04, 9.329283203e-04, -1.308208378e-03, 1.786899755e-03,
+        -2.388293233e-03, 3.134668645e-03, -4.052325376e-03, 5.173252945e-03,
+        -6.537851553e-03, 8.199426686e-03, -1.023180419e-02, 1.274272126e-02,
+        -1.589860421e-02, 1.997362005e-02, -2.545585965e-02, 3.330670057e-02,
+        -4.571259966e-02, 6.892541824e-02, -1.308009496e-01, 9.586016546e-01,
+        1.810469654e-01, -8.144549812e-02, 5.139601473e-02, -3.659894285e-02,
+        2.763315614e-02, -2.153568965e-02, 1.708018469e-02, -1.366835820e-02,
+        1.097375379e-02, -8.802692963e-03, 7.032216017e-03, -5.579531368e-03,
+        4.385824130e-03, -3.407182252e-03, 2.609296796e-03, -1.964275808e-03,
+        1.448694639e-03, -1.042393802e-03, 7.277387627e-04, -4.891676366e-04,
+        3.129169970e-04, -1.868545544e-04, 1.003717003e-04, -4.430481233e-05
+    },
+    {
+        -8.204536849e-05, 1.604060593e-04, -2.765137696e-04, 4.408611493e-04,
+        -6.654903562e-04, 9.640917615e-04, -1.352152683e-03, 1.847198740e-03,
+        -2.469192202e-03, 3.241185883e-03, -4.190387201e-03, 5.349883148e-03,
+        -6.761449262e-03, 8.480189743e-03, -1.058239753e-02, 1.317937237e-02,
+        -1.644297950e-02, 2.065622261e-02, -2.632265028e-02, 3.443335555e-02,
+        -4.723990420e-02, 7.116831269e-02, -1.347315072e-01, 9.553362355e-01,
+        1.889237646e-01, -8.465045076e-02, 5.335830018e-02, -3.797722095e-02,
+        2.866625009e-02, -2.233756380e-02, 1.771476154e-02, -1.417566353e-02,
+        1.138097593e-02, -9.129497529e-03, 7.293542548e-03, -5.787167225e-03,
+        4.549337069e-03, -3.534496443e-03, 2.707061790e-03, -2.038111510e-03,
+        1.503360557e-03, -1.081911634e-03, 7.554862284e-04, -5.079547021e-04,
+        3.250514292e-04, -1.942009815e-04, 1.044065644e-04, -4.616840183e-05
+    },
+    {
+        -8.443675286e-05, 1.652542900e-04, -2.850420259e-04, 4.546403663e-04,
+        -6.864914774e-04, 9.947411350e-04, -1.395392085e-03, 1.906552846e-03,
+        -2.548848340e-03, 3.346094001e-03, -4.326392768e-03, 5.523913436e-03,
+        -6.981786406e-03, 8.756886552e-03, -1.092793355e-02, 1.360972845e-02,
+        -1.697947678e-02, 2.132884903e-02, -2.717653282e-02, 3.554266735e-02,
+        -4.874226996e-02, 7.337016740e-02, -1.385676626e-01, 9.519522547e-01,
+        1.968467581e-01, -8.784528833e-02, 5.530935593e-02, -3.934603144e-02,
+        2.969162458e-02, -2.313317675e-02, 1.834426708e-02, -1.467887093e-02,
+        1.178490102e-02, -9.453666638e-03, 7.552780782e-03, -5.993166443e-03,
+        4.711584416e-03, -3.660847585e-03, 2.804107919e-03, -2.111422893e-03,
+        1.557654703e-03, -1.121175013e-03, 7.830673497e-04, -5.266396842e-04,
+        3.371289281e-04, -2.015206611e-04, 1.084334814e-04, -4.803449358e-05
+    },
+    {
+        -8.677030317e-05, 1.699999459e-04, -2.934038805e-04, 4.681654533e-04,
+        -7.071213718e-04, 1.024866645e-03, -1.437912485e-03, 1.964942407e-03,
+        -2.627234920e-03, 3.449357444e-03, -4.460295606e-03, 5.695283965e-03,
+        -7.198786857e-03, 9.029421219e-03, -1.126829236e-02, 1.403364033e-02,
+        -1.750791086e-02, 2.199126912e-02, -2.801721976e-02, 3.663427365e-02,
+        -5.021923658e-02, 7.553041597e-02, -1.423091743e-01, 9.484504967e-01,
+        2.048144586e-01, -9.102877041e-02, 5.724838840e-02, -4.070481361e-02,
+        3.070885927e-02, -2.392220240e-02, 1.896844331e-02, -1.517777407e-02,
+        1.218536327e-02, -9.775067050e-03, 7.809823966e-03, -6.197443999e-03,
+        4.872499029e-03, -3.786183230e-03, 2.900394759e-03, -2.184179301e-03,
+        1.611554275e-03, -1.160167363e-03, 8.104704166e-04, -5.452145957e-04,
+        3.491442877e-04, -2.088104043e-04, 1.124506706e-04, -4.990224116e-05
+    },
+    {
+        -8.904554598e-05, 1.746418254e-04, -3.015969945e-04, 4.814324009e-04,
+        -7.273736825e-04, 1.054458746e-03, -1.479700119e-03, 2.022348213e-03,
+        -2.704325810e-03, 3.550941414e-03, -4.592050208e-03, 5.863936104e-03,
+        -7.412376002e-03, 9.297699736e-03, -1.160335641e-02, 1.445096175e-02,
+        -1.802810017e-02, 2.264325729e-02, -2.884442950e-02, 3.770782009e-02,
+        -5.167035512e-02, 7.764850994e-02, -1.459558270e-01, 9.448317731e-01,
+        2.128253626e-01, -9.419965219e-02, 5.917460475e-02, -4.205300843e-02,
+        3.171753558e-02, -2.470431626e-02, 1.958703357e-02, -1.567216772e-02,
+        1.258219779e-02, -1.009356623e-02, 8.064565899e-03, -6.399915291e-03,
+        5.032014078e-03, -3.910451159e-03, 2.995882048e-03, -2.256350185e-03,
+        1.665036534e-03, -1.198872149e-03, 8.376837355e-04, -5.636714523e-04,
+        3.610922974e-04, -2.160670133e-04, 1.164563411e-04, -5.177078855e-05
+    },
+    {
+        -9.126203780e-05, 1.791787791e-04, -3.096191122e-04, 4.944373249e-04,
+        -7.472422332e-04, 1.083508144e-03, -1.520741572e-03, 2.078751508e-03,
+        -2.780095472e-03, 3.650811886e-03, -4.721612045e-03, 6.029812454e-03,
+        -7.622480767e-03, 9.561630003e-03, -1.193301050e-02, 1.486154939e-02,
+        -1.853986685e-02, 2.328459262e-02, -2.965788652e-02, 3.876296044e-02,
+        -5.309518820e-02, 7.972391894e-02, -1.495074315e-01, 9.410969221e-01,
+        2.208779504e-01, -9.735668478e-02, 6.108721309e-02, -4.339005877e-02,
+        3.271723682e-02, -2.547919550e-02, 2.019978264e-02, -1.616184784e-02,
+        1.297524064e-02, -1.040903241e-02, 8.316900976e-03, -6.600496177e-03,
+        5.190063077e-03, -4.033599401e-03, 3.090529698e-03, -2.327905113e-03,
+        1.718078819e-03, -1.237272876e-03, 8.646956341e-04, -5.820022759e-04,
+        3.729677432e-04, -2.232872824e-04, 1.204486921e-04, -5.363927041e-05
+    },
+    {
+        -9.341936508e-05, 1.836097096e-04, -3.174680614e-04, 5.071764671e-04,
+        -7.667210302e-04, 1.112005802e-03, -1.561023774e-03, 2.134134002e-03,
+        -2.854518976e-03, 3.748935613e-03, -4.848937582e-03, 6.192856865e-03,
+        -7.829029640e-03, 9.821121867e-03, -1.225714185e-02, 1.526526293e-02,
+        -1.904303674e-02, 2.391505892e-02, -3.045732137e-02, 3.979935667e-02,
+        -5.449331010e-02, 8.175613071e-02, -1.529638248e-01, 9.372468085e-01,
+        2.289706870e-01, -1.004986156e-01, 6.298542285e-02, -4.471540961e-02,
+        3.370754839e-02, -2.624651916e-02, 2.080643683e-02, -1.664661164e-02,
+        1.336432892e-02, -1.072133463e-02, 8.566724228e-03, -6.799103001e-03,
+        5.346579909e-03, -4.155576257e-03, 3.184297814e-03, -2.398813788e-03,
+        1.770658552e-03, -1.275353103e-03, 8.914944661e-04, -6.001990980e-04,
+        3.847654108e-04, -2.304679996e-04, 1.244259143e-04, -5.550681243e-05
+    },
+    {
+        -9.551714410e-05, 1.879335719e-04, -3.251417539e-04, 5.196461965e-04,
+        -7.858042634e-04, 1.139942940e-03, -1.600534006e-03, 2.188477872e-03,
+        -2.927572007e-03, 3.845280141e-03, -4.973984292e-03, 6.353014457e-03,
+        -8.031952698e-03, 1.007608714e-02, -1.257564015e-02, 1.566196509e-02,
+        -1.953743953e-02, 2.453444481e-02, -3.124247083e-02, 4.081667905e-02,
+        -5.586430684e-02, 8.374465121e-02, -1.563248699e-01, 9.332823233e-01,
+        2.371020223e-01, -1.036241888e-01, 6.486844499e-02, -4.602850826e-02,
+        3.468805790e-02, -2.700596817e-02, 2.140674407e-02, -1.712625769e-02,
+        1.374930080e-02, -1.103034280e-02, 8.813931368e-03, -6.995652633e-03,
+        5.501498852e-03, -4.276330319e-03, 3.277146711e-03, -2.469046053e-03,
+        1.822753251e-03, -1.313096445e-03, 9.180686162e-04, -6.182539631e-04,
+        3.964800868e-04, -2.376059476e-04, 1.283861902e-04, -5.737253172e-05
+    },
+    {
+        -9.755502092e-05, 1.921493730e-04, -3.326381855e-04, 5.318430096e-04,
+        -8.044863087e-04, 1.167311037e-03, -1.639259906e-03, 2.241765770e-03,
+        -2.999230867e-03, 3.939813817e-03, -5.096710666e-03, 6.510231637e-03,
+        -8.231181622e-03, 1.032643965e-02, -1.288839754e-02, 1.605152167e-02,
+        -2.002290872e-02, 2.514254377e-02, -3.201307799e-02, 4.181460625e-02,
+        -5.720777634e-02, 8.568900471e-02, -1.595904559e-01, 9.292043834e-01,
+        2.452703912e-01, -1.067321455e-01, 6.673549235e-02, -4.732880459e-02,
+        3.565835540e-02, -2.775722559e-02, 2.200045406e-02, -1.760058598e-02,
+        1.412999561e-02, -1.133592775e-02, 9.058418830e-03, -7.190062502e-03,
+        5.654754607e-03, -4.395810493e-03, 3.369036928e-03, -2.538571910e-03,
+        1.874340535e-03, -1.350486579e-03, 9.444065045e-04, -6.361589315e-04,
+        4.081065615e-04, -2.446979051e-04, 1.323276947e-04, -5.923553708e-05
+    },
+    {
+        -9.953267131e-05, 1.962561728e-04, -3.399554366e-04, 5.437635316e-04,
+        -8.227617283e-04, 1.194101837e-03, -1.677189470e-03, 2.293980827e-03,
+        -3.069472491e-03, 4.032505799e-03, -5.217076231e-03, 6.664456114e-03,
+        -8.426649727e-03, 1.057209524e-02, -1.319530871e-02, 1.643380160e-02,
+        -2.049928173e-02, 2.573915422e-02, -3.276889226e-02, 4.279282541e-02,
+        -5.852332845e-02, 8.758873381e-02, -1.627604978e-01, 9.250139318e-01,
+        2.534742144e-01, -1.098212244e-01, 6.858577992e-02, -4.861575120e-02,
+        3.661803348e-02, -2.849997666e-02, 2.258731833e-02, -1.806939801e-02,
+        1.450625390e-02, -1.163796128e-02, 9.300083817e-03, -7.382250628e-03,
+        5.806282326e-03, -4.513966018e-03, 3.459929245e-03, -2.607361529e-03,
+        1.925398139e-03, -1.387507256e-03, 9.704965918e-04, -6.539060832e-04,
+        4.196396310e-04, -2.517406486e-04, 1.362485964e-04, -6.109492943e-05
+    },
+    {
+        -1.014498006e-04, 2.002530833e-04, -3.470916727e-04, 5.554045167e-04,
+        -8.406252729e-04, 1.220307346e-03, -1.714311055e-03, 2.345106658e-03,
+        -3.138274447e-03, 4.123326065e-03, -5.335041559e-03, 6.815636919e-03,
+        -8.618291981e-03, 1.081297181e-02, -1.349627086e-02, 1.680867699e-02,
+        -2.096639996e-02, 2.632407958e-02, -3.350966952e-02, 4.375103227e-02,
+        -5.981058511e-02, 8.944339954e-02, -1.658349367e-01, 9.207119366e-01,
+        2.617118986e-01, -1.128901618e-01, 7.041852512e-02, -4.988880370e-02,
+        3.756668746e-02, -2.923390897e-02, 2.316709034e-02, -1.853249688e-02,
+        1.487791750e-02, -1.193631622e-02, 9.538824335e-03, -7.572135659e-03,
+        5.956017636e-03, -4.630746489e-03, 3.549784701e-03, -2.675385260e-03,
+        1.975903917e-03, -1.424142302e-03, 9.963273841e-04, -6.714875208e-04,
+        4.310740991e-04, -2.587309532e-04, 1.401470578e-04, -6.294980213e-05
+    },
+    {
+        -1.033061437e-04, 2.041392690e-04, -3.540451441e-04, 5.667628491e-04,
+        -8.580718821e-04, 1.245919838e-03, -1.750613383e-03, 2.395127366e-03,
+        -3.205614944e-03, 4.212245425e-03, -5.450568282e-03, 6.963724417e-03,
+        -8.806045021e-03, 1.104898935e-02, -1.379118382e-02, 1.717602316e-02,
+        -2.142410880e-02, 2.689712835e-02, -3.423517215e-02, 4.468893121e-02,
+        -6.106918039e-02, 9.125258139e-02, -1.688137392e-01, 9.162993913e-01,
+        2.699818368e-01, -1.159376924e-01, 7.223294811e-02, -5.114742085e-02,
+        3.850391556e-02, -2.995871256e-02, 2.373952561e-02, -1.898968734e-02,
+        1.524482962e-02, -1.223086649e-02, 9.774539244e-03, -7.759636902e-03,
+        6.103896669e-03, -4.746101877e-03, 3.638564608e-03, -2.742613648e-03,
+        2.025835856e-03, -1.460375630e-03, 1.021887438e-03, -6.888953729e-04,
+        4.424047795e-04, -2.656655943e-04, 1.440212365e-04, -6.479924139e-05
+    },
+    {
+        -1.051014648e-04, 2.079139470e-04, -3.608141867e-04, 5.778355432e-04,
+        -8.750966864e-04, 1.270931856e-03, -1.786085547e-03, 2.444027550e-03,
+        -3.271472842e-03, 4.299235523e-03, -5.563619100e-03, 7.108670325e-03,
+        -8.989847179e-03, 1.128006996e-02, -1.407995001e-02, 1.753571866e-02,
+        -2.187225769e-02, 2.745811412e-02, -3.494516913e-02, 4.560623537e-02,
+        -6.229876060e-02, 9.301587739e-02, -1.716968978e-01, 9.117773143e-01,
+        2.782824087e-01, -1.189625493e-01, 7.402827209e-02, -5.239106485e-02,
+        3.942931904e-02, -3.067408007e-02, 2.430438179e-02, -1.944077591e-02,
+        1.560683483e-02, -1.252148712e-02, 1.000712829e-02, -7.944674355e-03,
+        6.249856085e-03, -4.859982549e-03, 3.726230569e-03, -2.809017442e-03,
+        2.075172083e-03, -1.496191242e-03, 1.047165363e-03, -7.061217975e-04,
+        4.536264983e-04, -2.725413488e-04, 1.478692855e-04, -6.664232660e-05
+    },
+    {
+        -1.068355573e-04, 2.115763865e-04, -3.673972215e-04, 5.886197445e-04,
+        -8.916950073e-04, 1.295336211e-03, -1.820717008e-03, 2.491792303e-03,
+        -3.335827652e-03, 4.384268855e-03, -5.674157796e-03, 7.250427729e-03,
+        -9.169638500e-03, 1.150613785e-02, -1.436247451e-02, 1.788764535e-02,
+        -2.231070020e-02, 2.800685568e-02, -3.563943607e-02, 4.650266670e-02,
+        -6.349898435e-02, 9.473290409e-02, -1.744844308e-01, 9.071467488e-01,
+        2.866119815e-01, -1.219634648e-01, 7.580372356e-02, -5.361920149e-02,
+        4.034250240e-02, -3.137970683e-02, 2.486141879e-02, -1.988557093e-02,
+        1.596377923e-02, -1.280805432e-02, 1.023649216e-02, -8.127168745e-03,
+        6.393833102e-03, -4.972339290e-03, 3.812744493e-03, -2.874567610e-03,
+        2.123890874e-03, -1.531573238e-03, 1.072149832e-03, -7.231589854e-04,
+        4.647340961e-04, -2.793549964e-04, 1.516893545e-04, -6.847813076e-05
+    },
+    {
+        -1.085082437e-04, 2.151259095e-04, -3.737927555e-04, 5.991127297e-04,
+        -9.078623591e-04, 1.319125989e-03, -1.854497601e-03, 2.538407221e-03,
+        -3.398659547e-03, 4.467318768e-03, -5.782149245e-03, 7.388951091e-03,
+        -9.345360756e-03, 1.172711942e-02, -1.463866507e-02, 1.823168842e-02,
+        -2.273929403e-02, 2.854317703e-02, -3.631775531e-02, 4.737795605e-02,
+        -6.466952265e-02, 9.640329666e-02, -1.771763819e-01, 9.024087623e-01,
+        2.949689099e-01, -1.249391702e-01, 7.755853263e-02, -5.483130040e-02,
+        4.124307349e-02, -3.207529102e-02, 2.541039884e-02, -2.032388266e-02,
+        1.631551045e-02, -1.309044555e-02, 1.046253251e-02, -8.307041558e-03,
+        6.535765519e-03, -5.083123324e-03, 3.898068610e-03, -2.939235352e-03,
+        2.171970666e-03, -1.566505824e-03, 1.096829579e-03, -7.399991633e-04,
+        4.757224299e-04, -2.861033213e-04, 1.554795903e-04, -7.030572085e-05
+    },
+    {
+        -1.101193755e-04, 2.185618898e-04, -3.799993812e-04, 6.093119074e-04,
+        -9.235944493e-04, 1.342294547e-03, -1.887417539e-03, 2.583858404e-03,
+        -3.459949365e-03, 4.548359472e-03, -5.887559423e-03, 7.524196270e-03,
+        -9.516957469e-03, 1.194294322e-02, -1.490843215e-02, 1.856773640e-02,
+        -2.315790109e-02, 2.906690748e-02, -3.697991597e-02, 4.823184323e-02,
+        -6.581005897e-02, 9.802670889e-02, -1.797728203e-01, 8.975644463e-01,
+        3.033515365e-01, -1.278883969e-01, 7.929193334e-02, -5.602683525e-02,
+        4.213064370e-02, -3.276053380e-02, 2.595108663e-02, -2.075552333e-02,
+        1.666187769e-02, -1.336853955e-02, 1.068515202e-02, -8.484215072e-03,
+        6.675591745e-03, -5.192286331e-03, 3.982165489e-03, -3.002992107e-03,
+        2.219390061e-03, -1.600973316e-03, 1.121193409e-03, -7.566345974e-04,
+        4.865863756e-04, -2.927831133e-04, 1.592381379e-04, -7.212415822e-05
+    },
+    {
+        -1.116688327e-04, 2.218837538e-04, -3.860157771e-04, 6.192148184e-04,
+        -9.388871794e-04, 1.364835519e-03, -1.919467411e-03, 2.628132464e-03,
+        -3.519678614e-03, 4.627366047e-03, -5.990355421e-03, 7.656120531e-03,
+        -9.684373925e-03, 1.215354001e-02, -1.517168894e-02, 1.889568123e-02,
+        -2.356638750e-02, 2.957788164e-02, -3.762571400e-02, 4.906407708e-02,
+        -6.692028927e-02, 9.960281319e-02, -1.822738405e-01, 8.926149161e-01,
+        3.117581924e-01, -1.308098761e-01, 8.100316390e-02, -5.720528395e-02,
+        4.300482811e-02, -3.343513939e-02, 2.648324936e-02, -2.118030726e-02,
+        1.700273187e-02, -1.364221639e-02, 1.090425440e-02, -8.658612389e-03,
+        6.813250822e-03, -5.299780475e-03, 4.064998053e-03, -3.065809572e-03,
+        2.266127840e-03, -1.634960149e-03, 1.145230202e-03, -7.730575964e-04,
+        4.973208303e-04, -2.993911692e-04, 1.629631409e-04, -7.393249902e-05
+    },
+    {
+        -1.131565242e-04, 2.250909798e-04, -3.918407073e-04, 6.288191357e-04,
+        -9.537366459e-04, 1.386742814e-03, -1.950638188e-03, 2.671216522e-03,
+        -3.577829480e-03, 4.704314451e-03, -6.090505450e-03, 7.784682560e-03,
+        -9.847557192e-03, 1.235884277e-02, -1.542835139e-02, 1.921541828e-02,
+        -2.396462367e-02, 3.007593954e-02, -3.825495226e-02, 4.987441554e-02,
+        -6.799992213e-02, 1.011313007e-01, -1.846795623e-01, 8.875613106e-01,
+        3.201871977e-01, -1.337023398e-01, 8.269146702e-02, -5.836612890e-02,
+        4.386524568e-02, -3.409881522e-02, 2.700665689e-02, -2.159805090e-02,
+        1.733792562e-02, -1.391135753e-02, 1.111974450e-02, -8.830157472e-03,
+        6.948682454e-03, -5.405558415e-03, 4.146529595e-03, -3.127659708e-03,
+        2.312162971e-03, -1.668450883e-03, 1.168928914e-03, -7.892605152e-04,
+        5.079207142e-04, -3.059242942e-04, 1.666527429e-04, -7.572979457e-05
+    },
+    {
+        -1.145823870e-04, 2.281830979e-04, -3.974730219e-04, 6.381226652e-04,
+        -9.681391408e-04, 1.408010619e-03, -1.980921226e-03, 2.713098215e-03,
+        -3.634384825e-03, 4.779181523e-03, -6.187978852e-03, 7.909842473e-03,
+        -1.000645613e-02, 1.255878672e-02, -1.567833823e-02, 1.952684637e-02,
+        -2.435248434e-02, 3.056092660e-02, -3.886744053e-02, 5.066262569e-02,
+        -6.904867874e-02, 1.026118811e-01, -1.869901306e-01, 8.824047918e-01,
+        3.286368616e-01, -1.365645207e-01, 8.435609019e-02, -5.950885716e-02,
+        4.471151935e-02, -3.475127207e-02, 2.752108179e-02, -2.200857292e-02,
+        1.766731334e-02, -1.417584586e-02, 1.133152826e-02, -8.998775170e-03,
+        7.081827029e-03, -5.509573332e-03, 4.226723794e-03, -3.188514757e-03,
+        2.357474616e-03, -1.701430208e-03, 1.192278589e-03, -8.052357579e-04,
+        5.183809731e-04, -3.123793037e-04, 1.703050876e-04, -7.751509183e-05
+    },
+    {
+        -1.159463863e-04, 2.311596901e-04, -4.029116566e-04, 6.471233455e-04,
+        -9.820911519e-04, 1.428633400e-03, -2.010308261e-03, 2.753765699e-03,
+        -3.689328200e-03, 4.851944992e-03, -6.282746108e-03, 8.031561831e-03,
+        -1.016102142e-02, 1.275330935e-02, -1.592157102e-02, 1.982986780e-02,
+        -2.472984857e-02, 3.103269375e-02, -3.946299561e-02, 5.142848385e-02,
+        -7.006629299e-02, 1.040442828e-01, -1.892057153e-01, 8.771465444e-01,
+        3.371054833e-01, -1.393951528e-01, 8.599628597e-02, -6.063296066e-02,
+        4.554327623e-02, -3.539222414e-02, 2.802629948e-02, -2.241169429e-02,
+        1.799075133e-02, -1.443556576e-02, 1.153951284e-02, -9.164391255e-03,
+        7.212625649e-03, -5.611778947e-03, 4.305544729e-03, -3.248347251e-03,
+        2.402042142e-03, -1.733882954e-03, 1.215268356e-03, -8.209757815e-04,
+        5.286965803e-04, -3.187530240e-04, 1.739183202e-04, -7.928743376e-05
+    },
+    {
+        -1.172485153e-04, 2.340203901e-04, -4.081556329e-04, 6.558192483e-04,
+        -9.955893637e-04, 1.448605903e-03, -2.038791419e-03, 2.793207652e-03,
+        -3.742643843e-03, 4.922583482e-03, -6.374778846e-03, 8.149803645e-03,
+        -1.031120557e-02, 1.294235040e-02, -1.615797411e-02, 2.012438842e-02,
+        -2.509659981e-02, 3.149109740e-02, -4.004144136e-02, 5.217177557e-02,
+        -7.105251151e-02, 1.054282530e-01, -1.913265112e-01, 8.717877759e-01,
+        3.455913519e-01, -1.421929719e-01, 8.761131227e-02, -6.173793645e-02,
+        4.636014776e-02, -3.602138922e-02, 2.852208827e-02, -2.280723835e-02,
+        1.830809777e-02, -1.469040314e-02, 1.174360658e-02, -9.326932452e-03,
+        7.341020151e-03, -5.712129539e-03, 4.382956897e-03, -3.307130025e-03,
+        2.445845129e-03, -1.765794094e-03, 1.237887439e-03, -8.364730989e-04,
+        5.388625393e-04, -3.250422942e-04, 1.774905881e-04, -8.104585980e-05
+    },
+    {
+        -1.184887949e-04, 2.367648827e-04, -4.132040579e-04, 6.642085782e-04,
+        -1.008630657e-03, 1.467923153e-03, -2.066363213e-03, 2.831413273e-03,
+        -3.794316682e-03, 4.991076518e-03, -6.464049850e-03, 8.264532394e-03,
+        -1.045696290e-02, 1.312585194e-02, -1.638747474e-02, 2.041031758e-02,
+        -2.545262594e-02, 3.193599953e-02, -4.060260870e-02, 5.289229574e-02,
+        -7.200709369e-02, 1.067635575e-01, -1.933527375e-01, 8.663297156e-01,
+        3.540927471e-01, -1.449567159e-01, 8.920043267e-02, -6.282328684e-02,
+        4.716176985e-02, -3.663848879e-02, 2.900822950e-02, -2.319503089e-02,
+        1.861921283e-02, -1.494024549e-02, 1.194371910e-02, -9.486326473e-03,
+        7.466953134e-03, -5.810579968e-03, 4.458925225e-03, -3.364836226e-03,
+        2.488863380e-03, -1.797148754e-03, 1.260125161e-03, -8.517202823e-04,
+        5.488738857e-04, -3.312439675e-04, 1.810200413e-04, -8.278940624e-05
+    },
+    {
+        -1.196672733e-04, 2.393929040e-04, -4.180561242e-04, 6.722896730e-04,
+        -1.021212112e-03, 1.486580458e-03, -2.093016545e-03, 2.868372289e-03,
+        -3.844332346e-03, 5.057404530e-03, -6.550533065e-03, 8.375714028e-03,
+        -1.059824961e-02, 1.330375833e-02, -1.661000301e-02, 2.068756824e-02,
+        -2.579781928e-02, 3.236726770e-02, -4.114633571e-02, 5.358984858e-02,
+        -7.292981175e-02, 1.080499805e-01, -1.952846382e-01, 8.607736149e-01,
+        3.626079399e-01, -1.476851251e-01, 9.076291669e-02, -6.388851967e-02,
+        4.794778304e-02, -3.724324812e-02, 2.948450763e-02, -2.357490023e-02,
+        1.892395871e-02, -1.518498194e-02, 1.213976131e-02, -9.642502044e-03,
+        7.590367982e-03, -5.907085691e-03, 4.533415089e-03, -3.421439332e-03,
+        2.531076929e-03, -1.827932217e-03, 1.281970945e-03, -8.667099665e-04,
+        5.587256893e-04, -3.373549126e-04, 1.845048340e-04, -8.451710674e-05
+    },
+    {
+        -1.207840262e-04, 2.419042410e-04, -4.227111094e-04, 6.800610035e-04,
+        -1.033331002e-03, 1.504573407e-03, -2.118744708e-03, 2.904074955e-03,
+        -3.892677159e-03, 5.121548859e-03, -6.634203604e-03, 8.483315978e-03,
+        -1.073502376e-02, 1.347601625e-02, -1.682549191e-02, 2.095605692e-02,
+        -2.613207662e-02, 3.278477511e-02, -4.167246765e-02, 5.426424774e-02,
+        -7.382045073e-02, 1.092873253e-01, -1.971224817e-01, 8.551207466e-01,
+        3.711351925e-01, -1.503769427e-01, 9.229804007e-02, -6.493314847e-02,
+        4.871783264e-02, -3.783539641e-02, 2.995071027e-02, -2.394667727e-02,
+        1.922219971e-02, -1.542450330e-02, 1.233164545e-02, -9.795388936e-03,
+        7.711208893e-03, -6.001602786e-03, 4.606392326e-03, -3.476913154e-03,
+        2.572466048e-03, -1.858129930e-03, 1.303414324e-03, -8.814348523e-04,
+        5.684130567e-04, -3.433720152e-04, 1.879431248e-04, -8.622799269e-05
+    },
+    {
+        -1.218391560e-04, 2.442987314e-04, -4.271683763e-04, 6.875211735e-04,
+        -1.044984802e-03, 1.521897871e-03, -2.143541386e-03, 2.938512054e-03,
+        -3.939338148e-03, 5.183491759e-03, -6.715037754e-03, 8.587307168e-03,
+        -1.086724527e-02, 1.364257474e-02, -1.703387734e-02, 2.121570378e-02,
+        -2.645529927e-02, 3.318840060e-02, -4.218085697e-02, 5.491531628e-02,
+        -7.467880857e-02, 1.104754133e-01, -1.988665605e-01, 8.493724047e-01,
+        3.796727592e-01, -1.530309151e-01, 9.380508507e-02, -6.595669270e-02,
+        4.947156890e-02, -3.841466691e-02, 3.040662838e-02, -2.431019559e-02,
+        1.951380227e-02, -1.565870208e-02, 1.251928512e-02, -9.944918001e-03,
+        7.829420899e-03, -6.094087966e-03, 4.677823253e-03, -3.531231856e-03,
+        2.613011260e-03, -1.887727512e-03, 1.324444942e-03, -8.958877099e-04,
+        5.779311333e-04, -3.492921792e-04, 1.913330778e-04, -8.792109370e-05
+    },
+    {
+        -1.228327918e-04, 2.465762630e-04, -4.314273726e-04, 6.946689195e-04,
+        -1.056171183e-03, 1.538550005e-03, -2.167400657e-03, 2.971674903e-03,
+        -3.984303047e-03, 5.243216403e-03, -6.793012983e-03, 8.687658017e-03,
+        -1.099487595e-02, 1.380338518e-02, -1.723509813e-02, 2.146643260e-02,
+        -2.676739306e-02, 3.357802871e-02, -4.267136339e-02, 5.554288674e-02,
+        -7.550469609e-02, 1.116140849e-01, -2.005171912e-01, 8.435299038e-01,
+        3.882188865e-01, -1.556457924e-01, 9.528334076e-02, -6.695867792e-02,
+        5.020864715e-02, -3.898079701e-02, 3.085205626e-02, -2.466529149e-02,
+        1.979863506e-02, -1.588747260e-02, 1.270259535e-02, -1.009102119e-02,
+        7.944949890e-03, -6.184498602e-03, 4.747674677e-03, -3.584369961e-03,
+        2.652693345e-03, -1.916710759e-03, 1.345052562e-03, -9.100613815e-04,
+        5.872751053e-04, -3.551123284e-04, 1.946728633e-04, -8.959543805e-05
+    },
+    {
+        -1.237650893e-04, 2.487367739e-04, -4.354876303e-04, 7.015031106e-04,
+        -1.066888013e-03, 1.554526247e-03, -2.190316992e-03, 3.003555350e-03,
+        -4.027560294e-03, 5.300706889e-03, -6.868107944e-03, 8.784340453e-03,
+        -1.111787952e-02, 1.395840131e-02, -1.742909604e-02, 2.170817081e-02,
+        -2.706826838e-02, 3.395354968e-02, -4.314385389e-02, 5.614680118e-02,
+        -7.629793701e-02, 1.127031987e-01, -2.020747143e-01, 8.375945793e-01,
+        3.967718140e-01, -1.582203290e-01, 9.673210328e-02, -6.793863598e-02,
+        5.092872793e-02, -3.953352836e-02, 3.128679168e-02, -2.501180411e-02,
+        2.007656900e-02, -1.611071096e-02, 1.288149259e-02, -1.023363161e-02,
+        8.057742640e-03, -6.272792741e-03, 4.815913912e-03, -3.636302364e-03,
+        2.691493348e-03, -1.945065650e-03, 1.365227065e-03, -9.239487857e-04,
+        5.964402026e-04, -3.608294078e-04, 1.979606591e-04, -9.125005313e-05
+    },
+    {
+        -1.246362299e-04, 2.507802519e-04, -4.393487657e-04, 7.080227483e-04,
+        -1.077133359e-03, 1.569823317e-03, -2.212285254e-03, 3.034145778e-03,
+        -4.069099039e-03, 5.355948235e-03, -6.940302479e-03, 8.877327912e-03,
+        -1.123622157e-02, 1.410757926e-02, -1.761581581e-02, 2.194084955e-02,
+        -2.735784018e-02, 3.431485950e-02, -4.359820276e-02, 5.672691116e-02,
+        -7.705836799e-02, 1.137426321e-01, -2.035394938e-01, 8.315677861e-01,
+        4.053297743e-01, -1.607532833e-01, 9.815067617e-02, -6.889610528e-02,
+        5.163147718e-02, -4.007260701e-02, 3.171063597e-02, -2.534957543e-02,
+        2.034747734e-02, -1.632831516e-02, 1.305589480e-02, -1.037268352e-02,
+        8.167746831e-03, -6.358929121e-03, 4.882508795e-03, -3.687004345e-03,
+        2.729392590e-03, -1.972778354e-03, 1.384958461e-03, -9.375429196e-04,
+        6.054217001e-04, -3.664403847e-04, 2.011946507e-04, -9.288396590e-05
+    },
+    {
+        -1.254464212e-04, 2.527067339e-04, -4.430104788e-04, 7.142269662e-04,
+        -1.086905485e-03, 1.584438221e-03, -2.233300703e-03, 3.063439104e-03,
+        -4.108909140e-03, 5.408926392e-03, -7.009577624e-03, 8.966595350e-03,
+        -1.134986962e-02, 1.425087754e-02, -1.779520514e-02, 2.216440361e-02,
+        -2.763602801e-02, 3.466185993e-02, -4.403429164e-02, 5.728307781e-02,
+        -7.778583862e-02, 1.147322806e-01, -2.049119173e-01, 8.254508993e-01,
+        4.138909939e-01, -1.632434190e-01, 9.953837060e-02, -6.983063088e-02,
+        5.231656631e-02, -4.059778346e-02, 3.212339411e-02, -2.567845043e-02,
+        2.061123571e-02, -1.654018507e-02, 1.322572143e-02, -1.050811236e-02,
+        8.274911073e-03, -6.442867197e-03, 4.947427698e-03, -3.736451578e-03,
+        2.766372674e-03, -1.999835238e-03, 1.404236890e-03, -9.508368629e-04,
+        6.142149206e-04, -3.719422510e-04, 2.043730326e-04, -9.449620337e-05
+    },
+    {
+        -1.261958961e-04, 2.545163062e-04, -4.464725531e-04, 7.201150295e-04,
+        -1.096202849e-03, 1.598368245e-03, -2.253358992e-03, 3.091428783e-03,
+        -4.146981171e-03, 5.459628240e-03, -7.075915613e-03, 9.052119243e-03,
+        -1.145879311e-02, 1.438825707e-02, -1.796721471e-02, 2.237877150e-02,
+        -2.790275606e-02, 3.499445851e-02, -4.445200950e-02, 5.781517183e-02,
+        -7.848021142e-02, 1.156720582e-01, -2.061923958e-01, 8.192453130e-01,
+        4.224536935e-01, -1.656895049e-01, 1.008945057e-01, -7.074176478e-02,
+        5.298367244e-02, -4.110881285e-02, 3.252487480e-02, -2.599827705e-02,
+        2.086772218e-02, -1.674622254e-02, 1.339089351e-02, -1.063985483e-02,
+        8.379184931e-03, -6.524567150e-03, 5.010639542e-03, -3.784620142e-03,
+        2.802415493e-03, -2.026222872e-03, 1.423052626e-03, -9.638237804e-04,
+        6.228152367e-04, -3.773320234e-04, 2.074940090e-04, -9.608579306e-05
+    },
+    {
+        -1.268849126e-04, 2.562091034e-04, -4.497348552e-04, 7.256863347e-04,
+        -1.105024111e-03, 1.611610961e-03, -2.272456170e-03, 3.118108806e-03,
+        -4.183306417e-03, 5.508041589e-03, -7.139299881e-03, 9.133877598e-03,
+        -1.156296340e-02, 1.451968116e-02, -1.813179819e-02, 2.258389546e-02,
+        -2.815795313e-02, 3.531256858e-02, -4.485125270e-02, 5.832307351e-02,
+        -7.914136185e-02, 1.165618974e-01, -2.073813632e-01, 8.129524403e-01,
+        4.310160884e-01, -1.680903154e-01, 1.022184088e-01, -7.162906605e-02,
+        5.363247845e-02, -4.160545499e-02, 3.291489055e-02, -2.630890637e-02,
+        2.111681729e-02, -1.694633141e-02, 1.355133365e-02, -1.076784885e-02,
+        8.480518943e-03, -6.603989912e-03, 5.072113816e-03, -3.831486532e-03,
+        2.837503243e-03, -2.051928031e-03, 1.441396086e-03, -9.764969260e-04,
+        6.312180729e-04, -3.826067460e-04, 2.105557948e-04, -9.765176345e-05
+    },
+    {
+        -1.275137536e-04, 2.577853084e-04, -4.527973341e-04, 7.309404092e-04,
+        -1.113368123e-03, 1.624164223e-03, -2.290588681e-03, 3.143473699e-03,
+        -4.217876877e-03, 5.554155187e-03, -7.199715066e-03, 9.211849950e-03,
+        -1.166235378e-02, 1.464511553e-02, -1.828891226e-02, 2.277972146e-02,
+        -2.840155265e-02, 3.561610931e-02, -4.523192499e-02, 5.880667273e-02,
+        -7.976917829e-02, 1.174017487e-01, -2.084792765e-01, 8.065737128e-01,
+        4.395763892e-01, -1.704446309e-01, 1.035094156e-01, -7.249210104e-02,
+        5.426267318e-02, -4.208747451e-02, 3.329325776e-02, -2.661019257e-02,
+        2.135840413e-02, -1.714041755e-02, 1.370696606e-02, -1.089203365e-02,
+        8.578864646e-03, -6.681097181e-03, 5.131820584e-03, -3.877027673e-03,
+        2.871618426e-03, -2.076937709e-03, 1.459257827e-03, -9.888496450e-04,
+        6.394189079e-04, -3.877634909e-04, 2.135566163e-04, -9.919314450e-05
+    },
+    {
+        -1.280827265e-04, 2.592451521e-04, -4.556600211e-04, 7.358769106e-04,
+        -1.121233935e-03, 1.636026166e-03, -2.307753362e-03, 3.167518527e-03,
+        -4.250685269e-03, 5.597958715e-03, -7.257147012e-03, 9.286017371e-03,
+        -1.175693947e-02, 1.476452834e-02, -1.843851662e-02, 2.296619919e-02,
+        -2.863349274e-02, 3.590500569e-02, -4.559393752e-02, 5.926586899e-02,
+        -8.036356206e-02, 1.181915809e-01, -2.094866149e-01, 8.001105803e-01,
+        4.481328019e-01, -1.727512384e-01, 1.047668709e-01, -7.333044360e-02,
+        5.487395155e-02, -4.255464096e-02, 3.365979682e-02, -2.690199309e-02,
+        2.159236840e-02, -1.732838892e-02, 1.385771664e-02, -1.101234973e-02,
+        8.674174598e-03, -6.755851439e-03, 5.189730502e-03, -3.921220926e-03,
+        2.904743859e-03, -2.101239120e-03, 1.476628558e-03, -1.000875378e-03,
+        6.474132769e-04, -3.927993600e-04, 2.164947121e-04, -1.007089681e-04
+    },
+    {
+        -1.285921627e-04, 2.605889124e-04, -4.583230290e-04, 7.404956263e-04,
+        -1.128620793e-03, 1.647195210e-03, -2.323947446e-03, 3.190238891e-03,
+        -4.281725023e-03, 5.639442794e-03, -7.311582772e-03, 9.356362470e-03,
+        -1.184669763e-02, 1.487789016e-02, -1.858057398e-02, 2.314328212e-02,
+        -2.885371617e-02, 3.617918859e-02, -4.593720886e-02, 5.970057141e-02,
+        -8.092442735e-02, 1.189313808e-01, -2.104038806e-01, 7.935645102e-01,
+        4.566835286e-01, -1.750089316e-01, 1.059901282e-01, -7.414367522e-02,
+        5.546601467e-02, -4.300672891e-02, 3.401433216e-02, -2.718416860e-02,
+        2.181859841e-02, -1.751015559e-02, 1.400351297e-02, -1.112873897e-02,
+        8.766402395e-03, -6.828215968e-03, 5.245814834e-03, -3.964044100e-03,
+        2.936862684e-03, -2.124819704e-03, 1.493499140e-03, -1.012567664e-03,
+        6.551967736e-04, -3.977114863e-04, 2.193683341e-04, -1.021982685e-04
+    },
+    {
+        -1.290424177e-04, 2.618169144e-04, -4.607865514e-04, 7.447964728e-04,
+        -1.135528134e-03, 1.657670053e-03, -2.339168558e-03, 3.211630930e-03,
+        -4.310990286e-03, 5.678598978e-03, -7.363010605e-03, 9.422869394e-03,
+        -1.193160736e-02, 1.498517400e-02, -1.871505007e-02, 2.331092747e-02,
+        -2.906217040e-02, 3.643859469e-02, -4.626166501e-02, 6.011069871e-02,
+        -8.145170126e-02, 1.196211533e-01, -2.112315976e-01, 7.869369873e-01,
+        4.652267680e-01, -1.772165116e-01, 1.071785505e-01, -7.493138523e-02,
+        5.603857001e-02, -4.344351804e-02, 3.435669235e-02, -2.745658316e-02,
+        2.203698518e-02, -1.768562982e-02, 1.414428435e-02, -1.124114457e-02,
+        8.855502701e-03, -6.898154868e-03, 5.300045461e-03, -4.005475464e-03,
+        2.967958375e-03, -2.147667135e-03, 1.509860591e-03, -1.023920142e-03,
+        6.627650520e-04, -4.024970351e-04, 2.221757481e-04, -1.036600828e-04
+    },
+    {
+        -1.294338700e-04, 2.629295295e-04, -4.630508627e-04, 7.487794951e-04,
+        -1.141955593e-03, 1.667449677e-03, -2.353414718e-03, 3.231691316e-03,
+        -4.338475921e-03, 5.715419760e-03, -7.411419981e-03, 9.485523835e-03,
+        -1.201164971e-02, 1.508635528e-02, -1.884191366e-02, 2.346909621e-02,
+        -2.925880756e-02, 3.668316658e-02, -4.656723940e-02, 6.049617924e-02,
+        -8.194532373e-02, 1.202609213e-01, -2.119703120e-01, 7.802295134e-01,
+        4.737607158e-01, -1.793727870e-01, 1.083315103e-01, -7.569317100e-02,
+        5.659133152e-02, -4.386479324e-02, 3.468671019e-02, -2.771910421e-02,
+        2.224742250e-02, -1.785472604e-02, 1.427996185e-02, -1.134951115e-02,
+        8.941431258e-03, -6.965633075e-03, 5.352394895e-03, -4.045493755e-03,
+        2.998014747e-03, -2.169769326e-03, 1.525704092e-03, -1.034926556e-03,
+        6.701138293e-04, -4.071532059e-04, 2.249152349e-04, -1.050934518e-04
+    },
+    {
+        -1.297669214e-04, 2.639271751e-04, -4.651163170e-04, 7.524448660e-04,
+        -1.147902996e-03, 1.676533342e-03, -2.366684337e-03, 3.250417261e-03,
+        -4.364177505e-03, 5.749898572e-03, -7.456801580e-03, 9.544313025e-03,
+        -1.208680768e-02, 1.518141189e-02, -1.896113655e-02, 2.361775311e-02,
+        -2.944358448e-02, 3.691285270e-02, -4.685387287e-02, 6.085695096e-02,
+        -8.240524754e-02, 1.208507252e-01, -2.126205916e-01, 7.734436068e-01,
+        4.822835653e-01, -1.814765745e-01, 1.094483900e-01, -7.642863810e-02,
+        5.712401975e-02, -4.427034473e-02, 3.500422274e-02, -2.797160265e-02,
+        2.244980692e-02, -1.801736095e-02, 1.441047830e-02, -1.145378472e-02,
+        9.024144917e-03, -7.030616374e-03, 5.402836297e-03, -4.084078191e-03,
+        3.027015961e-03, -2.191114434e-03, 1.541020989e-03, -1.045580759e-03,
+        6.772388873e-04, -4.116772335e-04, 2.275850911e-04, -1.064974196e-04
+    },
+    {
+        -1.300419964e-04, 2.648103141e-04, -4.669833474e-04, 7.557928853e-04,
+        -1.153370362e-03, 1.684920586e-03, -2.378976219e-03, 3.267806509e-03,
+        -4.388091329e-03, 5.782029781e-03, -7.499147293e-03, 9.599225738e-03,
+        -1.215706621e-02, 1.527032414e-02, -1.907269359e-02, 2.375686670e-02,
+        -2.961646270e-02, 3.712760736e-02, -4.712151374e-02, 6.119296141e-02,
+        -8.283143828e-02, 1.213906235e-01, -2.131830256e-01, 7.665808017e-01,
+        4.907935075e-01, -1.835266990e-01, 1.105285822e-01, -7.713740050e-02,
+        5.763636199e-02, -4.465996815e-02, 3.530907144e-02, -2.821395292e-02,
+        2.264403784e-02, -1.817345351e-02, 1.453576838e-02, -1.155391275e-02,
+        9.103601651e-03, -7.093071418e-03, 5.451343480e-03, -4.121208476e-03,
+        3.054946532e-03, -2.211690867e-03, 1.555802799e-03, -1.055876711e-03,
+        6.841360748e-04, -4.160663890e-04, 2.301836300e-04, -1.078710353e-04
+    },
+    {
+        -1.302595417e-04, 2.655794541e-04, -4.686524660e-04, 7.588239790e-04,
+        -1.158357900e-03, 1.692611228e-03, -2.390289555e-03, 3.283857336e-03,
+        -4.410214398e-03, 5.811808690e-03, -7.538450218e-03, 9.650252292e-03,
+        -1.222241217e-02, 1.535307477e-02, -1.917656265e-02, 2.388640927e-02,
+        -2.977740842e-02, 3.732739075e-02, -4.737011773e-02, 6.150416774e-02,
+        -8.322387426e-02, 1.218806920e-01, -2.136582246e-01, 7.596426482e-01,
+        4.992887321e-01, -1.855219945e-01, 1.115714896e-01, -7.781908071e-02,
+        5.812809239e-02, -4.503346463e-02, 3.560110219e-02, -2.844603302e-02,
+        2.283001754e-02, -1.832292501e-02, 1.465576860e-02, -1.164984415e-02,
+        9.179760579e-03, -7.152965744e-03, 5.497890932e-03, -4.156864816e-03,
+        3.081791340e-03, -2.231487289e-03, 1.570041212e-03, -1.065808489e-03,
+        6.908013096e-04, -4.203179820e-04, 2.327091822e-04, -1.092133523e-04
+    },
+    {
+        -1.304200256e-04, 2.662351472e-04, -4.701242623e-04, 7.615386982e-04,
+        -1.162866012e-03, 1.699605360e-03, -2.400623928e-03, 3.298568553e-03,
+        -4.430544429e-03, 5.839231537e-03, -7.574704663e-03, 9.697384548e-03,
+        -1.228283442e-02, 1.542964899e-02, -1.927272464e-02, 2.400635692e-02,
+        -2.992639259e-02, 3.751216895e-02, -4.759964798e-02, 6.179053667e-02,
+        -8.358254655e-02, 1.223210242e-01, -2.140468201e-01, 7.526307116e-01,
+        5.077674275e-01, -1.874613040e-01, 1.125765258e-01, -7.847330999e-02,
+        5.859895208e-02, -4.539064090e-02, 3.588016535e-02, -2.866772461e-02,
+        2.300765127e-02, -1.846569910e-02, 1.477041737e-02, -1.174152933e-02,
+        9.252581982e-03, -7.210267786e-03, 5.542453821e-03, -4.191027924e-03,
+        3.107535634e-03, -2.250492626e-03, 1.583728100e-03, -1.075370284e-03,
+        6.972305808e-04, -4.244293612e-04, 2.351600969e-04, -1.105234297e-04
+    },
+    {
+        -1.305239384e-04, 2.667779894e-04, -4.713994033e-04, 7.639377188e-04,
+        -1.166895287e-03, 1.705903352e-03, -2.409979309e-03, 3.311939500e-03,
+        -4.449079848e-03, 5.864295492e-03, -7.607906141e-03, 9.740615903e-03,
+        -1.233832372e-02, 1.550003441e-02, -1.936116353e-02, 2.411668950e-02,
+        -3.006339080e-02, 3.768191387e-02, -4.781007507e-02, 6.205204445e-02,
+        -8.390745886e-02, 1.227117309e-01, -2.143494641e-01, 7.455465719e-01,
+        5.162277817e-01, -1.893434802e-01, 1.135431152e-01, -7.909972850e-02,
+        5.904868930e-02, -4.573130939e-02, 3.614611590e-02, -2.887891304e-02,
+        2.317684721e-02, -1.860170180e-02, 1.487965499e-02, -1.182892022e-02,
+        9.322027325e-03, -7.264946893e-03, 5.585008010e-03, -4.223679030e-03,
+        3.132165040e-03, -2.268696069e-03, 1.596855513e-03, -1.084556406e-03,
+        7.034199504e-04, -4.283979164e-04, 2.375347425e-04, -1.118003323e-04
+    },
+    {
+        -1.305717911e-04, 2.672086198e-04, -4.724786320e-04, 7.660218400e-04,
+        -1.170446502e-03, 1.711505847e-03, -2.418356052e-03, 3.323970047e-03,
+        -4.465819791e-03, 5.886998658e-03, -7.638051370e-03, 9.779941297e-03,
+        -1.238887281e-02, 1.556422110e-02, -1.944186631e-02, 2.421739064e-02,
+        -3.018838337e-02, 3.783660331e-02, -4.800137696e-02, 6.228867688e-02,
+        -8.419862751e-02, 1.230529401e-01, -2.145668292e-01, 7.383918237e-01,
+        5.246679824e-01, -1.911673855e-01, 1.144706934e-01, -7.969798548e-02,
+        5.947705951e-02, -4.605528831e-02, 3.639881345e-02, -2.907948740e-02,
+        2.333751658e-02, -1.873086159e-02, 1.498342370e-02, -1.191197026e-02,
+        9.388059275e-03, -7.316973340e-03, 5.625530068e-03, -4.254799892e-03,
+        3.155665569e-03, -2.286087086e-03, 1.609415691e-03, -1.093361289e-03,
+        7.093655556e-04, -4.322210794e-04, 2.398315073e-04, -1.130431313e-04
+    },
+    {
+        -1.305641154e-04, 2.675277203e-04, -4.733627673e-04, 7.677919835e-04,
+        -1.173520622e-03, 1.716413762e-03, -2.425754897e-03, 3.334660589e-03,
+        -4.480764099e-03, 5.907340064e-03, -7.665138272e-03, 9.815357202e-03,
+        -1.243447635e-02, 1.562220156e-02, -1.951482299e-02, 2.430844774e-02,
+        -3.030135530e-02, 3.797622093e-02, -4.817353903e-02, 6.250042926e-02,
+        -8.445608142e-02, 1.233447970e-01, -2.146996083e-01, 7.311680753e-01,
+        5.330862178e-01, -1.929318931e-01, 1.153587075e-01, -8.026773939e-02,
+        5.988382552e-02, -4.636240172e-02, 3.663812234e-02, -2.926934059e-02,
+        2.348957369e-02, -1.885310939e-02, 1.508166773e-02, -1.199063447e-02,
+        9.450641718e-03, -7.366318350e-03, 5.663997284e-03, -4.284372805e-03,
+        3.178023622e-03, -2.302655419e-03, 1.621401063e-03, -1.101779491e-03,
+        7.150636110e-04, -4.358963254e-04, 2.420488008e-04, -1.142509045e-04
+    },
+    {
+        -1.305014633e-04, 2.677360149e-04, -4.740527029e-04, 7.692491925e-04,
+        -1.176118797e-03, 1.720628283e-03, -2.432176967e-03, 3.344012048e-03,
+        -4.493913316e-03, 5.925319668e-03, -7.689165965e-03, 9.846861625e-03,
+        -1.247513094e-02, 1.567397072e-02, -1.958002663e-02, 2.438985196e-02,
+        -3.040229625e-02, 3.810075622e-02, -4.832655401e-02, 6.268730634e-02,
+        -8.467986197e-02, 1.235874638e-01, -2.147485138e-01, 7.238769488e-01,
+        5.414806768e-01, -1.946358864e-01, 1.162066160e-01, -8.080865810e-02,
+        6.026875758e-02, -4.665247965e-02, 3.686391168e-02, -2.944836935e-02,
+        2.363293592e-02, -1.896837861e-02, 1.517433326e-02, -1.206486945e-02,
+        9.509739779e-03, -7.412954099e-03, 5.700387673e-03, -4.312380607e-03,
+        3.199226000e-03, -2.318391094e-03, 1.632804255e-03, -1.109805697e-03,
+        7.205104100e-04, -4.394211746e-04, 2.441850541e-04, -1.154227375e-04
+    },
+    {
+        -1.303844065e-04, 2.678342688e-04, -4.745494062e-04, 7.703946304e-04,
+        -1.178242361e-03, 1.724150866e-03, -2.437623764e-03, 3.352025866e-03,
+        -4.505268688e-03, 5.940938347e-03, -7.710134765e-03, 9.874454100e-03,
+        -1.251083511e-02, 1.571952592e-02, -1.963747331e-02, 2.446159823e-02,
+        -3.049120058e-02, 3.821020451e-02, -4.846042199e-02, 6.284932234e-02,
+        -8.487002301e-02, 1.237811196e-01, -2.147142779e-01, 7.165200791e-01,
+        5.498495498e-01, -1.962782604e-01, 1.170138895e-01, -8.132041905e-02,
+        6.063163352e-02, -4.692535815e-02, 3.707605543e-02, -2.961647436e-02,
+        2.376752381e-02, -1.907660522e-02, 1.526136854e-02, -1.213463337e-02,
+        9.565319838e-03, -7.456853736e-03, 5.734679993e-03, -4.338806692e-03,
+        3.219259909e-03, -2.333284426e-03, 1.643618087e-03, -1.117434725e-03,
+        7.257023273e-04, -4.427931932e-04, 2.462387210e-04, -1.165577232e-04
+    },
+    {
+        -1.302135363e-04, 2.678232884e-04, -4.748539179e-04, 7.712295803e-04,
+        -1.179892832e-03, 1.726983236e-03, -2.442097171e-03, 3.358704008e-03,
+        -4.514832161e-03, 5.954197902e-03, -7.728046178e-03, 9.898135685e-03,
+        -1.254158934e-02, 1.575886694e-02, -1.968716212e-02, 2.452368522e-02,
+        -3.056806728e-02, 3.830456695e-02, -4.857515041e-02, 6.298650086e-02,
+        -8.502663073e-02, 1.239259599e-01, -2.145976523e-01, 7.090991140e-01,
+        5.581910288e-01, -1.978579212e-01, 1.177800106e-01, -8.180270939e-02,
+        6.097223883e-02, -4.718087941e-02, 3.727443245e-02, -2.977356022e-02,
+        2.389326110e-02, -1.917772771e-02, 1.534272382e-02, -1.219988606e-02,
+        9.617349544e-03, -7.497991398e-03, 5.766853752e-03, -4.363635015e-03,
+        3.238112965e-03, -2.347326023e-03, 1.653835586e-03, -1.124661524e-03,
+        7.306358208e-04, -4.460099951e-04, 2.482082788e-04, -1.176549633e-04
+    },
+    {
+        -1.299894625e-04, 2.677039199e-04, -4.749673509e-04, 7.717554428e-04,
+        -1.181071907e-03, 1.729127383e-03, -2.445599443e-03, 3.364048953e-03,
+        -4.522606372e-03, 5.965101047e-03, -7.742902899e-03, 9.917908959e-03,
+        -1.256739600e-02, 1.579199597e-02, -1.972909515e-02, 2.457611533e-02,
+        -3.063290002e-02, 3.838385047e-02, -4.867075399e-02, 6.309887486e-02,
+        -8.514976364e-02, 1.240221971e-01, -2.143994072e-01, 7.016157132e-01,
+        5.665033082e-01, -1.993737870e-01, 1.185044746e-01, -8.225522613e-02,
+        6.129036680e-02, -4.741889177e-02, 3.745892658e-02, -2.991953554e-02,
+        2.401007472e-02, -1.927168719e-02, 1.541835145e-02, -1.226058896e-02,
+        9.665797839e-03, -7.536342215e-03, 5.796889221e-03, -4.386850102e-03,
+        3.255773203e-03, -2.360506792e-03, 1.663449980e-03, -1.131481181e-03,
+        7.353074330e-04, -4.490692427e-04, 2.500922290e-04, -1.187135681e-04
+    },
+    {
+        -1.297128137e-04, 2.674770494e-04, -4.748908895e-04, 7.719737357e-04,
+        -1.181781465e-03, 1.730585559e-03, -2.448133211e-03, 3.368063696e-03,
+        -4.528594653e-03, 5.973651408e-03, -7.754708804e-03, 9.933778012e-03,
+        -1.258825941e-02, 1.581891758e-02, -1.976327751e-02, 2.461889470e-02,
+        -3.068570707e-02, 3.844806782e-02, -4.874725476e-02, 6.318648662e-02,
+        -8.523951245e-02, 1.240700600e-01, -2.141203320e-01, 6.940715483e-01,
+        5.747845852e-01, -2.008247881e-01, 1.191867890e-01, -8.267767630e-02,
+        6.158581860e-02, -4.763924988e-02, 3.762942669e-02, -3.005431299e-02,
+        2.411789491e-02, -1.935842738e-02, 1.548820586e-02, -1.231670520e-02,
+        9.710634966e-03, -7.571882333e-03, 5.824767441e-03, -4.408437057e-03,
+        3.272229084e-03, -2.372817942e-03, 1.672454711e-03, -1.137888920e-03,
+        7.397137935e-04, -4.519686486e-04, 2.518890984e-04, -1.197326571e-04
+    },
+    {
+        -1.293842366e-04, 2.671436015e-04, -4.746257882e-04, 7.718860923e-04,
+        -1.182023561e-03, 1.731360280e-03, -2.449701478e-03, 3.370751743e-03,
+        -4.532801020e-03, 5.979853518e-03, -7.763468950e-03, 9.945748445e-03,
+        -1.260418577e-02, 1.583963876e-02, -1.978971729e-02, 2.465203319e-02,
+        -3.072650135e-02, 3.849723747e-02, -4.880468197e-02, 6.324938771e-02,
+        -8.529598003e-02, 1.240697934e-01, -2.137612342e-01, 6.864683022e-01,
+        5.830330601e-01, -2.022098674e-01, 1.198264744e-01, -8.306977712e-02,
+        6.185840338e-02, -4.784181471e-02, 3.778582671e-02, -3.017780931e-02,
+        2.421665516e-02, -1.943789464e-02, 1.555224362e-02, -1.236819957e-02,
+        9.751832490e-03, -7.604588919e-03, 5.850470237e-03, -4.428381573e-03,
+        3.287469497e-03, -2.384250990e-03, 1.680843430e-03, -1.143880107e-03,
+        7.438516205e-04, -4.547059768e-04, 2.535974398e-04, -1.207113600e-04
+    },
+    {
+        -1.290043951e-04, 2.667045394e-04, -4.741733710e-04, 7.714942604e-04,
+        -1.181800429e-03, 1.731454321e-03, -2.450307613e-03, 3.372117108e-03,
+        -4.535230177e-03, 5.983712813e-03, -7.769189561e-03, 9.953827356e-03,
+        -1.261518319e-02, 1.585416887e-02, -1.980842553e-02, 2.467554435e-02,
+        -3.075530035e-02, 3.853138365e-02, -4.884307210e-02, 6.328763888e-02,
+        -8.531928127e-02, 1.240216583e-01, -2.133229394e-01, 6.788076685e-01,
+        5.912469370e-01, -2.035279809e-01, 1.204230646e-01, -8.343125610e-02,
+        6.210793838e-02, -4.802645367e-02, 3.792802574e-02, -3.028994540e-02,
+        2.430629232e-02, -1.951003804e-02, 1.561042341e-02, -1.241503857e-02,
+        9.789363311e-03, -7.634440178e-03, 5.873980225e-03, -4.446669935e-03,
+        3.301483769e-03, -2.394797765e-03, 1.688610008e-03, -1.149450252e-03,
+        7.477177229e-04, -4.572790437e-04, 2.552158327e-04, -1.216488165e-04
+    },
+    {
+        -1.285739705e-04, 2.661608636e-04, -4.735350304e-04, 7.708001005e-04,
+        -1.181114474e-03, 1.730870714e-03, -2.449955353e-03, 3.372164307e-03,
+        -4.535887504e-03, 5.985235627e-03, -7.771878030e-03, 9.958023340e-03,
+        -1.262126168e-02, 1.586251968e-02, -1.981941629e-02, 2.468944542e-02,
+        -3.077212617e-02, 3.855053629e-02, -4.886246883e-02, 6.330131007e-02,
+        -8.530954305e-02, 1.239259316e-01, -2.128062911e-01, 6.710913513e-01,
+        5.994244244e-01, -2.047780977e-01, 1.209761064e-01, -8.376185120e-02,
+        6.233424903e-02, -4.819304063e-02, 3.805592806e-02, -3.039064632e-02,
+        2.438674660e-02, -1.957480932e-02, 1.566270609e-02, -1.245719041e-02,
+        9.823201679e-03, -7.661415361e-03, 5.895280824e-03, -4.463289031e-03,
+        3.314261671e-03, -2.404450416e-03, 1.695748533e-03, -1.154595012e-03,
+        7.513090017e-04, -4.596857198e-04, 2.567428841e-04, -1.225441772e-04
+    },
+    {
+        -1.280936606e-04, 2.655136112e-04, -4.727122263e-04, 7.698055849e-04,
+        -1.179968276e-03, 1.729612746e-03, -2.448648794e-03, 3.370898360e-03,
+        -4.534779057e-03, 5.984429184e-03, -7.771542907e-03, 9.958346475e-03,
+        -1.262243312e-02, 1.586470527e-02, -1.982270654e-02, 2.469375730e-02,
+        -3.077700544e-02, 3.855473102e-02, -4.886292294e-02, 6.329048032e-02,
+        -8.526690411e-02, 1.237829060e-01, -2.122121503e-01, 6.633210644e-01,
+        6.075637351e-01, -2.059592010e-01, 1.214851604e-01, -8.406131099e-02,
+        6.253716903e-02, -4.834145604e-02, 3.816944318e-02, -3.047984137e-02,
+        2.445796160e-02, -1.963216297e-02, 1.570905472e-02, -1.249462504e-02,
+        9.853323207e-03, -7.685494782e-03, 5.914356260e-03, -4.478226359e-03,
+        3.325793420e-03, -2.413201411e-03, 1.702253319e-03, -1.159310193e-03,
+        7.546224523e-04, -4.619239304e-04, 2.581772297e-04, -1.233966042e-04
+    },
+    {
+        -1.275641796e-04, 2.647638557e-04, -4.717064849e-04, 7.685127961e-04,
+        -1.178364587e-03, 1.727683956e-03, -2.446392394e-03, 3.368324781e-03,
+        -4.531911562e-03, 5.981301596e-03, -7.768193897e-03, 9.954808319e-03,
+        -1.261871129e-02, 1.586074213e-02, -1.981831619e-02, 2.468850457e-02,
+        -3.076996934e-02, 3.854400910e-02, -4.884449235e-02, 6.325523774e-02,
+        -8.519151495e-02, 1.235928898e-01, -2.115413948e-01, 6.554985311e-01,
+        6.156630874e-01, -2.070702876e-01, 1.219498009e-01, -8.432939475e-02,
+        6.271654046e-02, -4.847158695e-02, 3.826848593e-02, -3.055746409e-02,
+        2.451988436e-02, -1.968205623e-02, 1.574943454e-02, -1.252731417e-02,
+        9.879704887e-03, -7.706659820e-03, 5.931191583e-03, -4.491470032e-03,
+        3.336069688e-03, -2.421043542e-03, 1.708118904e-03, -1.163591751e-03,
+        7.576551659e-04, -4.639916572e-04, 2.595175343e-04, -1.242052713e-04
+    },
+    {
+        -1.269862572e-04, 2.639127059e-04, -4.705193981e-04, 7.669239251e-04,
+        -1.176306326e-03, 1.725088133e-03, -2.443190968e-03, 3.364449579e-03,
+        -4.527292410e-03, 5.975861853e-03, -7.761841847e-03, 9.947421896e-03,
+        -1.261011179e-02, 1.585064905e-02, -1.980626809e-02, 2.467371542e-02,
+        -3.075105357e-02, 3.851841743e-02, -4.880724202e-02, 6.319567938e-02,
+        -8.508353776e-02, 1.233562064e-01, -2.107949196e-01, 6.476254838e-01,
+        6.237207051e-01, -2.081103690e-01, 1.223696160e-01, -8.456587262e-02,
+        6.287221383e-02, -4.858332711e-02, 3.835297646e-02, -3.062345231e-02,
+        2.457246538e-02, -1.972444913e-02, 1.578381303e-02, -1.255523125e-02,
+        9.902325101e-03, -7.724892940e-03, 5.945772669e-03, -4.503008788e-03,
+        3.345081606e-03, -2.427969936e-03, 1.713340058e-03, -1.167435797e-03,
+        7.604043313e-04, -4.658869395e-04, 2.607624927e-04, -1.249693645e-04
+    },
+    {
+        -1.263606384e-04, 2.629613051e-04, -4.691526218e-04, 7.650412705e-04,
+        -1.173796579e-03, 1.721829315e-03, -2.439049682e-03, 3.359279249e-03,
+        -4.520929652e-03, 5.968119820e-03, -7.752498742e-03, 9.936201690e-03,
+        -1.259665211e-02, 1.583444716e-02, -1.978658798e-02, 2.464942164e-02,
+        -3.072029832e-02, 3.847800849e-02, -4.875124393e-02, 6.311191125e-02,
+        -8.494314628e-02, 1.230731947e-01, -2.099736360e-01, 6.397036632e-01,
+        6.317348182e-01, -2.090784714e-01, 1.227442084e-01, -8.477052572e-02,
+        6.300404820e-02, -4.867657701e-02, 3.842284032e-02, -3.067774821e-02,
+        2.461565864e-02, -1.975930450e-02, 1.581215991e-02, -1.257835155e-02,
+        9.921163635e-03, -7.740177695e-03, 5.958086229e-03, -4.512831993e-03,
+        3.352820771e-03, -2.433974051e-03, 1.717911782e-03, -1.170838598e-03,
+        7.628672364e-04, -4.676078751e-04, 2.619108306e-04, -1.256880828e-04
+    },
+    {
+        -1.256880828e-04, 2.619108306e-04, -4.676078751e-04, 7.628672364e-04,
+        -1.170838598e-03, 1.717911782e-03, -2.433974051e-03, 3.352820771e-03,
+        -4.512831993e-03, 5.958086229e-03, -7.740177695e-03, 9.921163635e-03,
+        -1.257835155e-02, 1.581215991e-02, -1.975930450e-02, 2.461565864e-02,
+        -3.067774821e-02, 3.842284032e-02, -4.867657701e-02, 6.300404820e-02,
+        -8.477052572e-02, 1.227442084e-01, -2.090784714e-01, 6.317348182e-01,
+        6.397036632e-01, -2.099736360e-01, 1.230731947e-01, -8.494314628e-02,
+        6.311191125e-02, -4.875124393e-02, 3.847800849e-02, -3.072029832e-02,
+        2.464942164e-02, -1.978658798e-02, 1.583444716e-02, -1.259665211e-02,
+        9.936201690e-03, -7.752498742e-03, 5.968119820e-03, -4.520929652e-03,
+        3.359279249e-03, -2.439049682e-03, 1.721829315e-03, -1.173796579e-03,
+        7.650412705e-04, -4.691526218e-04, 2.629613051e-04, -1.263606384e-04
+    },
+    {
+        -1.249693645e-04, 2.607624927e-04, -4.658869395e-04, 7.604043313e-04,
+        -1.167435797e-03, 1.713340058e-03, -2.427969936e-03, 3.345081606e-03,
+        -4.503008788e-03, 5.945772669e-03, -7.724892940e-03, 9.902325101e-03,
+        -1.255523125e-02, 1.578381303e-02, -1.972444913e-02, 2.457246538e-02,
+        -3.062345231e-02, 3.835297646e-02, -4.858332711e-02, 6.287221383e-02,
+        -8.456587262e-02, 1.223696160e-01, -2.081103690e-01, 6.237207051e-01,
+        6.476254838e-01, -2.107949196e-01, 1.233562064e-01, -8.508353776e-02,
+        6.319567938e-02, -4.880724202e-02, 3.851841743e-02, -3.075105357e-02,
+        2.467371542e-02, -1.980626809e-02, 1.585064905e-02, -1.261011179e-02,
+        9.947421896e-03, -7.761841847e-03, 5.975861853e-03, -4.527292410e-03,
+        3.364449579e-03, -2.443190968e-03, 1.725088133e-03, -1.176306326e-03,
+        7.669239251e-04, -4.705193981e-04, 2.639127059e-04, -1.269862572e-04
+    },
+    {
+        -1.242052713e-04, 2.595175343e-04, -4.639916572e-04, 7.576551659e-04,
+        -1.163591751e-03, 1.708118904e-03, -2.421043542e-03, 3.336069688e-03,
+        -4.491470032e-03, 5.931191583e-03, -7.706659820e-03, 9.879704887e-03,
+        -1.252731417e-02, 1.574943454e-02, -1.968205623e-02, 2.451988436e-02,
+        -3.055746409e-02, 3.826848593e-02, -4.847158695e-02, 6.271654046e-02,
+        -8.432939475e-02, 1.219498009e-01, -2.070702876e-01, 6.156630874e-01,
+        6.554985311e-01, -2.115413948e-01, 1.235928898e-01, -8.519151495e-02,
+        6.325523774e-02, -4.884449235e-02, 3.854400910e-02, -3.076996934e-02,
+        2.468850457e-02, -1.981831619e-02, 1.586074213e-02, -1.261871129e-02,
+        9.954808319e-03, -7.768193897e-03, 5.981301596e-03, -4.531911562e-03,
+        3.368324781e-03, -2.446392394e-03, 1.727683956e-03, -1.178364587e-03,
+        7.685127961e-04, -4.717064849e-04, 2.647638557e-04, -1.275641796e-04
+    },
+    {
+        -1.233966042e-04, 2.581772297e-04, -4.619239304e-04, 7.546224523e-04,
+        -1.159310193e-03, 1.702253319e-03, -2.413201411e-03, 3.325793420e-03,
+        -4.478226359e-03, 5.914356260e-03, -7.685494782e-03, 9.853323207e-03,
+        -1.249462504e-02, 1.570905472e-02, -1.963216297e-02, 2.445796160e-02,
+        -3.047984137e-02, 3.816944318e-02, -4.834145604e-02, 6.253716903e-02,
+        -8.406131099e-02, 1.214851604e-01, -2.059592010e-01, 6.075637351e-01,
+        6.633210644e-01, -2.122121503e-01, 1.237829060e-01, -8.526690411e-02,
+        6.329048032e-02, -4.886292294e-02, 3.855473102e-02, -3.077700544e-02,
+        2.469375730e-02, -1.982270654e-02, 1.586470527e-02, -1.262243312e-02,
+        9.958346475e-03, -7.771542907e-03, 5.984429184e-03, -4.534779057e-03,
+        3.370898360e-03, -2.448648794e-03, 1.729612746e-03, -1.179968276e-03,
+        7.698055849e-04, -4.727122263e-04, 2.655136112e-04, -1.280936606e-04
+    },
+    {
+        -1.225441772e-04, 2.567428841e-04, -4.596857198e-04, 7.513090017e-04,
+        -1.154595012e-03, 1.695748533e-03, -2.404450416e-03, 3.314261671e-03,
+        -4.463289031e-03, 5.895280824e-03, -7.661415361e-03, 9.823201679e-03,
+        -1.245719041e-02, 1.566270609e-02, -1.957480932e-02, 2.438674660e-02,
+        -3.039064632e-02, 3.805592806e-02, -4.819304063e-02, 6.233424903e-02,
+        -8.376185120e-02, 1.209761064e-01, -2.047780977e-01, 5.994244244e-01,
+        6.710913513e-01, -2.128062911e-01, 1.239259316e-01, -8.530954305e-02,
+        6.330131007e-02, -4.886246883e-02, 3.855053629e-02, -3.077212617e-02,
+        2.468944542e-02, -1.981941629e-02, 1.586251968e-02, -1.262126168e-02,
+        9.958023340e-03, -7.771878030e-03, 5.985235627e-03, -4.535887504e-03,
+        3.372164307e-03, -2.449955353e-03, 1.730870714e-03, -1.181114474e-03,
+        7.708001005e-04, -4.735350304e-04, 2.661608636e-04, -1.285739705e-04
+    },
+    {
+        -1.216488165e-04, 2.552158327e-04, -4.572790437e-04, 7.477177229e-04,
+        -1.149450252e-03, 1.688610008e-03, -2.394797765e-03, 3.301483769e-03,
+        -4.446669935e-03, 5.873980225e-03, -7.634440178e-03, 9.789363311e-03,
+        -1.241503857e-02, 1.561042341e-02, -1.951003804e-02, 2.430629232e-02,
+        -3.028994540e-02, 3.792802574e-02, -4.802645367e-02, 6.210793838e-02,
+        -8.343125610e-02, 1.204230646e-01, -2.035279809e-01, 5.912469370e-01,
+        6.788076685e-01, -2.133229394e-01, 1.240216583e-01, -8.531928127e-02,
+        6.328763888e-02, -4.884307210e-02, 3.853138365e-02, -3.075530035e-02,
+        2.467554435e-02, -1.980842553e-02, 1.585416887e-02, -1.261518319e-02,
+        9.953827356e-03, -7.769189561e-03, 5.983712813e-03, -4.535230177e-03,
+        3.372117108e-03, -2.450307613e-03, 1.731454321e-03, -1.181800429e-03,
+        7.714942604e-04, -4.741733710e-04, 2.667045394e-04, -1.290043951e-04
+    },
+    {
+        -1.207113600e-04, 2.535974398e-04, -4.547059768e-04, 7.438516205e-04,
+        -1.143880107e-03, 1.680843430e-03, -2.384250990e-03, 3.287469497e-03,
+        -4.428381573e-03, 5.850470237e-03, -7.604588919e-03, 9.751832490e-03,
+        -1.236819957e-02, 1.555224362e-02, -1.943789464e-02, 2.421665516e-02,
+        -3.017780931e-02, 3.778582671e-02, -4.784181471e-02, 6.185840338e-02,
+        -8.306977712e-02, 1.198264744e-01, -2.022098674e-01, 5.830330601e-01,
+        6.864683022e-01, -2.137612342e-01, 1.240697934e-01, -8.529598003e-02,
+        6.324938771e-02, -4.880468197e-02, 3.849723747e-02, -3.072650135e-02,
+        2.465203319e-02, -1.978971729e-02, 1.583963876e-02, -1.260418577e-02,
+        9.945748445e-03, -7.763468950e-03, 5.979853518e-03, -4.532801020e-03,
+        3.370751743e-03, -2.449701478e-03, 1.731360280e-03, -1.182023561e-03,
+        7.718860923e-04, -4.746257882e-04, 2.671436015e-04, -1.293842366e-04
+    },
+    {
+        -1.197326571e-04, 2.518890984e-04, -4.519686486e-04, 7.397137935e-04,
+        -1.137888920e-03, 1.672454711e-03, -2.372817942e-03, 3.272229084e-03,
+        -4.408437057e-03, 5.824767441e-03, -7.571882333e-03, 9.710634966e-03,
+        -1.231670520e-02, 1.548820586e-02, -1.935842738e-02, 2.411789491e-02,
+        -3.005431299e-02, 3.762942669e-02, -4.763924988e-02, 6.158581860e-02,
+        -8.267767630e-02, 1.191867890e-01, -2.008247881e-01, 5.747845852e-01,
+        6.940715483e-01, -2.141203320e-01, 1.240700600e-01, -8.523951245e-02,
+        6.318648662e-02, -4.874725476e-02, 3.844806782e-02, -3.068570707e-02,
+        2.461889470e-02, -1.976327751e-02, 1.581891758e-02, -1.258825941e-02,
+        9.933778012e-03, -7.754708804e-03, 5.973651408e-03, -4.528594653e-03,
+        3.368063696e-03, -2.448133211e-03, 1.730585559e-03, -1.181781465e-03,
+        7.719737357e-04, -4.748908895e-04, 2.674770494e-04, -1.297128137e-04
+    },
+    {
+        -1.187135681e-04, 2.500922290e-04, -4.490692427e-04, 7.353074330e-04,
+        -1.131481181e-03, 1.663449980e-03, -2.360506792e-03, 3.255773203e-03,
+        -4.386850102e-03, 5.796889221e-03, -7.536342215e-03, 9.665797839e-03,
+        -1.226058896e-02, 1.541835145e-02, -1.927168719e-02, 2.401007472e-02,
+        -2.991953554e-02, 3.745892658e-02, -4.741889177e-02, 6.129036680e-02,
+        -8.225522613e-02, 1.185044746e-01, -1.993737870e-01, 5.665033082e-01,
+        7.016157132e-01, -2.143994072e-01, 1.240221971e-01, -8.514976364e-02,
+        6.309887486e-02, -4.867075399e-02, 3.838385047e-02, -3.063290002e-02,
+        2.457611533e-02, -1.972909515e-02, 1.579199597e-02, -1.256739600e-02,
+        9.917908959e-03, -7.742902899e-03, 5.965101047e-03, -4.522606372e-03,
+        3.364048953e-03, -2.445599443e-03, 1.729127383e-03, -1.181071907e-03,
+        7.717554428e-04, -4.749673509e-04, 2.677039199e-04, -1.299894625e-04
+    },
+    {
+        -1.176549633e-04, 2.482082788e-04, -4.460099951e-04, 7.306358208e-04,
+        -1.124661524e-03, 1.653835586e-03, -2.347326023e-03, 3.238112965e-03,
+        -4.363635015e-03, 5.766853752e-03, -7.497991398e-03, 9.617349544e-03,
+        -1.219988606e-02, 1.534272382e-02, -1.917772771e-02, 2.389326110e-02,
+        -2.977356022e-02, 3.727443245e-02, -4.718087941e-02, 6.097223883e-02,
+        -8.180270939e-02, 1.177800106e-01, -1.978579212e-01, 5.581910288e-01,
+        7.090991140e-01, -2.145976523e-01, 1.239259599e-01, -8.502663073e-02,
+        6.298650086e-02, -4.857515041e-02, 3.830456695e-02, -3.056806728e-02,
+        2.452368522e-02, -1.968716212e-02, 1.575886694e-02, -1.254158934e-02,
+        9.898135685e-03, -7.728046178e-03, 5.954197902e-03, -4.514832161e-03,
+        3.358704008e-03, -2.442097171e-03, 1.726983236e-03, -1.179892832e-03,
+        7.712295803e-04, -4.748539179e-04, 2.678232884e-04, -1.302135363e-04
+    },
+    {
+        -1.165577232e-04, 2.462387210e-04, -4.427931932e-04, 7.257023273e-04,
+        -1.117434725e-03, 1.643618087e-03, -2.333284426e-03, 3.219259909e-03,
+        -4.338806692e-03, 5.734679993e-03, -7.456853736e-03, 9.565319838e-03,
+        -1.213463337e-02, 1.526136854e-02, -1.907660522e-02, 2.376752381e-02,
+        -2.961647436e-02, 3.707605543e-02, -4.692535815e-02, 6.063163352e-02,
+        -8.132041905e-02, 1.170138895e-01, -1.962782604e-01, 5.498495498e-01,
+        7.165200791e-01, -2.147142779e-01, 1.237811196e-01, -8.487002301e-02,
+        6.284932234e-02, -4.846042199e-02, 3.821020451e-02, -3.049120058e-02,
+        2.446159823e-02, -1.963747331e-02, 1.571952592e-02, -1.251083511e-02,
+        9.874454100e-03, -7.710134765e-03, 5.940938347e-03, -4.505268688e-03,
+        3.352025866e-03, -2.437623764e-03, 1.724150866e-03, -1.178242361e-03,
+        7.703946304e-04, -4.745494062e-04, 2.678342688e-04, -1.303844065e-04
+    },
+    {
+        -1.154227375e-04, 2.441850541e-04, -4.394211746e-04, 7.205104100e-04,
+        -1.109805697e-03, 1.632804255e-03, -2.318391094e-03, 3.199226000e-03,
+        -4.312380607e-03, 5.700387673e-03, -7.412954099e-03, 9.509739779e-03,
+        -1.206486945e-02, 1.517433326e-02, -1.896837861e-02, 2.363293592e-02,
+        -2.944836935e-02, 3.686391168e-02, -4.665247965e-02, 6.026875758e-02,
+        -8.080865810e-02, 1.162066160e-01, -1.946358864e-01, 5.414806768e-01,
+        7.238769488e-01, -2.147485138e-01, 1.235874638e-01, -8.467986197e-02,
+        6.268730634e-02, -4.832655401e-02, 3.810075622e-02, -3.040229625e-02,
+        2.438985196e-02, -1.958002663e-02, 1.567397072e-02, -1.247513094e-02,
+        9.846861625e-03, -7.689165965e-03, 5.925319668e-03, -4.493913316e-03,
+        3.344012048e-03, -2.432176967e-03, 1.720628283e-03, -1.176118797e-03,
+        7.692491925e-04, -4.740527029e-04, 2.677360149e-04, -1.305014633e-04
+    },
+    {
+        -1.142509045e-04, 2.420488008e-04, -4.358963254e-04, 7.150636110e-04,
+        -1.101779491e-03, 1.621401063e-03, -2.302655419e-03, 3.178023622e-03,
+        -4.284372805e-03, 5.663997284e-03, -7.366318350e-03, 9.450641718e-03,
+        -1.199063447e-02, 1.508166773e-02, -1.885310939e-02, 2.348957369e-02,
+        -2.926934059e-02, 3.663812234e-02, -4.636240172e-02, 5.988382552e-02,
+        -8.026773939e-02, 1.153587075e-01, -1.929318931e-01, 5.330862178e-01,
+        7.311680753e-01, -2.146996083e-01, 1.233447970e-01, -8.445608142e-02,
+        6.250042926e-02, -4.817353903e-02, 3.797622093e-02, -3.030135530e-02,
+        2.430844774e-02, -1.951482299e-02, 1.562220156e-02, -1.243447635e-02,
+        9.815357202e-03, -7.665138272e-03, 5.907340064e-03, -4.480764099e-03,
+        3.334660589e-03, -2.425754897e-03, 1.716413762e-03, -1.173520622e-03,
+        7.677919835e-04, -4.733627673e-04, 2.675277203e-04, -1.305641154e-04
+    },
+    {
+        -1.130431313e-04, 2.398315073e-04, -4.322210794e-04, 7.093655556e-04,
+        -1.093361289e-03, 1.609415691e-03, -2.286087086e-03, 3.155665569e-03,
+        -4.254799892e-03, 5.625530068e-03, -7.316973340e-03, 9.388059275e-03,
+        -1.191197026e-02, 1.498342370e-02, -1.873086159e-02, 2.333751658e-02,
+        -2.907948740e-02, 3.639881345e-02, -4.605528831e-02, 5.947705951e-02,
+        -7.969798548e-02, 1.144706934e-01, -1.911673855e-01, 5.246679824e-01,
+        7.383918237e-01, -2.145668292e-01, 1.230529401e-01, -8.419862751e-02,
+        6.228867688e-02, -4.800137696e-02, 3.783660331e-02, -3.018838337e-02,
+        2.421739064e-02, -1.944186631e-02, 1.556422110e-02, -1.238887281e-02,
+        9.779941297e-03, -7.638051370e-03, 5.886998658e-03, -4.465819791e-03,
+        3.323970047e-03, -2.418356052e-03, 1.711505847e-03, -1.170446502e-03,
+        7.660218400e-04, -4.724786320e-04, 2.672086198e-04, -1.305717911e-04
+    },
+    {
+        -1.118003323e-04, 2.375347425e-04, -4.283979164e-04, 7.034199504e-04,
+        -1.084556406e-03, 1.596855513e-03, -2.268696069e-03, 3.132165040e-03,
+        -4.223679030e-03, 5.585008010e-03, -7.264946893e-03, 9.322027325e-03,
+        -1.182892022e-02, 1.487965499e-02, -1.860170180e-02, 2.317684721e-02,
+        -2.887891304e-02, 3.614611590e-02, -4.573130939e-02, 5.904868930e-02,
+        -7.909972850e-02, 1.135431152e-01, -1.893434802e-01, 5.162277817e-01,
+        7.455465719e-01, -2.143494641e-01, 1.227117309e-01, -8.390745886e-02,
+        6.205204445e-02, -4.781007507e-02, 3.768191387e-02, -3.006339080e-02,
+        2.411668950e-02, -1.936116353e-02, 1.550003441e-02, -1.233832372e-02,
+        9.740615903e-03, -7.607906141e-03, 5.864295492e-03, -4.449079848e-03,
+        3.311939500e-03, -2.409979309e-03, 1.705903352e-03, -1.166895287e-03,
+        7.639377188e-04, -4.713994033e-04, 2.667779894e-04, -1.305239384e-04
+    },
+    {
+        -1.105234297e-04, 2.351600969e-04, -4.244293612e-04, 6.972305808e-04,
+        -1.075370284e-03, 1.583728100e-03, -2.250492626e-03, 3.107535634e-03,
+        -4.191027924e-03, 5.542453821e-03, -7.210267786e-03, 9.252581982e-03,
+        -1.174152933e-02, 1.477041737e-02, -1.846569910e-02, 2.300765127e-02,
+        -2.866772461e-02, 3.588016535e-02, -4.539064090e-02, 5.859895208e-02,
+        -7.847330999e-02, 1.125765258e-01, -1.874613040e-01, 5.077674275e-01,
+        7.526307116e-01, -2.140468201e-01, 1.223210242e-01, -8.358254655e-02,
+        6.179053667e-02, -4.759964798e-02, 3.751216895e-02, -2.992639259e-02,
+        2.400635692e-02, -1.927272464e-02, 1.542964899e-02, -1.228283442e-02,
+        9.697384548e-03, -7.574704663e-03, 5.839231537e-03, -4.430544429e-03,
+        3.298568553e-03, -2.400623928e-03, 1.699605360e-03, -1.162866012e-03,
+        7.615386982e-04, -4.701242623e-04, 2.662351472e-04, -1.304200256e-04
+    },
+    {
+        -1.092133523e-04, 2.327091822e-04, -4.203179820e-04, 6.908013096e-04,
+        -1.065808489e-03, 1.570041212e-03, -2.231487289e-03, 3.081791340e-03,
+        -4.156864816e-03, 5.497890932e-03, -7.152965744e-03, 9.179760579e-03,
+        -1.164984415e-02, 1.465576860e-02, -1.832292501e-02, 2.283001754e-02,
+        -2.844603302e-02, 3.560110219e-02, -4.503346463e-02, 5.812809239e-02,
+        -7.781908071e-02, 1.115714896e-01, -1.855219945e-01, 4.992887321e-01,
+        7.596426482e-01, -2.136582246e-01, 1.218806920e-01, -8.322387426e-02,
+        6.150416774e-02, -4.737011773e-02, 3.732739075e-02, -2.977740842e-02,
+        2.388640927e-02, -1.917656265e-02, 1.535307477e-02, -1.222241217e-02,
+        9.650252292e-03, -7.538450218e-03, 5.811808690e-03, -4.410214398e-03,
+        3.283857336e-03, -2.390289555e-03, 1.692611228e-03, -1.158357900e-03,
+        7.588239790e-04, -4.686524660e-04, 2.655794541e-04, -1.302595417e-04
+    },
+    {
+        -1.078710353e-04, 2.301836300e-04, -4.160663890e-04, 6.841360748e-04,
+        -1.055876711e-03, 1.555802799e-03, -2.211690867e-03, 3.054946532e-03,
+        -4.121208476e-03, 5.451343480e-03, -7.093071418e-03, 9.103601651e-03,
+        -1.155391275e-02, 1.453576838e-02, -1.817345351e-02, 2.264403784e-02,
+        -2.821395292e-02, 3.530907144e-02, -4.465996815e-02, 5.763636199e-02,
+        -7.713740050e-02, 1.105285822e-01, -1.835266990e-01, 4.907935075e-01,
+        7.665808017e-01, -2.131830256e-01, 1.213906235e-01, -8.283143828e-02,
+        6.119296141e-02, -4.712151374e-02, 3.712760736e-02, -2.961646270e-02,
+        2.375686670e-02, -1.907269359e-02, 1.527032414e-02, -1.215706621e-02,
+        9.599225738e-03, -7.499147293e-03, 5.782029781e-03, -4.388091329e-03,
+        3.267806509e-03, -2.378976219e-03, 1.684920586e-03, -1.153370362e-03,
+        7.557928853e-04, -4.669833474e-04, 2.648103141e-04, -1.300419964e-04
+    },
+    {
+        -1.064974196e-04, 2.275850911e-04, -4.116772335e-04, 6.772388873e-04,
+        -1.045580759e-03, 1.541020989e-03, -2.191114434e-03, 3.027015961e-03,
+        -4.084078191e-03, 5.402836297e-03, -7.030616374e-03, 9.024144917e-03,
+        -1.145378472e-02, 1.441047830e-02, -1.801736095e-02, 2.244980692e-02,
+        -2.797160265e-02, 3.500422274e-02, -4.427034473e-02, 5.712401975e-02,
+        -7.642863810e-02, 1.094483900e-01, -1.814765745e-01, 4.822835653e-01,
+        7.734436068e-01, -2.126205916e-01, 1.208507252e-01, -8.240524754e-02,
+        6.085695096e-02, -4.685387287e-02, 3.691285270e-02, -2.944358448e-02,
+        2.361775311e-02, -1.896113655e-02, 1.518141189e-02, -1.208680768e-02,
+        9.544313025e-03, -7.456801580e-03, 5.749898572e-03, -4.364177505e-03,
+        3.250417261e-03, -2.366684337e-03, 1.676533342e-03, -1.147902996e-03,
+        7.524448660e-04, -4.651163170e-04, 2.639271751e-04, -1.297669214e-04
+    },
+    {
+        -1.050934518e-04, 2.249152349e-04, -4.071532059e-04, 6.701138293e-04,
+        -1.034926556e-03, 1.525704092e-03, -2.169769326e-03, 2.998014747e-03,
+        -4.045493755e-03, 5.352394895e-03, -6.965633075e-03, 8.941431258e-03,
+        -1.134951115e-02, 1.427996185e-02, -1.785472604e-02, 2.224742250e-02,
+        -2.771910421e-02, 3.468671019e-02, -4.386479324e-02, 5.659133152e-02,
+        -7.569317100e-02, 1.083315103e-01, -1.793727870e-01, 4.737607158e-01,
+        7.802295134e-01, -2.119703120e-01, 1.202609213e-01, -8.194532373e-02,
+        6.049617924e-02, -4.656723940e-02, 3.668316658e-02, -2.925880756e-02,
+        2.346909621e-02, -1.884191366e-02, 1.508635528e-02, -1.201164971e-02,
+        9.485523835e-03, -7.411419981e-03, 5.715419760e-03, -4.338475921e-03,
+        3.231691316e-03, -2.353414718e-03, 1.667449677e-03, -1.141955593e-03,
+        7.487794951e-04, -4.630508627e-04, 2.629295295e-04, -1.294338700e-04
+    },
+    {
+        -1.036600828e-04, 2.221757481e-04, -4.024970351e-04, 6.627650520e-04,
+        -1.023920142e-03, 1.509860591e-03, -2.147667135e-03, 2.967958375e-03,
+        -4.005475464e-03, 5.300045461e-03, -6.898154868e-03, 8.855502701e-03,
+        -1.124114457e-02, 1.414428435e-02, -1.768562982e-02, 2.203698518e-02,
+        -2.745658316e-02, 3.435669235e-02, -4.344351804e-02, 5.603857001e-02,
+        -7.493138523e-02, 1.071785505e-01, -1.772165116e-01, 4.652267680e-01,
+        7.869369873e-01, -2.112315976e-01, 1.196211533e-01, -8.145170126e-02,
+        6.011069871e-02, -4.626166501e-02, 3.643859469e-02, -2.906217040e-02,
+        2.331092747e-02, -1.871505007e-02, 1.498517400e-02, -1.193160736e-02,
+        9.422869394e-03, -7.363010605e-03, 5.678598978e-03, -4.310990286e-03,
+        3.211630930e-03, -2.339168558e-03, 1.657670053e-03, -1.135528134e-03,
+        7.447964728e-04, -4.607865514e-04, 2.618169144e-04, -1.290424177e-04
+    },
+    {
+        -1.021982685e-04, 2.193683341e-04, -3.977114863e-04, 6.551967736e-04,
+        -1.012567664e-03, 1.493499140e-03, -2.124819704e-03, 2.936862684e-03,
+        -3.964044100e-03, 5.245814834e-03, -6.828215968e-03, 8.766402395e-03,
+        -1.112873897e-02, 1.400351297e-02, -1.751015559e-02, 2.181859841e-02,
+        -2.718416860e-02, 3.401433216e-02, -4.300672891e-02, 5.546601467e-02,
+        -7.414367522e-02, 1.059901282e-01, -1.750089316e-01, 4.566835286e-01,
+        7.935645102e-01, -2.104038806e-01, 1.189313808e-01, -8.092442735e-02,
+        5.970057141e-02, -4.593720886e-02, 3.617918859e-02, -2.885371617e-02,
+        2.314328212e-02, -1.858057398e-02, 1.487789016e-02, -1.184669763e-02,
+        9.356362470e-03, -7.311582772e-03, 5.639442794e-03, -4.281725023e-03,
+        3.190238891e-03, -2.323947446e-03, 1.647195210e-03, -1.128620793e-03,
+        7.404956263e-04, -4.583230290e-04, 2.605889124e-04, -1.285921627e-04
+    },
+    {
+        -1.007089681e-04, 2.164947121e-04, -3.927993600e-04, 6.474132769e-04,
+        -1.000875378e-03, 1.476628558e-03, -2.101239120e-03, 2.904743859e-03,
+        -3.921220926e-03, 5.189730502e-03, -6.755851439e-03, 8.674174598e-03,
+        -1.101234973e-02, 1.385771664e-02, -1.732838892e-02, 2.159236840e-02,
+        -2.690199309e-02, 3.365979682e-02, -4.255464096e-02, 5.487395155e-02,
+        -7.333044360e-02, 1.047668709e-01, -1.727512384e-01, 4.481328019e-01,
+        8.001105803e-01, -2.094866149e-01, 1.181915809e-01, -8.036356206e-02,
+        5.926586899e-02, -4.559393752e-02, 3.590500569e-02, -2.863349274e-02,
+        2.296619919e-02, -1.843851662e-02, 1.476452834e-02, -1.175693947e-02,
+        9.286017371e-03, -7.257147012e-03, 5.597958715e-03, -4.250685269e-03,
+        3.167518527e-03, -2.307753362e-03, 1.636026166e-03, -1.121233935e-03,
+        7.358769106e-04, -4.556600211e-04, 2.592451521e-04, -1.280827265e-04
+    },
+    {
+        -9.919314450e-05, 2.135566163e-04, -3.877634909e-04, 6.394189079e-04,
+        -9.888496450e-04, 1.459257827e-03, -2.076937709e-03, 2.871618426e-03,
+        -3.877027673e-03, 5.131820584e-03, -6.681097181e-03, 8.578864646e-03,
+        -1.089203365e-02, 1.370696606e-02, -1.714041755e-02, 2.135840413e-02,
+        -2.661019257e-02, 3.329325776e-02, -4.208747451e-02, 5.426267318e-02,
+        -7.249210104e-02, 1.035094156e-01, -1.704446309e-01, 4.395763892e-01,
+        8.065737128e-01, -2.084792765e-01, 1.174017487e-01, -7.976917829e-02,
+        5.880667273e-02, -4.523192499e-02, 3.561610931e-02, -2.840155265e-02,
+        2.277972146e-02, -1.828891226e-02, 1.464511553e-02, -1.166235378e-02,
+        9.211849950e-03, -7.199715066e-03, 5.554155187e-03, -4.217876877e-03,
+        3.143473699e-03, -2.290588681e-03, 1.624164223e-03, -1.113368123e-03,
+        7.309404092e-04, -4.527973341e-04, 2.577853084e-04, -1.275137536e-04
+    },
+    {
+        -9.765176345e-05, 2.105557948e-04, -3.826067460e-04, 6.312180729e-04,
+        -9.764969260e-04, 1.441396086e-03, -2.051928031e-03, 2.837503243e-03,
+        -3.831486532e-03, 5.072113816e-03, -6.603989912e-03, 8.480518943e-03,
+        -1.076784885e-02, 1.355133365e-02, -1.694633141e-02, 2.111681729e-02,
+        -2.630890637e-02, 3.291489055e-02, -4.160545499e-02, 5.363247845e-02,
+        -7.162906605e-02, 1.022184088e-01, -1.680903154e-01, 4.310160884e-01,
+        8.129524403e-01, -2.073813632e-01, 1.165618974e-01, -7.914136185e-02,
+        5.832307351e-02, -4.485125270e-02, 3.531256858e-02, -2.815795313e-02,
+        2.258389546e-02, -1.813179819e-02, 1.451968116e-02, -1.156296340e-02,
+        9.133877598e-03, -7.139299881e-03, 5.508041589e-03, -4.183306417e-03,
+        3.118108806e-03, -2.272456170e-03, 1.611610961e-03, -1.105024111e-03,
+        7.256863347e-04, -4.497348552e-04, 2.562091034e-04, -1.268849126e-04
+    },
+    {
+        -9.608579306e-05, 2.074940090e-04, -3.773320234e-04, 6.228152367e-04,
+        -9.638237804e-04, 1.423052626e-03, -2.026222872e-03, 2.802415493e-03,
+        -3.784620142e-03, 5.010639542e-03, -6.524567150e-03, 8.379184931e-03,
+        -1.063985483e-02, 1.339089351e-02, -1.674622254e-02, 2.086772218e-02,
+        -2.599827705e-02, 3.252487480e-02, -4.110881285e-02, 5.298367244e-02,
+        -7.074176478e-02, 1.008945057e-01, -1.656895049e-01, 4.224536935e-01,
+        8.192453130e-01, -2.061923958e-01, 1.156720582e-01, -7.848021142e-02,
+        5.781517183e-02, -4.445200950e-02, 3.499445851e-02, -2.790275606e-02,
+        2.237877150e-02, -1.796721471e-02, 1.438825707e-02, -1.145879311e-02,
+        9.052119243e-03, -7.075915613e-03, 5.459628240e-03, -4.146981171e-03,
+        3.091428783e-03, -2.253358992e-03, 1.598368245e-03, -1.096202849e-03,
+        7.201150295e-04, -4.464725531e-04, 2.545163062e-04, -1.261958961e-04
+    },
+    {
+        -9.449620337e-05, 2.043730326e-04, -3.719422510e-04, 6.142149206e-04,
+        -9.508368629e-04, 1.404236890e-03, -1.999835238e-03, 2.766372674e-03,
+        -3.736451578e-03, 4.947427698e-03, -6.442867197e-03, 8.274911073e-03,
+        -1.050811236e-02, 1.322572143e-02, -1.654018507e-02, 2.061123571e-02,
+        -2.567845043e-02, 3.212339411e-02, -4.059778346e-02, 5.231656631e-02,
+        -6.983063088e-02, 9.953837060e-02, -1.632434190e-01, 4.138909939e-01,
+        8.254508993e-01, -2.049119173e-01, 1.147322806e-01, -7.778583862e-02,
+        5.728307781e-02, -4.403429164e-02, 3.466185993e-02, -2.763602801e-02,
+        2.216440361e-02, -1.779520514e-02, 1.425087754e-02, -1.134986962e-02,
+        8.966595350e-03, -7.009577624e-03, 5.408926392e-03, -4.108909140e-03,
+        3.063439104e-03, -2.233300703e-03, 1.584438221e-03, -1.086905485e-03,
+        7.142269662e-04, -4.430104788e-04, 2.527067339e-04, -1.254464212e-04
+    },
+    {
+        -9.288396590e-05, 2.011946507e-04, -3.664403847e-04, 6.054217001e-04,
+        -9.375429196e-04, 1.384958461e-03, -1.972778354e-03, 2.729392590e-03,
+        -3.687004345e-03, 4.882508795e-03, -6.358929121e-03, 8.167746831e-03,
+        -1.037268352e-02, 1.305589480e-02, -1.632831516e-02, 2.034747734e-02,
+        -2.534957543e-02, 3.171063597e-02, -4.007260701e-02, 5.163147718e-02,
+        -6.889610528e-02, 9.815067617e-02, -1.607532833e-01, 4.053297743e-01,
+        8.315677861e-01, -2.035394938e-01, 1.137426321e-01, -7.705836799e-02,
+        5.672691116e-02, -4.359820276e-02, 3.431485950e-02, -2.735784018e-02,
+        2.194084955e-02, -1.761581581e-02, 1.410757926e-02, -1.123622157e-02,
+        8.877327912e-03, -6.940302479e-03, 5.355948235e-03, -4.069099039e-03,
+        3.034145778e-03, -2.212285254e-03, 1.569823317e-03, -1.077133359e-03,
+        7.080227483e-04, -4.393487657e-04, 2.507802519e-04, -1.246362299e-04
+    },
+    {
+        -9.125005313e-05, 1.979606591e-04, -3.608294078e-04, 5.964402026e-04,
+        -9.239487857e-04, 1.365227065e-03, -1.945065650e-03, 2.691493348e-03,
+        -3.636302364e-03, 4.815913912e-03, -6.272792741e-03, 8.057742640e-03,
+        -1.023363161e-02, 1.288149259e-02, -1.611071096e-02, 2.007656900e-02,
+        -2.501180411e-02, 3.128679168e-02, -3.953352836e-02, 5.092872793e-02,
+        -6.793863598e-02, 9.673210328e-02, -1.582203290e-01, 3.967718140e-01,
+        8.375945793e-01, -2.020747143e-01, 1.127031987e-01, -7.629793701e-02,
+        5.614680118e-02, -4.314385389e-02, 3.395354968e-02, -2.706826838e-02,
+        2.170817081e-02, -1.742909604e-02, 1.395840131e-02, -1.111787952e-02,
+        8.784340453e-03, -6.868107944e-03, 5.300706889e-03, -4.027560294e-03,
+        3.003555350e-03, -2.190316992e-03, 1.554526247e-03, -1.066888013e-03,
+        7.015031106e-04, -4.354876303e-04, 2.487367739e-04, -1.237650893e-04
+    },
+    {
+        -8.959543805e-05, 1.946728633e-04, -3.551123284e-04, 5.872751053e-04,
+        -9.100613815e-04, 1.345052562e-03, -1.916710759e-03, 2.652693345e-03,
+        -3.584369961e-03, 4.747674677e-03, -6.184498602e-03, 7.944949890e-03,
+        -1.009102119e-02, 1.270259535e-02, -1.588747260e-02, 1.979863506e-02,
+        -2.466529149e-02, 3.085205626e-02, -3.898079701e-02, 5.020864715e-02,
+        -6.695867792e-02, 9.528334076e-02, -1.556457924e-01, 3.882188865e-01,
+        8.435299038e-01, -2.005171912e-01, 1.116140849e-01, -7.550469609e-02,
+        5.554288674e-02, -4.267136339e-02, 3.357802871e-02, -2.676739306e-02,
+        2.146643260e-02, -1.723509813e-02, 1.380338518e-02, -1.099487595e-02,
+        8.687658017e-03, -6.793012983e-03, 5.243216403e-03, -3.984303047e-03,
+        2.971674903e-03, -2.167400657e-03, 1.538550005e-03, -1.056171183e-03,
+        6.946689195e-04, -4.314273726e-04, 2.465762630e-04, -1.228327918e-04
+    },
+    {
+        -8.792109370e-05, 1.913330778e-04, -3.492921792e-04, 5.779311333e-04,
+        -8.958877099e-04, 1.324444942e-03, -1.887727512e-03, 2.613011260e-03,
+        -3.531231856e-03, 4.677823253e-03, -6.094087966e-03, 7.829420899e-03,
+        -9.944918001e-03, 1.251928512e-02, -1.565870208e-02, 1.951380227e-02,
+        -2.431019559e-02, 3.040662838e-02, -3.841466691e-02, 4.947156890e-02,
+        -6.595669270e-02, 9.380508507e-02, -1.530309151e-01, 3.796727592e-01,
+        8.493724047e-01, -1.988665605e-01, 1.104754133e-01, -7.467880857e-02,
+        5.491531628e-02, -4.218085697e-02, 3.318840060e-02, -2.645529927e-02,
+        2.121570378e-02, -1.703387734e-02, 1.364257474e-02, -1.086724527e-02,
+        8.587307168e-03, -6.715037754e-03, 5.183491759e-03, -3.939338148e-03,
+        2.938512054e-03, -2.143541386e-03, 1.521897871e-03, -1.044984802e-03,
+        6.875211735e-04, -4.271683763e-04, 2.442987314e-04, -1.218391560e-04
+    },
+    {
+        -8.622799269e-05, 1.879431248e-04, -3.433720152e-04, 5.684130567e-04,
+        -8.814348523e-04, 1.303414324e-03, -1.858129930e-03, 2.572466048e-03,
+        -3.476913154e-03, 4.606392326e-03, -6.001602786e-03, 7.711208893e-03,
+        -9.795388936e-03, 1.233164545e-02, -1.542450330e-02, 1.922219971e-02,
+        -2.394667727e-02, 2.995071027e-02, -3.783539641e-02, 4.871783264e-02,
+        -6.493314847e-02, 9.229804007e-02, -1.503769427e-01, 3.711351925e-01,
+        8.551207466e-01, -1.971224817e-01, 1.092873253e-01, -7.382045073e-02,
+        5.426424774e-02, -4.167246765e-02, 3.278477511e-02, -2.613207662e-02,
+        2.095605692e-02, -1.682549191e-02, 1.347601625e-02, -1.073502376e-02,
+        8.483315978e-03, -6.634203604e-03, 5.121548859e-03, -3.892677159e-03,
+        2.904074955e-03, -2.118744708e-03, 1.504573407e-03, -1.033331002e-03,
+        6.800610035e-04, -4.227111094e-04, 2.419042410e-04, -1.207840262e-04
+    },
+    {
+        -8.451710674e-05, 1.845048340e-04, -3.373549126e-04, 5.587256893e-04,
+        -8.667099665e-04, 1.281970945e-03, -1.827932217e-03, 2.531076929e-03,
+        -3.421439332e-03, 4.533415089e-03, -5.907085691e-03, 7.590367982e-03,
+        -9.642502044e-03, 1.213976131e-02, -1.518498194e-02, 1.892395871e-02,
+        -2.357490023e-02, 2.948450763e-02, -3.724324812e-02, 4.794778304e-02,
+        -6.388851967e-02, 9.076291669e-02, -1.476851251e-01, 3.626079399e-01,
+        8.607736149e-01, -1.952846382e-01, 1.080499805e-01, -7.292981175e-02,
+        5.358984858e-02, -4.114633571e-02, 3.236726770e-02, -2.579781928e-02,
+        2.068756824e-02, -1.661000301e-02, 1.330375833e-02, -1.059824961e-02,
+        8.375714028e-03, -6.550533065e-03, 5.057404530e-03, -3.844332346e-03,
+        2.868372289e-03, -2.093016545e-03, 1.486580458e-03, -1.021212112e-03,
+        6.722896730e-04, -4.180561242e-04, 2.393929040e-04, -1.196672733e-04
+    },
+    {
+        -8.278940624e-05, 1.810200413e-04, -3.312439675e-04, 5.488738857e-04,
+        -8.517202823e-04, 1.260125161e-03, -1.797148754e-03, 2.488863380e-03,
+        -3.364836226e-03, 4.458925225e-03, -5.810579968e-03, 7.466953134e-03,
+        -9.486326473e-03, 1.194371910e-02, -1.494024549e-02, 1.861921283e-02,
+        -2.319503089e-02, 2.900822950e-02, -3.663848879e-02, 4.716176985e-02,
+        -6.282328684e-02, 8.920043267e-02, -1.449567159e-01, 3.540927471e-01,
+        8.663297156e-01, -1.933527375e-01, 1.067635575e-01, -7.200709369e-02,
+        5.289229574e-02, -4.060260870e-02, 3.193599953e-02, -2.545262594e-02,
+        2.041031758e-02, -1.638747474e-02, 1.312585194e-02, -1.045696290e-02,
+        8.264532394e-03, -6.464049850e-03, 4.991076518e-03, -3.794316682e-03,
+        2.831413273e-03, -2.066363213e-03, 1.467923153e-03, -1.008630657e-03,
+        6.642085782e-04, -4.132040579e-04, 2.367648827e-04, -1.184887949e-04
+    },
+    {
+        -8.104585980e-05, 1.774905881e-04, -3.250422942e-04, 5.388625393e-04,
+        -8.364730989e-04, 1.237887439e-03, -1.765794094e-03, 2.445845129e-03,
+        -3.307130025e-03, 4.382956897e-03, -5.712129539e-03, 7.341020151e-03,
+        -9.326932452e-03, 1.174360658e-02, -1.469040314e-02, 1.830809777e-02,
+        -2.280723835e-02, 2.852208827e-02, -3.602138922e-02, 4.636014776e-02,
+        -6.173793645e-02, 8.761131227e-02, -1.421929719e-01, 3.455913519e-01,
+        8.717877759e-01, -1.913265112e-01, 1.054282530e-01, -7.105251151e-02,
+        5.217177557e-02, -4.004144136e-02, 3.149109740e-02, -2.509659981e-02,
+        2.012438842e-02, -1.615797411e-02, 1.294235040e-02, -1.031120557e-02,
+        8.149803645e-03, -6.374778846e-03, 4.922583482e-03, -3.742643843e-03,
+        2.793207652e-03, -2.038791419e-03, 1.448605903e-03, -9.955893637e-04,
+        6.558192483e-04, -4.081556329e-04, 2.340203901e-04, -1.172485153e-04
+    },
+    {
+        -7.928743376e-05, 1.739183202e-04, -3.187530240e-04, 5.286965803e-04,
+        -8.209757815e-04, 1.215268356e-03, -1.733882954e-03, 2.402042142e-03,
+        -3.248347251e-03, 4.305544729e-03, -5.611778947e-03, 7.212625649e-03,
+        -9.164391255e-03, 1.153951284e-02, -1.443556576e-02, 1.799075133e-02,
+        -2.241169429e-02, 2.802629948e-02, -3.539222414e-02, 4.554327623e-02,
+        -6.063296066e-02, 8.599628597e-02, -1.393951528e-01, 3.371054833e-01,
+        8.771465444e-01, -1.892057153e-01, 1.040442828e-01, -7.006629299e-02,
+        5.142848385e-02, -3.946299561e-02, 3.103269375e-02, -2.472984857e-02,
+        1.982986780e-02, -1.592157102e-02, 1.275330935e-02, -1.016102142e-02,
+        8.031561831e-03, -6.282746108e-03, 4.851944992e-03, -3.689328200e-03,
+        2.753765699e-03, -2.010308261e-03, 1.428633400e-03, -9.820911519e-04,
+        6.471233455e-04, -4.029116566e-04, 2.311596901e-04, -1.159463863e-04
+    },
+    {
+        -7.751509183e-05, 1.703050876e-04, -3.123793037e-04, 5.183809731e-04,
+        -8.052357579e-04, 1.192278589e-03, -1.701430208e-03, 2.357474616e-03,
+        -3.188514757e-03, 4.226723794e-03, -5.509573332e-03, 7.081827029e-03,
+        -8.998775170e-03, 1.133152826e-02, -1.417584586e-02, 1.766731334e-02,
+        -2.200857292e-02, 2.752108179e-02, -3.475127207e-02, 4.471151935e-02,
+        -5.950885716e-02, 8.435609019e-02, -1.365645207e-01, 3.286368616e-01,
+        8.824047918e-01, -1.869901306e-01, 1.026118811e-01, -6.904867874e-02,
+        5.066262569e-02, -3.886744053e-02, 3.056092660e-02, -2.435248434e-02,
+        1.952684637e-02, -1.567833823e-02, 1.255878672e-02, -1.000645613e-02,
+        7.909842473e-03, -6.187978852e-03, 4.779181523e-03, -3.634384825e-03,
+        2.713098215e-03, -1.980921226e-03, 1.408010619e-03, -9.681391408e-04,
+        6.381226652e-04, -3.974730219e-04, 2.281830979e-04, -1.145823870e-04
+    },
+    {
+        -7.572979457e-05, 1.666527429e-04, -3.059242942e-04, 5.079207142e-04,
+        -7.892605152e-04, 1.168928914e-03, -1.668450883e-03, 2.312162971e-03,
+        -3.127659708e-03, 4.146529595e-03, -5.405558415e-03, 6.948682454e-03,
+        -8.830157472e-03, 1.111974450e-02, -1.391135753e-02, 1.733792562e-02,
+        -2.159805090e-02, 2.700665689e-02, -3.409881522e-02, 4.386524568e-02,
+        -5.836612890e-02, 8.269146702e-02, -1.337023398e-01, 3.201871977e-01,
+        8.875613106e-01, -1.846795623e-01, 1.011313007e-01, -6.799992213e-02,
+        4.987441554e-02, -3.825495226e-02, 3.007593954e-02, -2.396462367e-02,
+        1.921541828e-02, -1.542835139e-02, 1.235884277e-02, -9.847557192e-03,
+        7.784682560e-03, -6.090505450e-03, 4.704314451e-03, -3.577829480e-03,
+        2.671216522e-03, -1.950638188e-03, 1.386742814e-03, -9.537366459e-04,
+        6.288191357e-04, -3.918407073e-04, 2.250909798e-04, -1.131565242e-04
+    },
+    {
+        -7.393249902e-05, 1.629631409e-04, -2.993911692e-04, 4.973208303e-04,
+        -7.730575964e-04, 1.145230202e-03, -1.634960149e-03, 2.266127840e-03,
+        -3.065809572e-03, 4.064998053e-03, -5.299780475e-03, 6.813250822e-03,
+        -8.658612389e-03, 1.090425440e-02, -1.364221639e-02, 1.700273187e-02,
+        -2.118030726e-02, 2.648324936e-02, -3.343513939e-02, 4.300482811e-02,
+        -5.720528395e-02, 8.100316390e-02, -1.308098761e-01, 3.117581924e-01,
+        8.926149161e-01, -1.822738405e-01, 9.960281319e-02, -6.692028927e-02,
+        4.906407708e-02, -3.762571400e-02, 2.957788164e-02, -2.356638750e-02,
+        1.889568123e-02, -1.517168894e-02, 1.215354001e-02, -9.684373925e-03,
+        7.656120531e-03, -5.990355421e-03, 4.627366047e-03, -3.519678614e-03,
+        2.628132464e-03, -1.919467411e-03, 1.364835519e-03, -9.388871794e-04,
+        6.192148184e-04, -3.860157771e-04, 2.218837538e-04, -1.116688327e-04
+    },
+    {
+        -7.212415822e-05, 1.592381379e-04, -2.927831133e-04, 4.865863756e-04,
+        -7.566345974e-04, 1.121193409e-03, -1.600973316e-03, 2.219390061e-03,
+        -3.002992107e-03, 3.982165489e-03, -5.192286331e-03, 6.675591745e-03,
+        -8.484215072e-03, 1.068515202e-02, -1.336853955e-02, 1.666187769e-02,
+        -2.075552333e-02, 2.595108663e-02, -3.276053380e-02, 4.213064370e-02,
+        -5.602683525e-02, 7.929193334e-02, -1.278883969e-01, 3.033515365e-01,
+        8.975644463e-01, -1.797728203e-01, 9.802670889e-02, -6.581005897e-02,
+        4.823184323e-02, -3.697991597e-02, 2.906690748e-02, -2.315790109e-02,
+        1.856773640e-02, -1.490843215e-02, 1.194294322e-02, -9.516957469e-03,
+        7.524196270e-03, -5.887559423e-03, 4.548359472e-03, -3.459949365e-03,
+        2.583858404e-03, -1.887417539e-03, 1.342294547e-03, -9.235944493e-04,
+        6.093119074e-04, -3.799993812e-04, 2.185618898e-04, -1.101193755e-04
+    },
+    {
+        -7.030572085e-05, 1.554795903e-04, -2.861033213e-04, 4.757224299e-04,
+        -7.399991633e-04, 1.096829579e-03, -1.566505824e-03, 2.171970666e-03,
+        -2.939235352e-03, 3.898068610e-03, -5.083123324e-03, 6.535765519e-03,
+        -8.307041558e-03, 1.046253251e-02, -1.309044555e-02, 1.631551045e-02,
+        -2.032388266e-02, 2.541039884e-02, -3.207529102e-02, 4.124307349e-02,
+        -5.483130040e-02, 7.755853263e-02, -1.249391702e-01, 2.949689099e-01,
+        9.024087623e-01, -1.771763819e-01, 9.640329666e-02, -6.466952265e-02,
+        4.737795605e-02, -3.631775531e-02, 2.854317703e-02, -2.273929403e-02,
+        1.823168842e-02, -1.463866507e-02, 1.172711942e-02, -9.345360756e-03,
+        7.388951091e-03, -5.782149245e-03, 4.467318768e-03, -3.398659547e-03,
+        2.538407221e-03, -1.854497601e-03, 1.319125989e-03, -9.078623591e-04,
+        5.991127297e-04, -3.737927555e-04, 2.151259095e-04, -1.085082437e-04
+    },
+    {
+        -6.847813076e-05, 1.516893545e-04, -2.793549964e-04, 4.647340961e-04,
+        -7.231589854e-04, 1.072149832e-03, -1.531573238e-03, 2.123890874e-03,
+        -2.874567610e-03, 3.812744493e-03, -4.972339290e-03, 6.393833102e-03,
+        -8.127168745e-03, 1.023649216e-02, -1.280805432e-02, 1.596377923e-02,
+        -1.988557093e-02, 2.486141879e-02, -3.137970683e-02, 4.034250240e-02,
+        -5.361920149e-02, 7.580372356e-02, -1.219634648e-01, 2.866119815e-01,
+        9.071467488e-01, -1.744844308e-01, 9.473290409e-02, -6.349898435e-02,
+        4.650266670e-02, -3.563943607e-02, 2.800685568e-02, -2.231070020e-02,
+        1.788764535e-02, -1.436247451e-02, 1.150613785e-02, -9.169638500e-03,
+        7.250427729e-03, -5.674157796e-03, 4.384268855e-03, -3.335827652e-03,
+        2.491792303e-03, -1.820717008e-03, 1.295336211e-03, -8.916950073e-04,
+        5.886197445e-04, -3.673972215e-04, 2.115763865e-04, -1.068355573e-04
+    },
+    {
+        -6.664232660e-05, 1.478692855e-04, -2.725413488e-04, 4.536264983e-04,
+        -7.061217975e-04, 1.047165363e-03, -1.496191242e-03, 2.075172083e-03,
+        -2.809017442e-03, 3.726230569e-03, -4.859982549e-03, 6.249856085e-03,
+        -7.944674355e-03, 1.000712829e-02, -1.252148712e-02, 1.560683483e-02,
+        -1.944077591e-02, 2.430438179e-02, -3.067408007e-02, 3.942931904e-02,
+        -5.239106485e-02, 7.402827209e-02, -1.189625493e-01, 2.782824087e-01,
+        9.117773143e-01, -1.716968978e-01, 9.301587739e-02, -6.229876060e-02,
+        4.560623537e-02, -3.494516913e-02, 2.745811412e-02, -2.187225769e-02,
+        1.753571866e-02, -1.407995001e-02, 1.128006996e-02, -8.989847179e-03,
+        7.108670325e-03, -5.563619100e-03, 4.299235523e-03, -3.271472842e-03,
+        2.444027550e-03, -1.786085547e-03, 1.270931856e-03, -8.750966864e-04,
+        5.778355432e-04, -3.608141867e-04, 2.079139470e-04, -1.051014648e-04
+    },
+    {
+        -6.479924139e-05, 1.440212365e-04, -2.656655943e-04, 4.424047795e-04,
+        -6.888953729e-04, 1.021887438e-03, -1.460375630e-03, 2.025835856e-03,
+        -2.742613648e-03, 3.638564608e-03, -4.746101877e-03, 6.103896669e-03,
+        -7.759636902e-03, 9.774539244e-03, -1.223086649e-02, 1.524482962e-02,
+        -1.898968734e-02, 2.373952561e-02, -2.995871256e-02, 3.850391556e-02,
+        -5.114742085e-02, 7.223294811e-02, -1.159376924e-01, 2.699818368e-01,
+        9.162993913e-01, -1.688137392e-01, 9.125258139e-02, -6.106918039e-02,
+        4.468893121e-02, -3.423517215e-02, 2.689712835e-02, -2.142410880e-02,
+        1.717602316e-02, -1.379118382e-02, 1.104898935e-02, -8.806045021e-03,
+        6.963724417e-03, -5.450568282e-03, 4.212245425e-03, -3.205614944e-03,
+        2.395127366e-03, -1.750613383e-03, 1.245919838e-03, -8.580718821e-04,
+        5.667628491e-04, -3.540451441e-04, 2.041392690e-04, -1.033061437e-04
+    },
+    {
+        -6.294980213e-05, 1.401470578e-04, -2.587309532e-04, 4.310740991e-04,
+        -6.714875208e-04, 9.963273841e-04, -1.424142302e-03, 1.975903917e-03,
+        -2.675385260e-03, 3.549784701e-03, -4.630746489e-03, 5.956017636e-03,
+        -7.572135659e-03, 9.538824335e-03, -1.193631622e-02, 1.487791750e-02,
+        -1.853249688e-02, 2.316709034e-02, -2.923390897e-02, 3.756668746e-02,
+        -4.988880370e-02, 7.041852512e-02, -1.128901618e-01, 2.617118986e-01,
+        9.207119366e-01, -1.658349367e-01, 8.944339954e-02, -5.981058511e-02,
+        4.375103227e-02, -3.350966952e-02, 2.632407958e-02, -2.096639996e-02,
+        1.680867699e-02, -1.349627086e-02, 1.081297181e-02, -8.618291981e-03,
+        6.815636919e-03, -5.335041559e-03, 4.123326065e-03, -3.138274447e-03,
+        2.345106658e-03, -1.714311055e-03, 1.220307346e-03, -8.406252729e-04,
+        5.554045167e-04, -3.470916727e-04, 2.002530833e-04, -1.014498006e-04
+    },
+    {
+        -6.109492943e-05, 1.362485964e-04, -2.517406486e-04, 4.196396310e-04,
+        -6.539060832e-04, 9.704965918e-04, -1.387507256e-03, 1.925398139e-03,
+        -2.607361529e-03, 3.459929245e-03, -4.513966018e-03, 5.806282326e-03,
+        -7.382250628e-03, 9.300083817e-03, -1.163796128e-02, 1.450625390e-02,
+        -1.806939801e-02, 2.258731833e-02, -2.849997666e-02, 3.661803348e-02,
+        -4.861575120e-02, 6.858577992e-02, -1.098212244e-01, 2.534742144e-01,
+        9.250139318e-01, -1.627604978e-01, 8.758873381e-02, -5.852332845e-02,
+        4.279282541e-02, -3.276889226e-02, 2.573915422e-02, -2.049928173e-02,
+        1.643380160e-02, -1.319530871e-02, 1.057209524e-02, -8.426649727e-03,
+        6.664456114e-03, -5.217076231e-03, 4.032505799e-03, -3.069472491e-03,
+        2.293980827e-03, -1.677189470e-03, 1.194101837e-03, -8.227617283e-04,
+        5.437635316e-04, -3.399554366e-04, 1.962561728e-04, -9.953267131e-05
+    },
+    {
+        -5.923553708e-05, 1.323276947e-04, -2.446979051e-04, 4.081065615e-04,
+        -6.361589315e-04, 9.444065045e-04, -1.350486579e-03, 1.874340535e-03,
+        -2.538571910e-03, 3.369036928e-03, -4.395810493e-03, 5.654754607e-03,
+        -7.190062502e-03, 9.058418830e-03, -1.133592775e-02, 1.412999561e-02,
+        -1.760058598e-02, 2.200045406e-02, -2.775722559e-02, 3.565835540e-02,
+        -4.732880459e-02, 6.673549235e-02, -1.067321455e-01, 2.452703912e-01,
+        9.292043834e-01, -1.595904559e-01, 8.568900471e-02, -5.720777634e-02,
+        4.181460625e-02, -3.201307799e-02, 2.514254377e-02, -2.002290872e-02,
+        1.605152167e-02, -1.288839754e-02, 1.032643965e-02, -8.231181622e-03,
+        6.510231637e-03, -5.096710666e-03, 3.939813817e-03, -2.999230867e-03,
+        2.241765770e-03, -1.639259906e-03, 1.167311037e-03, -8.044863087e-04,
+        5.318430096e-04, -3.326381855e-04, 1.921493730e-04, -9.755502092e-05
+    },
+    {
+        -5.737253172e-05, 1.283861902e-04, -2.376059476e-04, 3.964800868e-04,
+        -6.182539631e-04, 9.180686162e-04, -1.313096445e-03, 1.822753251e-03,
+        -2.469046053e-03, 3.277146711e-03, -4.276330319e-03, 5.501498852e-03,
+        -6.995652633e-03, 8.813931368e-03, -1.103034280e-02, 1.374930080e-02,
+        -1.712625769e-02, 2.140674407e-02, -2.700596817e-02, 3.468805790e-02,
+        -4.602850826e-02, 6.486844499e-02, -1.036241888e-01, 2.371020223e-01,
+        9.332823233e-01, -1.563248699e-01, 8.374465121e-02, -5.586430684e-02,
+        4.081667905e-02, -3.124247083e-02, 2.453444481e-02, -1.953743953e-02,
+        1.566196509e-02, -1.257564015e-02, 1.007608714e-02, -8.031952698e-03,
+        6.353014457e-03, -4.973984292e-03, 3.845280141e-03, -2.927572007e-03,
+        2.188477872e-03, -1.600534006e-03, 1.139942940e-03, -7.858042634e-04,
+        5.196461965e-04, -3.251417539e-04, 1.879335719e-04, -9.551714410e-05
+    },
+    {
+        -5.550681243e-05, 1.244259143e-04, -2.304679996e-04, 3.847654108e-04,
+        -6.001990980e-04, 8.914944661e-04, -1.275353103e-03, 1.770658552e-03,
+        -2.398813788e-03, 3.184297814e-03, -4.155576257e-03, 5.346579909e-03,
+        -6.799103001e-03, 8.566724228e-03, -1.072133463e-02, 1.336432892e-02,
+        -1.664661164e-02, 2.080643683e-02, -2.624651916e-02, 3.370754839e-02,
+        -4.471540961e-02, 6.298542285e-02, -1.004986156e-01, 2.289706870e-01,
+        9.372468085e-01, -1.529638248e-01, 8.175613071e-02, -5.449331010e-02,
+        3.979935667e-02, -3.045732137e-02, 2.391505892e-02, -1.904303674e-02,
+        1.526526293e-02, -1.225714185e-02, 9.821121867e-03, -7.829029640e-03,
+        6.192856865e-03, -4.848937582e-03, 3.748935613e-03, -2.854518976e-03,
+        2.134134002e-03, -1.561023774e-03, 1.112005802e-03, -7.667210302e-04,
+        5.071764671e-04, -3.174680614e-04, 1.836097096e-04, -9.341936508e-05
+    },
+    {
+        -5.363927041e-05, 1.204486921e-04, -2.232872824e-04, 3.729677432e-04,
+        -5.820022759e-04, 8.646956341e-04, -1.237272876e-03, 1.718078819e-03,
+        -2.327905113e-03, 3.090529698e-03, -4.033599401e-03, 5.190063077e-03,
+        -6.600496177e-03, 8.316900976e-03, -1.040903241e-02, 1.297524064e-02,
+        -1.616184784e-02, 2.019978264e-02, -2.547919550e-02, 3.271723682e-02,
+        -4.339005877e-02, 6.108721309e-02, -9.735668478e-02, 2.208779504e-01,
+        9.410969221e-01, -1.495074315e-01, 7.972391894e-02, -5.309518820e-02,
+        3.876296044e-02, -2.965788652e-02, 2.328459262e-02, -1.853986685e-02,
+        1.486154939e-02, -1.193301050e-02, 9.561630003e-03, -7.622480767e-03,
+        6.029812454e-03, -4.721612045e-03, 3.650811886e-03, -2.780095472e-03,
+        2.078751508e-03, -1.520741572e-03, 1.083508144e-03, -7.472422332e-04,
+        4.944373249e-04, -3.096191122e-04, 1.791787791e-04, -9.126203780e-05
+    },
+    {
+        -5.177078855e-05, 1.164563411e-04, -2.160670133e-04, 3.610922974e-04,
+        -5.636714523e-04, 8.376837355e-04, -1.198872149e-03, 1.665036534e-03,
+        -2.256350185e-03, 2.995882048e-03, -3.910451159e-03, 5.032014078e-03,
+        -6.399915291e-03, 8.064565899e-03, -1.009356623e-02, 1.258219779e-02,
+        -1.567216772e-02, 1.958703357e-02, -2.470431626e-02, 3.171753558e-02,
+        -4.205300843e-02, 5.917460475e-02, -9.419965219e-02, 2.128253626e-01,
+        9.448317731e-01, -1.459558270e-01, 7.764850994e-02, -5.167035512e-02,
+        3.770782009e-02, -2.884442950e-02, 2.264325729e-02, -1.802810017e-02,
+        1.445096175e-02, -1.160335641e-02, 9.297699736e-03, -7.412376002e-03,
+        5.863936104e-03, -4.592050208e-03, 3.550941414e-03, -2.704325810e-03,
+        2.022348213e-03, -1.479700119e-03, 1.054458746e-03, -7.273736825e-04,
+        4.814324009e-04, -3.015969945e-04, 1.746418254e-04, -8.904554598e-05
+    },
+    {
+        -4.990224116e-05, 1.124506706e-04, -2.088104043e-04, 3.491442877e-04,
+        -5.452145957e-04, 8.104704166e-04, -1.160167363e-03, 1.611554275e-03,
+        -2.184179301e-03, 2.900394759e-03, -3.786183230e-03, 4.872499029e-03,
+        -6.197443999e-03, 7.809823966e-03, -9.775067050e-03, 1.218536327e-02,
+        -1.517777407e-02, 1.896844331e-02, -2.392220240e-02, 3.070885927e-02,
+        -4.070481361e-02, 5.724838840e-02, -9.102877041e-02, 2.048144586e-01,
+        9.484504967e-01, -1.423091743e-01, 7.553041597e-02, -5.021923658e-02,
+        3.663427365e-02, -2.801721976e-02, 2.199126912e-02, -1.750791086e-02,
+        1.403364033e-02, -1.126829236e-02, 9.029421219e-03, -7.198786857e-03,
+        5.695283965e-03, -4.460295606e-03, 3.449357444e-03, -2.627234920e-03,
+        1.964942407e-03, -1.437912485e-03, 1.024866645e-03, -7.071213718e-04,
+        4.681654533e-04, -2.934038805e-04, 1.699999459e-04, -8.677030317e-05
+    },
+    {
+        -4.803449358e-05, 1.084334814e-04, -2.015206611e-04, 3.371289281e-04,
+        -5.266396842e-04, 7.830673497e-04, -1.121175013e-03, 1.557654703e-03,
+        -2.111422893e-03, 2.804107919e-03, -3.660847585e-03, 4.711584416e-03,
+        -5.993166443e-03, 7.552780782e-03, -9.453666638e-03, 1.178490102e-02,
+        -1.467887093e-02, 1.834426708e-02, -2.313317675e-02, 2.969162458e-02,
+        -3.934603144e-02, 5.530935593e-02, -8.784528833e-02, 1.968467581e-01,
+        9.519522547e-01, -1.385676626e-01, 7.337016740e-02, -4.874226996e-02,
+        3.554266735e-02, -2.717653282e-02, 2.132884903e-02, -1.697947678e-02,
+        1.360972845e-02, -1.092793355e-02, 8.756886552e-03, -6.981786406e-03,
+        5.523913436e-03, -4.326392768e-03, 3.346094001e-03, -2.548848340e-03,
+        1.906552846e-03, -1.395392085e-03, 9.947411350e-04, -6.864914774e-04,
+        4.546403663e-04, -2.850420259e-04, 1.652542900e-04, -8.443675286e-05
+    },
+    {
+        -4.616840183e-05, 1.044065644e-04, -1.942009815e-04, 3.250514292e-04,
+        -5.079547021e-04, 7.554862284e-04, -1.081911634e-03, 1.503360557e-03,
+        -2.038111510e-03, 2.707061790e-03, -3.534496443e-03, 4.549337069e-03,
+        -5.787167225e-03, 7.293542548e-03, -9.129497529e-03, 1.138097593e-02,
+        -1.417566353e-02, 1.771476154e-02, -2.233756380e-02, 2.866625009e-02,
+        -3.797722095e-02, 5.335830018e-02, -8.465045076e-02, 1.889237646e-01,
+        9.553362355e-01, -1.347315072e-01, 7.116831269e-02, -4.723990420e-02,
+        3.443335555e-02, -2.632265028e-02, 2.065622261e-02, -1.644297950e-02,
+        1.317937237e-02, -1.058239753e-02, 8.480189743e-03, -6.761449262e-03,
+        5.349883148e-03, -4.190387201e-03, 3.241185883e-03, -2.469192202e-03,
+        1.847198740e-03, -1.352152683e-03, 9.640917615e-04, -6.654903562e-04,
+        4.408611493e-04, -2.765137696e-04, 1.604060593e-04, -8.204536849e-05
+    },
+    {
+        -4.430481233e-05, 1.003717003e-04, -1.868545544e-04, 3.129169970e-04,
+        -4.891676366e-04, 7.277387627e-04, -1.042393802e-03, 1.448694639e-03,
+        -1.964275808e-03, 2.609296796e-03, -3.407182252e-03, 4.385824130e-03,
+        -5.579531368e-03, 7.032216017e-03, -8.802692963e-03, 1.097375379e-02,
+        -1.366835820e-02, 1.708018469e-02, -2.153568965e-02, 2.763315614e-02,
+        -3.659894285e-02, 5.139601473e-02, -8.144549812e-02, 1.810469654e-01,
+        9.586016546e-01, -1.308009496e-01, 6.892541824e-02, -4.571259966e-02,
+        3.330670057e-02, -2.545585965e-02, 1.997362005e-02, -1.589860421e-02,
+        1.274272126e-02, -1.023180419e-02, 8.199426686e-03, -6.537851553e-03,
+        5.173252945e-03, -4.052325376e-03, 3.134668645e-03, -2.388293233e-03,
+        1.786899755e-03, -1.308208378e-03, 9.329283203e-04, -6.441245447e-04,
+        4.268319358e-04, -2.678215327e-04, 1.554565072e-04, -7.959665349e-05
+    },
+    {
+        -4.244456155e-05, 9.633065896e-05, -1.794845580e-04, 3.007308300e-04,
+        -4.702864749e-04, 6.998366744e-04, -1.002638119e-03, 1.393679811e-03,
+        -1.889946537e-03, 2.510853502e-03, -3.278957668e-03, 4.221113030e-03,
+        -5.370344281e-03, 6.768908449e-03, -8.473386834e-03, 1.056340120e-02,
+        -1.315716229e-02, 1.644079574e-02, -2.072788178e-02, 2.659276465e-02,
+        -3.521175932e-02, 4.942329353e-02, -7.823166600e-02, 1.732178312e-01,
+        9.617477547e-01, -1.267762574e-01, 6.664206832e-02, -4.416082799e-02,
+        3.216307262e-02, -2.457645434e-02, 1.928127604e-02, -1.534653966e-02,
+        1.229992711e-02, -9.876275717e-03, 7.914695121e-03, -6.311070892e-03,
+        4.994083865e-03, -3.912254714e-03, 3.026578588e-03, -2.306178738e-03,
+        1.725676000e-03, -1.263573608e-03, 9.012608544e-04, -6.224007563e-04,
+        4.125569826e-04, -2.589678187e-04, 1.504069388e-04, -7.709114130e-05
+    },
+    {
+        -4.058847566e-05, 9.228519835e-05, -1.720941593e-04, 2.884981178e-04,
+        -4.513192006e-04, 6.717916925e-04, -9.626612140e-04, 1.338338982e-03,
+        -1.815154529e-03, 2.411772603e-03, -3.149875530e-03, 4.055271461e-03,
+        -5.159691728e-03, 6.503727573e-03, -8.141713636e-03, 1.015008552e-02,
+        -1.264228408e-02, 1.579685505e-02, -1.991446903e-02, 2.554549895e-02,
+        -3.381623379e-02, 4.744093069e-02, -7.501018487e-02, 1.654378158e-01,
+        9.647738056e-01, -1.226577247e-01, 6.431886496e-02, -4.258507206e-02,
+        3.100284972e-02, -2.368473349e-02, 1.857942970e-02, -1.478697809e-02,
+        1.185114475e-02, -9.515936544e-03, 7.626094603e-03, -6.081186359e-03,
+        4.812438117e-03, -3.770223567e-03, 2.916952753e-03, -2.222876596e-03,
+        1.663548023e-03, -1.218263139e-03, 8.690996511e-04, -6.003258800e-04,
+        3.980406685e-04, -2.499552126e-04, 1.452587106e-04, -7.452939539e-05
+    },
+    {
+        -3.873737030e-05, 8.823706420e-05, -1.646865120e-04, 2.762240384e-04,
+        -4.322737907e-04, 6.436155479e-04, -9.224797308e-04, 1.282695099e-03,
+        -1.739930684e-03, 2.312094901e-03, -3.019988845e-03, 3.888367347e-03,
+        -4.947659790e-03, 6.236781538e-03, -7.807808411e-03, 9.733974801e-03,
+        -1.212393269e-02, 1.514862398e-02, -1.909578137e-02, 2.449178361e-02,
+        -3.241293074e-02, 4.544972015e-02, -7.178227969e-02, 1.577083554e-01,
+        9.676791050e-01, -1.184456715e-01, 6.195642785e-02, -4.098582574e-02,
+        2.982641751e-02, -2.278100191e-02, 1.786832454e-02, -1.422011519e-02,
+        1.139653172e-02, -9.150913316e-03, 7.333726472e-03, -5.848278468e-03,
+        4.628379062e-03, -3.626281206e-03, 2.805828899e-03, -2.138415249e-03,
+        1.600536807e-03, -1.172292066e-03, 8.364552387e-04, -5.779069785e-04,
+        3.832874935e-04, -2.407863800e-04, 1.400132305e-04, -7.191200921e-05
+    },
+    {
+        -3.689205023e-05, 8.418798917e-05, -1.572647560e-04, 2.639137565e-04,
+        -4.131582124e-04, 6.153199694e-04, -8.821103241e-04, 1.226771139e-03,
+        -1.664305959e-03, 2.211861295e-03, -2.889350761e-03, 3.720468820e-03,
+        -4.734334832e-03, 5.968178871e-03, -7.471806690e-03, 9.315237723e-03,
+        -1.160231803e-02, 1.449636481e-02, -1.827214984e-02, 2.343204430e-02,
+        -3.100241546e-02, 4.345045539e-02, -6.854916956e-02, 1.500308689e-01,
+        9.704629783e-01, -1.141404442e-01, 5.955539419e-02, -3.936359386e-02,
+        2.863416919e-02, -2.186556997e-02, 1.714820833e-02, -1.364615001e-02,
+        1.093624826e-02, -8.781334845e-03, 7.037693815e-03, -5.612429140e-03,
+        4.441971192e-03, -3.480477802e-03, 2.693245500e-03, -2.052823693e-03,
+        1.536663760e-03, -1.125675804e-03, 8.033383835e-04, -5.551512860e-04,
+        3.683020772e-04, -2.314640673e-04, 1.346719573e-04, -6.923960623e-05
+    },
+    {
+        -3.505330903e-05, 8.013969223e-05, -1.498320157e-04, 2.515724216e-04,
+        -3.939804198e-04, 5.869166786e-04, -8.415696521e-04, 1.170590098e-03,
+        -1.588311357e-03, 2.111112760e-03, -2.758014548e-03, 3.551644187e-03,
+        -4.519803471e-03, 5.698028439e-03, -7.133844444e-03, 8.894043516e-03,
+        -1.107765068e-02, 1.384034065e-02, -1.744390642e-02, 2.236670761e-02,
+        -2.958525385e-02, 4.144392918e-02, -6.531206734e-02, 1.424067568e-01,
+        9.731247787e-01, -1.097424155e-01, 5.711641863e-02, -3.771889200e-02,
+        2.742650538e-02, -2.093875354e-02, 1.641933303e-02, -1.306528491e-02,
+        1.047045726e-02, -8.407332064e-03, 6.738101432e-03, -5.373721680e-03,
+        4.253280106e-03, -3.332864410e-03, 2.579241727e-03, -1.966131472e-03,
+        1.471950708e-03, -1.078430088e-03, 7.697600866e-04, -5.320662059e-04,
+        3.530891575e-04, -2.219911002e-04, 1.292364008e-04, -6.651283985e-05
+    },
+    {
+        -3.322192886e-05, 7.609387797e-05, -1.423913989e-04, 2.392051655e-04,
+        -3.747483511e-04, 5.584173852e-04, -8.008743696e-04, 1.114174985e-03,
+        -1.511977912e-03, 2.009890333e-03, -2.626033578e-03, 3.381961911e-03,
+        -4.304152536e-03, 5.426439399e-03, -6.794058030e-03, 8.470561899e-03,
+        -1.055014183e-02, 1.318081530e-02, -1.661138382e-02, 2.129620087e-02,
+        -2.816201224e-02, 3.943093328e-02, -6.207217937e-02, 1.348374015e-01,
+        9.756638877e-01, -1.052519840e-01, 5.464017308e-02, -3.605224639e-02,
+        2.620383399e-02, -2.000087382e-02, 1.568195472e-02, -1.247772547e-02,
+        9.999324175e-03, -8.029037983e-03, 6.435055797e-03, -5.132240742e-03,
+        4.062372490e-03, -3.183492951e-03, 2.463857435e-03, -1.878368661e-03,
+        1.406419891e-03, -1.030570960e-03, 7.357315805e-04, -5.086593092e-04,
+        3.376535900e-04, -2.123703835e-04, 1.237081209e-04, -6.373239338e-05
+    },
+    {
+        -3.139868015e-05, 7.205223602e-05, -1.349459958e-04, 2.268171007e-04,
+        -3.554699249e-04, 5.298337827e-04, -7.600411220e-04, 1.057548809e-03,
+        -1.435336676e-03, 1.908235096e-03, -2.493461302e-03, 3.211490575e-03,
+        -4.087469039e-03, 5.153521157e-03, -6.452584133e-03, 8.044963016e-03,
+        -1.002000318e-02, 1.251805320e-02, -1.577491547e-02, 2.022095201e-02,
+        -2.673325709e-02, 3.741225815e-02, -5.883070504e-02, 1.273241666e-01,
+        9.780797153e-01, -1.006695748e-01, 5.212734660e-02, -3.436419373e-02,
+        2.496657011e-02, -1.905225727e-02, 1.493633349e-02, -1.188368045e-02,
+        9.523016992e-03, -7.646587642e-03, 6.128665027e-03, -4.888072304e-03,
+        3.869316095e-03, -3.032416197e-03, 2.347133150e-03, -1.789565862e-03,
+        1.340093954e-03, -9.821147744e-04, 7.012643256e-04, -4.849383318e-04,
+        3.220003457e-04, -2.026049001e-04, 1.180887279e-04, -6.089897995e-05
+    },
+    {
+        -2.958432133e-05, 6.801644038e-05, -1.274988775e-04, 2.144133184e-04,
+        -3.361530377e-04, 5.011775435e-04, -7.190865382e-04, 1.000734573e-03,
+        -1.358418711e-03, 1.806188160e-03, -2.360351228e-03, 3.040298863e-03,
+        -3.869840138e-03, 4.879383326e-03, -6.109559715e-03, 7.617417364e-03,
+        -9.487446878e-03, 1.185231926e-02, -1.493483529e-02, 1.914138938e-02,
+        -2.529955488e-02, 3.538869270e-02, -5.558883651e-02, 1.198683968e-01,
+        9.803716995e-01, -9.599563884e-02, 4.957864528e-02, -3.265528106e-02,
+        2.371513585e-02, -1.809323551e-02, 1.418273340e-02, -1.128336167e-02,
+        9.041706161e-03, -7.260118067e-03, 5.819038840e-03, -4.641303639e-03,
+        3.674179708e-03, -2.879687747e-03, 2.229110060e-03, -1.699754195e-03,
+        1.272995939e-03, -9.330781838e-04, 6.663700063e-04, -4.609111721e-04,
+        3.061345105e-04, -1.926977105e-04, 1.123798817e-04, -5.801334248e-05
+    },
+    {
+        -2.777959861e-05, 6.398814883e-05, -1.200530951e-04, 2.019988861e-04,
+        -3.168055604e-04, 4.724603146e-04, -6.780272243e-04, 9.437552618e-04,
+        -1.281255073e-03, 1.703790648e-03, -2.226756904e-03, 2.868455527e-03,
+        -3.651353102e-03, 4.604135684e-03, -5.765121963e-03, 7.188095728e-03,
+        -8.952685416e-03, 1.118387880e-02, -1.409147761e-02, 1.805794161e-02,
+        -2.386147182e-02, 3.336102398e-02, -5.234775836e-02, 1.124714173e-01,
+        9.825393075e-01, -9.123065341e-02, 4.699479205e-02, -3.092606560e-02,
+        2.244996023e-02, -1.712414520e-02, 1.342142232e-02, -1.067698401e-02,
+        8.555564537e-03, -6.869768220e-03, 5.506288517e-03, -4.392023280e-03,
+        3.477033134e-03, -2.725362015e-03, 2.109829992e-03, -1.608965279e-03,
+        1.205149276e-03, -8.834781381e-04, 6.310605280e-04, -4.365858889e-04,
+        2.900612828e-04, -1.826519519e-04, 1.065832919e-04, -5.507625353e-05
+    },
+    {
+        -2.598524569e-05, 5.996900227e-05, -1.126116784e-04, 1.895788464e-04,
+        -2.974353354e-04, 4.436937128e-04, -6.368797570e-04, 8.866338375e-04,
+        -1.203876802e-03, 1.601083681e-03, -2.092731891e-03, 2.696029363e-03,
+        -3.432095277e-03, 4.327888124e-03, -5.419408228e-03, 6.757169114e-03,
+        -8.415931557e-03, 1.051299746e-02, -1.324517703e-02, 1.697103742e-02,
+        -2.241957370e-02, 3.133003693e-02, -4.910864722e-02, 1.051345338e-01,
+        9.845820348e-01, -8.637512168e-02, 4.437652656e-02, -2.917711456e-02,
+        2.117147904e-02, -1.614532791e-02, 1.265267189e-02, -1.006476526e-02,
+        8.064767323e-03, -6.475678949e-03, 5.190526866e-03, -4.140320994e-03,
+        3.277947172e-03, -2.569494209e-03, 1.989335404e-03, -1.517231230e-03,
+        1.136577781e-03, -8.333318778e-04, 5.953480125e-04, -4.119706989e-04,
+        2.737859727e-04, -1.724708371e-04, 1.007007169e-04, -5.208851522e-05
+    },
+    {
+        -2.420198352e-05, 5.596062421e-05, -1.051776348e-04, 1.771582142e-04,
+        -2.780501737e-04, 4.148893203e-04, -5.956606774e-04, 8.293932263e-04,
+        -1.126314905e-03, 1.498108358e-03, -1.958329748e-03, 2.523089181e-03,
+        -3.212154055e-03, 4.050750621e-03, -5.072555981e-03, 6.324808684e-03,
+        -7.877398254e-03, 9.839941058e-03, -1.239626829e-02, 1.588110545e-02,
+        -2.097442562e-02, 2.929651409e-02, -4.587267150e-02, 9.785903201e-02,
+        9.864994063e-01, -8.142957290e-02, 4.172460502e-02, -2.740900504e-02,
+        1.988013469e-02, -1.515713003e-02, 1.187675741e-02, -9.446926081e-03,
+        7.569492005e-03, -6.077992942e-03, 4.871868178e-03, -3.886287746e-03,
+        3.076993584e-03, -2.412140309e-03, 1.867669371e-03, -1.424584647e-03,
+        1.067305642e-03, -7.826569284e-04, 5.592447948e-04, -3.870739738e-04,
+        2.573140003e-04, -1.621576539e-04, 9.473396370e-05, -4.905095912e-05
+    },
+    {
+        -2.243052009e-05, 5.196462012e-05, -9.775394818e-05, 1.647419757e-04,
+        -2.586578518e-04, 3.860586802e-04, -5.543864841e-04, 7.720563114e-04,
+        -1.048600353e-03, 1.394905743e-03, -1.823604006e-03, 2.349703783e-03,
+        -2.991616834e-03, 3.772833181e-03, -4.724702752e-03, 5.891185686e-03,
+        -7.337298559e-03, 9.164975498e-03, -1.154508616e-02, 1.478857414e-02,
+        -1.952659184e-02, 2.726123535e-02, -4.264099099e-02, 9.064617756e-02,
+        9.882909755e-01, -7.639456218e-02, 3.903980001e-02, -2.562232379e-02,
+        1.857637607e-02, -1.415990266e-02, 1.109395774e-02, -8.823689938e-03,
+        7.069918292e-03, -5.676854672e-03, 4.550428190e-03, -3.630015672e-03,
+        2.874245077e-03, -2.253357054e-03, 1.744875566e-03, -1.331058600e-03,
+        9.973574106e-04, -7.314710947e-04, 5.227634185e-04, -3.619042381e-04,
+        2.406508938e-04, -1.517157641e-04, 8.868488771e-05, -4.596444609e-05
+    },
+    {
+        -2.067155019e-05, 4.798257688e-05, -9.034357789e-05, 1.523350857e-04,
+        -2.392661086e-04, 3.572132921e-04, -5.130736274e-04, 7.146459241e-04,
+        -9.707640600e-04, 1.291516850e-03, -1.688608151e-03, 2.175941931e-03,
+        -2.770570990e-03, 3.494245800e-03, -4.375986077e-03, 5.456471390e-03,
+        -6.795845551e-03, 8.488366685e-03, -1.069196527e-02, 1.369387152e-02,
+        -1.807663552e-02, 2.522497764e-02, -3.941475660e-02, 8.349721540e-02,
+        9.899563254e-01, -7.127067054e-02, 3.632290035e-02, -2.381766707e-02,
+        1.726065841e-02, -1.315400144e-02, 1.030455522e-02, -8.195282994e-03,
+        6.566228051e-03, -5.272410352e-03, 4.226324042e-03, -3.371598043e-03,
+        2.669775272e-03, -2.093201913e-03, 1.620998247e-03, -1.236686620e-03,
+        9.267579997e-04, -6.797924544e-04, 4.859166321e-04, -3.364701660e-04,
+        2.238022879e-04, -1.411486027e-04, 8.255539189e-05, -4.282986616e-05
+    },
+    {
+        -1.892575518e-05, 4.401606226e-05, -8.294945752e-05, 1.399424663e-04,
+        -2.198826426e-04, 3.283646078e-04, -4.717385024e-04, 6.571848346e-04,
+        -8.928368757e-04, 1.187982624e-03, -1.553395600e-03, 2.001872323e-03,
+        -2.549103836e-03, 3.215098425e-03, -4.026543451e-03, 5.020837021e-03,
+        -6.253252243e-03, 7.810380411e-03, -9.837240019e-03, 1.259742509e-02,
+        -1.662511857e-02, 2.318851472e-02, -3.619511001e-02, 7.641336975e-02,
+        9.914950682e-01, -6.605850474e-02, 3.357471087e-02, -2.199564049e-02,
+        1.593344312e-02, -1.213978650e-02, 9.508835547e-03, -7.561934049e-03,
+        6.058605242e-03, -4.864807876e-03, 3.899674239e-03, -3.111129230e-03,
+        2.463658682e-03, -1.931733073e-03, 1.496082241e-03, -1.141502685e-03,
+        8.555326690e-04, -6.276393527e-04, 4.487173848e-04, -3.107805790e-04,
+        2.067739222e-04, -1.304596765e-04, 7.634742651e-05, -3.964813833e-05
+    },
+    {
+        -1.719380281e-05, 4.006662432e-05, -7.557449392e-05, 1.275690050e-04,
+        -2.005151092e-04, 2.995240268e-04, -4.303974433e-04, 5.996957435e-04,
+        -8.148495725e-04, 1.084343925e-03, -1.418019683e-03, 1.827563567e-03,
+        -2.327302598e-03, 2.935500906e-03, -3.676512265e-03, 4.584453691e-03,
+        -5.709731510e-03, 7.131282249e-03, -8.981244437e-03, 1.149966163e-02,
+        -1.517260137e-02, 2.115261687e-02, -3.298318336e-02, 6.939584374e-02,
+        9.929068455e-01, -6.075869724e-02, 3.079605228e-02, -2.015685877e-02,
+        1.459519765e-02, -1.111762227e-02, 8.707087696e-03, -6.923874450e-03,
+        5.547235853e-03, -4.454196772e-03, 3.570598602e-03, -2.848704676e-03,
+        2.255970682e-03, -1.769009414e-03, 1.370172929e-03, -1.045541211e-03,
+        7.837070190e-04, -5.750303953e-04, 4.111788217e-04, -2.848444426e-04,
+        1.895716395e-04, -1.196525636e-04, 7.006298854e-05, -3.642021042e-05
+    },
+    {
+        -1.547634698e-05, 3.613579091e-05, -6.822156613e-05, 1.152195526e-04,
+        -1.811711173e-04, 2.707028919e-04, -3.890667166e-04, 5.422012730e-04,
+        -7.368328338e-04, 9.806415164e-04, -1.282533620e-03, 1.653084153e-03,
+        -2.105254370e-03, 2.655562958e-03, -3.326029762e-03, 4.147492336e-03,
+        -5.165496000e-03, 6.451337460e-03, -8.124312056e-03, 1.040100705e-02,
+        -1.371964266e-02, 1.911805063e-02, -2.978009893e-02, 6.244581916e-02,
+        9.941913285e-01, -5.537190610e-02, 2.798776096e-02, -1.830194563e-02,
+        1.324639534e-02, -1.008787740e-02, 7.899603811e-03, -6.281338016e-03,
+        5.032307835e-03, -4.040728145e-03, 3.239218231e-03, -2.584420858e-03,
+        2.046787486e-03, -1.605090491e-03, 1.243316230e-03, -9.488370387e-04,
+        7.113069818e-04, -5.219844428e-04, 3.733142801e-04, -2.586708639e-04,
+        1.722013837e-04, -1.087309118e-04, 6.370412117e-05, -3.314705887e-05
+    },
+    {
+        -1.377402759e-05, 3.222506916e-05, -6.089352436e-05, 1.028989217e-04,
+        -1.618582270e-04, 2.419124850e-04, -3.477625154e-04, 4.847239583e-04,
+        -6.588172421e-04, 8.769160451e-04, -1.146990505e-03, 1.478502426e-03,
+        -1.883046088e-03, 2.375394115e-03, -2.975232979e-03, 3.710123649e-03,
+        -4.620758054e-03, 5.770810887e-03, -7.266775786e-03, 9.301886237e-03,
+        -1.226679924e-02, 1.708557858e-02, -2.658696885e-02, 5.556445618e-02,
+        9.953482180e-01, -4.989881485e-02, 2.515068874e-02, -1.643153353e-02,
+        1.188751524e-02, -9.050924618e-03, 7.086679098e-03, -5.634560946e-03,
+        4.514011032e-03, -3.624554623e-03, 2.905655460e-03, -2.318375251e-03,
+        1.836186114e-03, -1.440036508e-03, 1.115558583e-03, -8.514254217e-04,
+        6.383588115e-04, -4.685206037e-04, 3.351372843e-04, -2.322690880e-04,
+        1.546691979e-04, -9.769843811e-05, 5.727291323e-05, -2.982968851e-05
+    },
+    {
+        -1.208747034e-05, 2.833594496e-05, -5.359318900e-05, 9.061188483e-05,
+        -1.425839466e-04, 2.131640233e-04, -3.065009529e-04, 4.272862392e-04,
+        -5.808332674e-04, 7.732080280e-04, -1.011443278e-03, 1.303886561e-03,
+        -1.660764497e-03, 2.095103693e-03, -2.624258694e-03, 3.272518015e-03,
+        -4.075729627e-03, 5.089966855e-03, -6.408967786e-03, 8.202722892e-03,
+        -1.081462586e-02, 1.505595904e-02, -2.340489481e-02, 4.875289313e-02,
+        9.963772443e-01, -4.434013242e-02, 2.228570275e-02, -1.454626355e-02,
+        1.051904197e-02, -8.007140594e-03, 6.268611729e-03, -4.983781742e-03,
+        3.992537116e-03, -3.205830304e-03, 2.570033808e-03, -2.050666298e-03,
+        1.624244371e-03, -1.273908301e-03, 9.869469340e-04, -7.533420131e-04,
+        5.648890757e-04, -4.146582280e-04, 2.966615418e-04, -2.056484955e-04,
+        1.369812227e-04, -8.655892700e-05, 5.077149861e-05, -2.646913237e-05
+    },
+    {
+        -1.041728652e-05, 2.446988247e-05, -4.632334958e-05, 7.836317271e-05,
+        -1.233557297e-04, 1.844686541e-04, -2.652980567e-04, 3.699104510e-04,
+        -5.029112555e-04, 6.695578358e-04, -8.759447122e-04, 1.129304538e-03,
+        -1.438496111e-03, 1.814800740e-03, -2.273243379e-03, 2.834845443e-03,
+        -3.530622207e-03, 4.409069070e-03, -5.551219345e-03, 7.103939370e-03,
+        -9.363674943e-03, 1.302994582e-02, -2.023496769e-02, 4.201224620e-02,
+        9.972781676e-01, -3.869659300e-02, 1.939368519e-02, -1.264678510e-02,
+        9.141465548e-03, -6.956905819e-03, 5.445702729e-03, -4.329241121e-03,
+        3.468079512e-03, -2.784710696e-03, 2.232477943e-03, -1.781393368e-03,
+        1.411040813e-03, -1.106767316e-03, 8.575287139e-04, -6.546228535e-04,
+        4.909246456e-04, -3.604169005e-04, 2.579009377e-04, -1.788185991e-04,
+        1.191436942e-04, -7.531622966e-05, 4.420205567e-05, -2.306645143e-05
+    },
+    {
+        -8.764072917e-06, 2.062832364e-05, -3.908676385e-05, 6.615747266e-05,
+        -1.041809725e-04, 1.558374519e-04, -2.241697623e-04, 3.126188170e-04,
+        -4.250814168e-04, 5.660056782e-04, -7.405473898e-04, 9.548241136e-04,
+        -1.216327187e-03, 1.534594003e-03, -1.922323141e-03, 2.397275506e-03,
+        -2.985646732e-03, 3.728380522e-03, -4.693860754e-03, 6.005956529e-03,
+        -7.914496429e-03, 1.100828798e-02, -1.707826738e-02, 3.534360922e-02,
+        9.980507780e-01, -3.296895591e-02, 1.647553310e-02, -1.073375581e-02,
+        7.755281235e-03, -5.900604467e-03, 4.618255870e-03, -3.671181926e-03,
+        2.940833335e-03, -2.361352666e-03, 1.893113630e-03, -1.510656725e-03,
+        1.196654724e-03, -9.386755816e-04, 7.273518262e-04, -5.553043581e-04,
+        4.164926871e-04, -3.058164337e-04, 2.188695307e-04, -1.517890402e-04,
+        1.011629417e-04, -6.397426262e-05, 3.756680661e-05, -1.962273437e-05
+    },
+    {
+        -7.128411581e-06, 1.681268776e-05, -3.188615680e-05, 5.399942682e-05,
+        -8.506701145e-05, 1.272814134e-04, -1.831319080e-04, 2.554334392e-04,
+        -3.473738144e-04, 4.625915883e-04, -6.053036832e-04, 7.805127964e-04,
+        -9.943436881e-04, 1.254591881e-03, -1.571633675e-03, 1.959977273e-03,
+        -2.441013511e-03, 3.048163384e-03, -3.837221181e-03, 4.909193572e-03,
+        -6.467637575e-03, 8.991729588e-03, -1.393586238e-02, 2.874805345e-02,
+        9.986948953e-01, -2.715800546e-02, 1.353215818e-02, -8.807841266e-03,
+        6.360989356e-03, -4.838624260e-03, 3.786577566e-03, -3.009849041e-03,
+        2.410995314e-03, -1.935914379e-03, 1.552067686e-03, -1.238557490e-03,
+        9.811660806e-04, -7.696956939e-04, 5.964646279e-04, -4.554233038e-04,
+        3.416206504e-04, -2.508768612e-04, 1.795815479e-04, -1.245695861e-04,
+        8.304538586e-05, -5.253700659e-05, 3.086801682e-05, -1.613909728e-05
+    },
+    {
+        -5.510869726e-06, 1.302437100e-05, -2.472421973e-05, 4.189363053e-05,
+        -6.602112007e-05, 9.881145358e-05, -1.422002278e-04, 1.983762909e-04,
+        -2.698183533e-04, 3.593554076e-04, -4.702657354e-04, 6.064378215e-04,
+        -7.726312537e-04, 9.749023867e-04, -1.221310209e-03, 1.523119247e-03,
+        -1.896932148e-03, 2.368678913e-03, -2.981628551e-03, 3.814067897e-03,
+        -5.023642750e-03, 6.981009450e-03, -1.080880960e-02, 2.222662730e-02,
+        9.992103695e-01, -2.126455085e-02, 1.056448653e-02, -6.869714831e-03,
+        4.959095139e-03, -3.771356335e-03, 2.950976760e-03, -2.345489301e-03,
+        1.878763722e-03, -1.508555239e-03, 1.209467935e-03, -9.651976017e-04,
+        7.646555295e-04, -5.998907882e-04, 4.649159117e-04, -3.550168154e-04,
+        2.663362609e-04, -1.956184306e-04, 1.400513796e-04, -9.717012633e-05,
+        6.479753643e-05, -4.100850512e-05, 2.410799422e-05, -1.261668342e-05
+    },
+    {
+        -3.911999572e-06, 9.264745972e-06, -1.760360937e-05, 2.984463074e-05,
+        -4.705050670e-05, 7.043840224e-05, -1.013903469e-04, 1.414692078e-04,
+        -1.924447692e-04, 2.563367709e-04, -3.354854396e-04, 4.326661250e-04,
+        -5.512751641e-04, 6.956331039e-04, -8.714874575e-04, 1.086869299e-03,
+        -1.353611456e-03, 1.690187352e-03, -2.127409426e-03, 2.720994937e-03,
+        -3.583053247e-03, 4.976860878e-03, -7.698154021e-03, 1.578035615e-02,
+        9.995970803e-01, -1.528942597e-02, 7.573458467e-03, -4.920057420e-03,
+        3.550108536e-03, -2.699195100e-03, 2.111764812e-03, -1.678351401e-03,
+        1.344338304e-03, -1.079435834e-03, 8.654431620e-04, -6.906797813e-04,
+        5.472043535e-04, -4.293245181e-04, 3.327548886e-04, -2.541223527e-04,
+        1.906675088e-04, -1.400615958e-04, 1.002935749e-04, -6.960066917e-05,
+        4.642599013e-05, -2.939286335e-05, 1.728908854e-05, -9.056662907e-06
+    },
+    {
+        -2.332338211e-06, 5.535161305e-06, -1.052694696e-05, 1.785692441e-05,
+        -2.816231182e-05, 4.217299950e-05, -6.071777487e-05, 8.473388050e-05,
+        -1.152826168e-04, 1.535750916e-04, -2.010144205e-04, 2.592643185e-04,
+        -3.303603104e-04, 4.168911474e-04, -5.222995653e-04, 6.513946080e-04,
+        -8.112593869e-04, 1.012947835e-03, -1.274888877e-03, 1.630388016e-03,
+        -2.146407089e-03, 2.980011448e-03, -4.604928464e-03, 9.410242117e-03,
+        9.998549376e-01, -9.233489288e-03, 4.560028240e-03, -2.959557284e-03,
+        2.134544051e-03, -1.622538101e-03, 1.269255389e-03, -1.008685808e-03,
+        8.079202004e-04, -6.487178767e-04, 5.201230622e-04, -4.151074947e-04,
+        3.288944432e-04, -2.580610318e-04, 2.000311703e-04, -1.527776968e-04,
+        1.146426392e-04, -8.422701046e-05, 6.032283595e-05, -4.187133850e-05,
+        2.793742843e-05, -1.769424668e-05, 1.041369064e-05, -5.460232391e-06
+    },
+    {
+        -7.724074909e-07, 1.836941244e-06, -3.496817360e-06, 5.934956946e-06,
+        -9.363605457e-06, 1.402589220e-05, -2.019790075e-05, 2.819184599e-05,
+        -3.836125949e-05, 5.110954702e-05, -6.690401422e-05, 8.629866446e-05,
+        -1.099711616e-04, 1.387831227e-04, -1.738800607e-04, 2.168615939e-04,
+        -2.700829467e-04, 3.372182873e-04, -4.243903716e-04, 5.426581959e-04,
+        -7.142388445e-04, 9.911827586e-04, -1.530153294e-03, 3.117263855e-03,
+        9.999838813e-01, -3.097623654e-03, 1.525163835e-03, -9.889098005e-04,
+        7.129205657e-04, -5.417858735e-04, 4.237643493e-04, -3.367446686e-04,
+        2.697118786e-04, -2.165641413e-04, 1.736381961e-04, -1.385849137e-04,
+        1.098082666e-04, -8.616494883e-05, 6.679475021e-05, -5.102093625e-05,
+        3.829014176e-05, -2.813551989e-05, 2.015401303e-05, -1.399237003e-05,
+        9.338615224e-06, -5.916879337e-06, 3.484231724e-06, -1.828614753e-06
+    }
+};
+
+#endif // RESAMPLER_COEFFS_H
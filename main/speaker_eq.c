@@ -0,0 +1,216 @@
+// Speaker compensation: fixed-point EQ and psychoacoustic bass enhancer
+//
+// Bass enhancer, per chunk, with x the low band and e its peak envelope:
+//
+//   u = x / E                              (|u| <= 1, E = e at the chunk's end)
+//   h = e * (T2(u) + T3(u)) / 2            T2 = 2u^2 - 1, T3 = 4u^3 - 3u
+//
+// For a sine of amplitude e, T2 and T3 turn it into its 2nd and 3rd harmonic
+// at the same amplitude, so the harmonics follow the level of the bass
+// instead of growing with its square or cube. e ramps linearly over the chunk,
+// a step from one chunk to the next would show up as a buzz at the chunk rate
+// through the DC part of T2. u is normalised once per chunk instead: a Q57
+// reciprocal of E, one 64-bit division per chunk, and a multiply per sample.
+// E is never below the chunk's peak, so |u| <= 1 without clamping x; as the
+// envelope decays, u steps by the decay of one chunk (at most 1.4%).
+
+#include "speaker_eq.h"
+#include <math.h>
+#include <string.h>
+#include "dsp_math.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "synth.h"
+
+#define Q27_ONE (1 << 27)
+#define Q30_ONE (1 << 30)
+
+#define ENVELOPE_RELEASE_S 0.1f                      // Decay of the low band envelope
+#define ENVELOPE_FLOOR     (1 << 15)                 // Q27, about -72 dBFS, e never gets to 0
+#define SAMPLE_LIMIT       15.99f                    // Keeps Q27 samples within 32 bits
+
+bool speaker_eq_params_valid(const speaker_eq_params_t* params) {
+    return params->bass >= 0.0f && params->bass <= 1.0f;
+}
+
+void speaker_eq_reset(speaker_eq_t* eq) {
+    memset(eq, 0, sizeof(*eq));
+    eq->envelope = ENVELOPE_FLOOR;
+}
+
+// Helper function: Q56 accumulator to a saturated Q27 sample
+static inline int32_t to_sample(int64_t acc) {
+    acc >>= SPEAKER_EQ_COEFF_SHIFT;
+    if (acc > INT32_MAX) return INT32_MAX;
+    if (acc < INT32_MIN) return INT32_MIN;
+    return (int32_t)acc;
+}
+
+// Helper function: One biquad over 'count' interleaved stereo frames, both channels in one loop
+static void biquad_stereo(const int32_t* c, speaker_eq_biquad_t* state, int32_t* x, int count) {
+    const int32_t b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+    int64_t       l1 = state[0].s1, l2 = state[0].s2;
+    int64_t       r1 = state[1].s1, r2 = state[1].s2;
+    for (int i = 0; i < count; i++) {
+        const int32_t in_l  = x[i * 2];
+        const int32_t in_r  = x[i * 2 + 1];
+        const int32_t out_l = to_sample((int64_t)b0 * in_l + l1);
+        const int32_t out_r = to_sample((int64_t)b0 * in_r + r1);
+        l1                  = (int64_t)b1 * in_l - (int64_t)a1 * out_l + l2;
+        r1                  = (int64_t)b1 * in_r - (int64_t)a1 * out_r + r2;
+        l2                  = (int64_t)b2 * in_l - (int64_t)a2 * out_l;
+        r2                  = (int64_t)b2 * in_r - (int64_t)a2 * out_r;
+        x[i * 2]            = out_l;
+        x[i * 2 + 1]        = out_r;
+    }
+    state[0] = (speaker_eq_biquad_t){l1, l2};
+    state[1] = (speaker_eq_biquad_t){r1, r2};
+}
+
+// Helper function: One biquad over 'count' mono samples
+static void biquad_mono(const int32_t* c, speaker_eq_biquad_t* state, int32_t* x, int count) {
+    const int32_t b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+    int64_t       s1 = state->s1, s2 = state->s2;
+    for (int i = 0; i < count; i++) {
+        const int32_t in  = x[i];
+        const int32_t out = to_sample((int64_t)b0 * in + s1);
+        s1                = (int64_t)b1 * in - (int64_t)a1 * out + s2;
+        s2                = (int64_t)b2 * in - (int64_t)a2 * out;
+        x[i]              = out;
+    }
+    *state = (speaker_eq_biquad_t){s1, s2};
+}
+
+// Helper function: Harmonics of the low band of one chunk, left in eq->low
+static void bass_harmonics(speaker_eq_t* eq, int count) {
+    int32_t* low = eq->low;
+
+    // Low band of the mono mix and its peak
+    for (int i = 0; i < count; i++) low[i] = (int32_t)(((int64_t)eq->work[i * 2] + eq->work[i * 2 + 1]) >> 1);
+    biquad_mono(eq->coeffs[SPEAKER_EQ_SPLIT], &eq->split, low, count);
+    int32_t peak = ENVELOPE_FLOOR;
+    for (int i = 0; i < count; i++) {
+        int32_t magnitude = low[i] < 0 ? (low[i] == INT32_MIN ? INT32_MAX : -low[i]) : low[i];
+        if (magnitude > peak) peak = magnitude;
+    }
+
+    // Envelope at the end of the chunk: the peak, or the decayed envelope if that is higher
+    const float   decay = decay_factor((float)count / (eq->rate * ENVELOPE_RELEASE_S));
+    const int32_t start = eq->envelope;
+    int32_t       end   = (int32_t)((int64_t)start * (int32_t)(decay * Q30_ONE) >> 30);
+    if (end < peak) end = peak;
+    eq->envelope = end;
+
+    // u = x / end through its reciprocal, |x| <= end keeps x * reciprocal within 2^57; e ramps over the chunk
+    const int64_t reciprocal    = ((int64_t)1 << 57) / end;
+    const int32_t envelope_step = (end - start) / count;
+    int32_t       envelope      = start;
+    for (int i = 0; i < count; i++) {
+        int64_t u = ((int64_t)low[i] * reciprocal) >> 27;
+        if (u > Q30_ONE) u = Q30_ONE;  // Only INT32_MIN gets past the peak
+        if (u < -Q30_ONE) u = -Q30_ONE;
+        const int64_t u2 = (u * u) >> 30;
+        const int64_t u3 = (u2 * u) >> 30;
+
+        // (T2 + T3) / 2 = u^2 - 1/2 + 2u^3 - 3u/2, within +/-1
+        const int64_t h  = u2 - Q30_ONE / 2 + 2 * u3 - ((3 * u) >> 1);
+        low[i]           = (int32_t)((h * envelope) >> 30);
+        envelope        += envelope_step;
+    }
+
+    // Keep the harmonics where the speaker plays well (this also removes the DC of T2)
+    biquad_mono(eq->coeffs[SPEAKER_EQ_HARM_HP], &eq->harm_hp, low, count);
+    biquad_mono(eq->coeffs[SPEAKER_EQ_HARM_LP], &eq->harm_lp, low, count);
+}
+
+void speaker_eq_process(speaker_eq_t* eq, const speaker_eq_params_t* params, uint32_t rate, float* buffer,
+                        int frames) {
+    if (rate != eq->rate) {
+        // New output rate: other coefficients, and histories that belong to the old rate
+        speaker_eq_reset(eq);
+        eq->rate = rate;
+        for (int i = 0; i < SPEAKER_EQ_RATES; i++) {
+            if (speaker_eq_rates[i] == rate) eq->coeffs = speaker_eq_coeffs[i];
+        }
+    }
+    if (eq->coeffs == NULL) return;
+
+    const int32_t mix_target  = params->eq ? Q30_ONE : 0;
+    const int32_t bass_target = (int32_t)(params->bass * Q30_ONE);
+    if (eq->eq_mix == 0 && mix_target == 0 && eq->bass == 0 && bass_target == 0) return;
+
+    // Coming out of bypass: start from silent histories rather than whatever was there last time
+    if (eq->eq_mix == 0 && mix_target != 0) memset(eq->eq, 0, sizeof(eq->eq));
+    if (eq->bass == 0 && bass_target != 0) {
+        eq->split    = (speaker_eq_biquad_t){0};
+        eq->harm_hp  = (speaker_eq_biquad_t){0};
+        eq->harm_lp  = (speaker_eq_biquad_t){0};
+        eq->envelope = ENVELOPE_FLOOR;
+    }
+
+    for (int done = 0; done < frames; done += SPEAKER_EQ_CHUNK) {
+        const int count = frames - done < SPEAKER_EQ_CHUNK ? frames - done : SPEAKER_EQ_CHUNK;
+        float*    chunk = buffer + done * 2;
+
+        for (int i = 0; i < count * 2; i++) {
+            eq->work[i] = (int32_t)(fminf(fmaxf(chunk[i], -SAMPLE_LIMIT), SAMPLE_LIMIT) * Q27_ONE);
+        }
+
+        // Harmonics from the input, before the EQ's high-pass takes the low band away
+        const bool bass = eq->bass != 0 || bass_target != 0;
+        if (bass) bass_harmonics(eq, count);
+
+        // EQ, blended with the dry input while it fades in or out
+        const bool equalise = eq->eq_mix != 0 || mix_target != 0;
+        if (equalise) {
+            for (int section = 0; section < SPEAKER_EQ_SECTIONS; section++) {
+                biquad_stereo(eq->coeffs[section], eq->eq[section], eq->work, count);
+            }
+        }
+        const float scale    = 1.0f / Q27_ONE;
+        float       mix      = (float)eq->eq_mix / Q30_ONE;
+        float       mix_step = ((float)mix_target / Q30_ONE - mix) / count;
+        float       level    = (float)eq->bass / Q30_ONE;
+        float       step     = ((float)bass_target / Q30_ONE - level) / count;
+        for (int i = 0; i < count; i++) {
+            float harmonics = bass ? eq->low[i] * scale * level : 0.0f;
+            if (equalise) {
+                chunk[i * 2]     += mix * (eq->work[i * 2] * scale - chunk[i * 2]);
+                chunk[i * 2 + 1] += mix * (eq->work[i * 2 + 1] * scale - chunk[i * 2 + 1]);
+            }
+            chunk[i * 2]     += harmonics;
+            chunk[i * 2 + 1] += harmonics;
+            mix              += mix_step;
+            level            += step;
+        }
+        eq->eq_mix = mix_target;
+        eq->bass   = bass_target;
+    }
+}
+
+uint32_t speaker_eq_bench(int blocks) {
+    static float              source[FRAMES_PER_WRITE * 2];
+    static float              buffer[FRAMES_PER_WRITE * 2];
+    const speaker_eq_params_t params = {.eq = true, .bass = 0.5f};
+
+    // Internal RAM like the real state in the fast arena, freed again after the run
+    speaker_eq_t* eq = heap_caps_malloc(sizeof(speaker_eq_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (eq == NULL) return 0;
+    speaker_eq_reset(eq);
+
+    for (int i = 0; i < FRAMES_PER_WRITE; i++) {
+        // The lowest key, labelled C1 on the keyboard (middle C, C4 in scientific pitch), in the low band
+        source[i * 2]     = 0.5f * lfo_sine(i * 261.63f / SAMPLE_RATE);
+        source[i * 2 + 1] = source[i * 2];
+    }
+
+    // Works in place, so every block starts from a fresh copy (the EQ's boost would build up otherwise)
+    int64_t start = esp_timer_get_time();
+    for (int block = 0; block < blocks; block++) {
+        memcpy(buffer, source, sizeof(buffer));
+        speaker_eq_process(eq, &params, SAMPLE_RATE, buffer, FRAMES_PER_WRITE);
+    }
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    heap_caps_free(eq);
+    return elapsed;
+}
@@ -0,0 +1,71 @@
+// Speaker compensation: fixed-point EQ and psychoacoustic bass enhancer
+//
+// The Tanmatsu's small speaker hardly reproduces the fundamentals of the
+// lowest notes (the key labelled C1 is middle C, 261.63 Hz). Two things run
+// on the output block, at the output rate, after the resampler:
+//
+//   EQ    a cascade of SPEAKER_EQ_SECTIONS biquads: high-pass below what the
+//         speaker plays, low-mid lift, presence cut, air
+//   bass  the low band of the mix drives a Chebyshev harmonic generator; the
+//         2nd and 3rd harmonics of its fundamentals, band limited to where
+//         the speaker plays well, go into both channels, and the ear fills in
+//         the fundamental the speaker cannot play
+//
+// Everything runs in fixed point, bit-exact on the P4 and the host: samples
+// in Q27 (+/-16 of headroom), coefficients in Q29 from speaker_eq_coeffs.h
+// (generate_speaker_eq.pl, one table per output rate), biquads in direct form
+// II transposed with 64-bit state. Each pass runs one filter over a whole
+// chunk with both channels side by side in the loop body, so its coefficients
+// stay in registers.
+
+#ifndef SPEAKER_EQ_H
+#define SPEAKER_EQ_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "speaker_eq_coeffs.h"
+
+#define SPEAKER_EQ_CHUNK 64  // Frames per pass, longer blocks are cut into chunks
+
+// Settings, any value in range may change at any time
+typedef struct {
+    bool  eq;    // Compensation EQ on (crossfades in and out over one chunk)
+    float bass;  // Level of the synthesised harmonics, 0 (off) .. 1
+} speaker_eq_params_t;
+
+// Direct form II transposed state, Q56 (Q27 samples times Q29 coefficients)
+typedef struct {
+    int64_t s1;
+    int64_t s2;
+} speaker_eq_biquad_t;
+
+// State, about 1 KB; lives in the fast DSP arena
+typedef struct {
+    int32_t             work[SPEAKER_EQ_CHUNK * 2];    // Chunk in Q27, interleaved stereo
+    int32_t             low[SPEAKER_EQ_CHUNK];         // Low band, then its harmonics (mono, Q27)
+    speaker_eq_biquad_t eq[SPEAKER_EQ_SECTIONS][2];    // Per section and channel
+    speaker_eq_biquad_t split;                         // Bass enhancer filters (mono)
+    speaker_eq_biquad_t harm_hp;
+    speaker_eq_biquad_t harm_lp;
+    const int32_t (*coeffs)[5];                        // Table of the rate below, NULL before the first block
+    uint32_t            rate;
+    int32_t             envelope;                      // Peak follower of the low band, Q27
+    int32_t             eq_mix;                        // Share of the EQ in the output reached, Q30
+    int32_t             bass;                          // Harmonics level reached, Q30
+} speaker_eq_t;
+
+// Check that all settings are in range
+bool speaker_eq_params_valid(const speaker_eq_params_t* params);
+
+// Clear all filters, bypassed
+void speaker_eq_reset(speaker_eq_t* eq);
+
+// Process 'frames' interleaved stereo frames at output rate 'rate' in place
+// A rate without a coefficient table passes the block through unchanged
+void speaker_eq_process(speaker_eq_t* eq, const speaker_eq_params_t* params, uint32_t rate, float* buffer,
+                        int frames);
+
+// Benchmark: time 'blocks' blocks of FRAMES_PER_WRITE frames with EQ and bass on, returns microseconds
+uint32_t speaker_eq_bench(int blocks);
+
+#endif  // SPEAKER_EQ_H
@@ -0,0 +1,49 @@
+// Auto-generated speaker EQ and bass enhancer filters for musical keyboard
+// RBJ cookbook biquads, (b0, b1, b2, a1, a2) with a0 = 1, in Q29 fixed point
+// highpass    200 Hz, Q 0.707, +0 dB
+// peaking     500 Hz, Q 1.000, +4 dB
+// peaking    3000 Hz, Q 1.400, -3 dB
+// highshelf  8000 Hz, Q 0.707, +2 dB
+// lowpass     400 Hz, Q 0.707, +0 dB
+// highpass    450 Hz, Q 0.707, +0 dB
+// lowpass    2000 Hz, Q 0.707, +0 dB
+//
+// Generated by generate_speaker_eq.pl
+
+#ifndef SPEAKER_EQ_COEFFS_H
+#define SPEAKER_EQ_COEFFS_H
+
+#include <stdint.h>
+
+#define SPEAKER_EQ_RATES        2
+#define SPEAKER_EQ_SECTIONS     4  // Filters 0 .. SECTIONS - 1 are the EQ cascade
+#define SPEAKER_EQ_SPLIT        4  // Bass enhancer: low band lowpass
+#define SPEAKER_EQ_HARM_HP      5  // ... harmonics highpass
+#define SPEAKER_EQ_HARM_LP      6  // ... harmonics lowpass
+#define SPEAKER_EQ_FILTERS      7
+#define SPEAKER_EQ_COEFF_SHIFT  29
+
+static const uint32_t speaker_eq_rates[SPEAKER_EQ_RATES] = {44100, 48000};
+
+static const int32_t speaker_eq_coeffs[SPEAKER_EQ_RATES][SPEAKER_EQ_FILTERS][5] = {
+    {   // 44100 Hz
+        {526160104, -1052320208, 526160104, -1052106564, 515662939},
+        {545503748, -1041573953, 498718716, -1041573953, 507351553},
+        {513410146, -830936203, 399671331, -830936203, 376210565},
+        {620271987, -354004633, 142468699, -239163142, 111028283},
+        {418932, 837864, 418932, -1030487932, 495292748},
+        {513071434, -1026142867, 513071434, -1025087623, 490327200},
+        {9029486, 18058973, 9029486, -859558407, 358805441}
+    },
+    {   // 48000 Hz
+        {527022323, -1054044646, 527022323, -1053864018, 517354363},
+        {544821109, -1044315943, 501735593, -1044315943, 509685789},
+        {514960728, -853387459, 408739201, -853387459, 386829017},
+        {624264112, -424372021, 158824808, -300201709, 122047696},
+        {354751, 709502, 354751, -1033999197, 498547290},
+        {514965161, -1029930323, 514965161, -1029036397, 493953336},
+        {7731534, 15463068, 7731534, -876686044, 370741267}
+    }
+};
+
+#endif // SPEAKER_EQ_COEFFS_H
@@ -0,0 +1,1320 @@
+// Synthesizer engine: voice allocation, ADSR envelopes and the audio mixing task
+
+#include "synth.h"
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dsp_arena.h"
+#include "dsp_math.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "granular.h"
+#include "keyboard_notes.h"
+#include "keyboard_waveform.h"
+#include "modal.h"
+#include "output_stage.h"
+#include "pcm_capture.h"
+#include "resampler.h"
+#include "speaker_eq.h"
+#include "trace.h"
+#include "wavetable.h"
+
+// ADSR envelope states
+typedef enum {
+    ADSR_IDLE = 0,      // Note not playing
+    ADSR_ATTACK,        // Ramping up from 0% to 100%
+    ADSR_DECAY,         // Ramping down from 100% to sustain level
+    ADSR_SUSTAIN,       // Holding at sustain level while key pressed
+    ADSR_RELEASE,       // Ramping down to 0% after key release
+    ADSR_STEAL          // Fast fade out of a voice stolen by load shedding
+} adsr_state_t;
+
+// Fade time for stolen voices, short but long enough to avoid a click
+#define STEAL_FADE_SAMPLES (SAMPLE_RATE * 3 / 1000)
+
+// Audio data structure for active notes
+typedef struct {
+    int note_index;             // Which note (0-12), or -1 if inactive
+    float playback_position;    // Fractional sample position in waveform
+    float playback_speed;       // Speed multiplier (frequency / base_freq)
+    adsr_state_t adsr_state;    // Current ADSR envelope state
+    uint32_t adsr_timer;        // Sample counter for ADSR timing
+    float adsr_level;           // Current envelope level (0.0 to 1.0)
+    bool key_held;              // Is the key currently pressed?
+    int64_t note_on_time;       // esp_timer time the note was asked for, 0 once measured
+    float steal_step;           // Level decrement per sample while in ADSR_STEAL
+    bool struck;                // Started or restarted since the modal engine last struck the voice
+} active_note_t;
+
+static i2s_chan_handle_t i2s_handle = NULL;
+static TaskHandle_t audio_task_handle = NULL;
+static active_note_t active_notes[MAX_ACTIVE_NOTES];
+static float current_normalization = 1.0f;  // Smoothed normalization factor
+static float normalization_table[MAX_ACTIVE_NOTES + 1];  // 1 / sqrt(active voices)
+
+// Block buffers live outside the 4096 byte audio task stack, in the fast DSP arena
+static float*   mix_buffer      = NULL;  // Stereo float mix: 2 channels per frame
+static float*   resample_buffer = NULL;  // Mix converted to 48 kHz
+static int32_t* output_buffer   = NULL;  // I2S samples, int16_t or int32_t depending on format
+
+// Mixer scratch: the voices are rendered one after the other into voice_buffer (mono), run
+// through the voice inserts and summed into the mono dry and send sums before normalisation
+static float*   voice_buffer = NULL;
+static float*   dry_sum      = NULL;
+static float*   send_sum[2]  = {NULL, NULL};
+static uint8_t* voice_counts = NULL;  // Voices sounding in each frame
+
+// Runtime tunables (written by the console on core 0, read once per block on core 1)
+static volatile int            block_frames  = FRAMES_PER_WRITE;
+static volatile int            polyphony     = MAX_ACTIVE_NOTES;
+static volatile synth_interp_t interpolation = SYNTH_INTERP_LINEAR;
+static volatile bool           shed_enabled  = true;
+static volatile float          master_gain   = 1.0f;
+
+// Output format requested by the console and the one the I2S channel is configured for
+static volatile output_format_t output_format = OUTPUT_FORMAT_16;
+static output_format_t          active_format = OUTPUT_FORMAT_16;
+
+// Output sample rate requested by the console and the one the I2S clock runs at
+// The mixer always renders at SAMPLE_RATE, at 48 kHz the resampler converts each block
+static volatile uint32_t output_rate = SAMPLE_RATE;
+static uint32_t          active_rate = SAMPLE_RATE;
+static resampler_t*      resampler = NULL;  // In the fast DSP arena
+
+// Speaker compensation on the output block, at the output rate
+static volatile bool  speaker_eq_on = false;
+static volatile float speaker_bass  = 0.0f;
+static speaker_eq_t*  speaker_eq    = NULL;  // In the fast DSP arena
+
+// Effect and engine settings; the console writes them under a seqlock, the audio task picks them up
+// at the start of a block if no write is in progress and keeps the previous ones otherwise
+static fx_settings_t     effect_request;          // Written by the synth_set_ effect functions
+static granular_params_t granular_request;        // Written by synth_set_granular()
+static modal_params_t    modal_request;           // Written by synth_set_modal()
+static atomic_uint       effect_request_seq = 0;
+static fx_settings_t     effect_settings;         // Settings in use (audio task)
+static fx_settings_t     effect_block;            // ... as the schedule's steps read them, after load shedding
+static granular_params_t granular_settings;       // (audio task)
+static modal_params_t    modal_settings;          // (audio task)
+
+// Sound engine of all voices, requested by the console and the one the audio task renders with
+static volatile synth_engine_t engine        = SYNTH_ENGINE_WAVE;
+static synth_engine_t          active_engine = SYNTH_ENGINE_WAVE;
+
+// Effects graph: the console compiles a patch into the schedule the audio task is not using and
+// swaps the pointer, the audio task picks it up at the start of a block
+static fx_patch_t                    fx_patch;                 // Patch of the latest schedule (console)
+static fx_schedule_t                 fx_schedules[2];
+static const fx_schedule_t* volatile fx_schedule     = NULL;
+static const fx_schedule_t* volatile fx_schedule_run = NULL;  // Schedule in use (written by the audio task)
+
+// Load shedding state (owned by the audio task)
+static volatile synth_shed_level_t shed_level = SYNTH_SHED_NONE;
+static float                       shed_load  = 0.0f;  // Fast moving load average
+static uint32_t                    shed_calm  = 0;     // Microseconds of calm audio since the last change
+
+// Activity published for visualisation, written once per block by the audio task
+// The snapshot is guarded by a seqlock: the audio task bumps the sequence number to odd, copies,
+// and bumps it to even again, so it never waits; readers retry if the number was odd or moved
+#define ENVELOPE_RELEASE_MS 150  // Envelope follower decay time constant
+static synth_snapshot_t snapshot;
+static atomic_uint      snapshot_seq = 0;
+static float            mix_envelope = 0.0f;  // Peak follower of the mix (audio task)
+
+// User wavetable played instead of the compiled-in waveform_data (NULL = built-in)
+// Swapped by the wavetable loader on core 0, read once per block by the audio task
+#define WAVETABLE_SCALE ((float)WAVETABLE_LENGTH / WAVEFORM_CYCLE_LENGTH)  // Voice position to table position
+static const wavetable_t* volatile wavetable     = NULL;
+static const wavetable_t* volatile wavetable_run = NULL;  // Table of the block being rendered (audio task)
+static volatile uint32_t           block_count   = 0;     // Blocks rendered since start, never reset
+
+// Morph bank played instead of both (NULL = none) and its position control
+// The position is in 0.0 .. 1.0 over the whole bank, the LFO swings it by +/- depth
+static const wavetable_bank_t* volatile wavetable_bank  = NULL;
+static const wavetable_bank_t* volatile bank_run        = NULL;  // Bank of the block being rendered (audio task)
+static volatile float                   morph_position  = 0.0f;
+static volatile float                   morph_lfo_rate  = 0.0f;  // Hz
+static volatile float                   morph_lfo_depth = 0.0f;
+static float                            morph_frame     = 0.0f;  // Rendered position in frames (audio task)
+static float                            morph_lfo_phase = 0.0f;  // 0.0 .. 1.0 (audio task)
+
+// Within a block the position moves linearly and may cross several frames; each pair of frames it
+// passes is one span of the block. Beyond MORPH_MAX_SLEW frames per block the position slews, so a
+// jump across a 64-frame bank takes 8 blocks. The position advances once per audio block, however
+// many segments scheduled events split the block into.
+#define MORPH_MAX_SLEW  8.0f  // Frames per audio block
+#define MORPH_MAX_SPANS 10    // MORPH_MAX_SLEW + 1 pairs, and one for rounding
+
+typedef struct {
+    int   pair;    // Lower frame of the pair crossfaded
+    int   frames;  // Samples of the block in this pair
+    float weight;  // Weight of the upper frame at the first sample
+} morph_span_t;
+
+typedef struct {
+    morph_span_t spans[MORPH_MAX_SPANS];
+    int          count;
+    float        weight_step;  // Change of the weight per sample, in every span
+} morph_block_t;
+
+// Note events, passed from other tasks to the audio task through lock-free rings of one producer
+// each: the key and console notes, played at the start of the next block, and the events scheduled
+// ahead of time, which the audio task moves into 'pending', sorted latest first
+#define SCHEDULE_QUEUE_LENGTH  64    // Must be a power of two
+#define RENDER_CLOCK_RESYNC_US 2000  // Render clock error that is corrected in one step, not followed
+
+typedef struct {
+    int64_t time_us;     // esp_timer time the event is due (scheduled) or was sent (played now)
+    int     note_index;
+    bool    on;
+} scheduled_event_t;
+
+typedef struct {
+    scheduled_event_t events[SCHEDULE_QUEUE_LENGTH];
+    atomic_uint       head;     // Next slot the producer writes
+    atomic_uint       tail;     // Next slot the audio task reads
+    volatile uint32_t dropped;  // Events refused because the ring was full
+} event_ring_t;
+
+static event_ring_t      note_rings[SYNTH_SOURCE_COUNT];
+static event_ring_t      schedule_ring;
+static scheduled_event_t pending[SCHEDULE_QUEUE_LENGTH];  // (audio task)
+static int               pending_count   = 0;
+static int64_t           render_clock_us = 0;  // esp_timer time of the next frame to mix (audio task)
+
+// Statistics
+static synth_stats_t     stats;
+static volatile uint32_t underrun_count = 0;  // Incremented from the I2S ISR
+
+static const char* const interp_names[SYNTH_INTERP_COUNT] = {
+    [SYNTH_INTERP_NEAREST] = "nearest",
+    [SYNTH_INTERP_LINEAR]  = "linear",
+    [SYNTH_INTERP_CUBIC]   = "cubic",
+};
+
+static const char* const engine_names[SYNTH_ENGINE_COUNT] = {
+    [SYNTH_ENGINE_WAVE]     = "wave",
+    [SYNTH_ENGINE_GRANULAR] = "grain",
+    [SYNTH_ENGINE_MODAL]    = "modal",
+};
+
+static const char* const shed_names[SYNTH_SHED_COUNT] = {
+    [SYNTH_SHED_NONE]     = "none",
+    [SYNTH_SHED_INTERP]   = "interp",
+    [SYNTH_SHED_NO_TAILS] = "no-tails",
+    [SYNTH_SHED_STEAL]    = "steal",
+};
+
+// Helper function: Get interpolated sample from waveform
+static inline float get_waveform_sample(float position, synth_interp_t mode) {
+    // Get integer and fractional parts
+    int pos_int = (int)position;
+    float pos_frac = position - pos_int;
+
+    // Wrap around the waveform cycle
+    pos_int = pos_int % WAVEFORM_CYCLE_LENGTH;
+    int next_pos = (pos_int + 1) % WAVEFORM_CYCLE_LENGTH;
+
+    switch (mode) {
+        case SYNTH_INTERP_NEAREST:
+            return waveform_data[pos_int] / 32768.0f;
+
+        case SYNTH_INTERP_CUBIC: {
+            // Catmull-Rom spline through the two neighbouring samples on each side
+            int   prev_pos = (pos_int + WAVEFORM_CYCLE_LENGTH - 1) % WAVEFORM_CYCLE_LENGTH;
+            int   next2    = (pos_int + 2) % WAVEFORM_CYCLE_LENGTH;
+            float y0       = waveform_data[prev_pos] / 32768.0f;
+            float y1       = waveform_data[pos_int] / 32768.0f;
+            float y2       = waveform_data[next_pos] / 32768.0f;
+            float y3       = waveform_data[next2] / 32768.0f;
+            float c1       = 0.5f * (y2 - y0);
+            float c2       = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
+            float c3       = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
+            return ((c3 * pos_frac + c2) * pos_frac + c1) * pos_frac + y1;
+        }
+
+        case SYNTH_INTERP_LINEAR:
+        default: {
+            // Linear interpolation
+            float sample1 = waveform_data[pos_int] / 32768.0f;
+            float sample2 = waveform_data[next_pos] / 32768.0f;
+            return sample1 + (sample2 - sample1) * pos_frac;
+        }
+    }
+}
+
+// Helper function: Get interpolated sample from one mip level of a user wavetable
+// Same interpolation as get_waveform_sample, the power-of-two length wraps with a mask
+static inline float get_wavetable_sample(const int16_t* data, float position, synth_interp_t mode) {
+    const int mask     = WAVETABLE_LENGTH - 1;
+    int       pos_int  = (int)position;
+    float     pos_frac = position - pos_int;
+    pos_int &= mask;
+
+    switch (mode) {
+        case SYNTH_INTERP_NEAREST:
+            return data[pos_int] / 32768.0f;
+
+        case SYNTH_INTERP_CUBIC: {
+            float y0 = data[(pos_int - 1) & mask] / 32768.0f;
+            float y1 = data[pos_int] / 32768.0f;
+            float y2 = data[(pos_int + 1) & mask] / 32768.0f;
+            float y3 = data[(pos_int + 2) & mask] / 32768.0f;
+            float c1 = 0.5f * (y2 - y0);
+            float c2 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
+            float c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
+            return ((c3 * pos_frac + c2) * pos_frac + c1) * pos_frac + y1;
+        }
+
+        case SYNTH_INTERP_LINEAR:
+        default: {
+            float sample1 = data[pos_int] / 32768.0f;
+            float sample2 = data[(pos_int + 1) & mask] / 32768.0f;
+            return sample1 + (sample2 - sample1) * pos_frac;
+        }
+    }
+}
+
+// Helper function: Advance the morph position by one block of 'frames' samples
+// Fills 'spans' with the pairs of frames the position passes, in order, and returns how many;
+// the weight of the upper frame changes by 'weight_step' per sample in all of them. At a frame
+// boundary one pair ends on weight 1 where the next starts on 0, so the crossfade stays continuous.
+static int update_morph(int bank_frames, int frames, morph_span_t* spans, float* weight_step) {
+    morph_lfo_phase += morph_lfo_rate * frames / SAMPLE_RATE;  // Less than one turn per block
+    if (morph_lfo_phase >= 1.0f) morph_lfo_phase -= 1.0f;
+    float target = morph_position + morph_lfo_depth * lfo_sine(morph_lfo_phase);
+    target       = fminf(fmaxf(target, 0.0f), 1.0f) * (bank_frames - 1);
+
+    float start = fminf(morph_frame, (float)(bank_frames - 1));
+    float end   = fminf(fmaxf(target, start - MORPH_MAX_SLEW), start + MORPH_MAX_SLEW);
+    float step  = (end - start) / frames;
+
+    int   count    = 0;
+    float position = start;
+    for (int frame = 0; frame < frames; frame++, position += step) {
+        int pair = (int)position;
+        if (step < 0.0f && pair == position && pair > 0) pair--;  // On a frame, moving down: take the pair below
+        if (pair > bank_frames - 2) pair = bank_frames - 2;
+        if (count == 0 || (spans[count - 1].pair != pair && count < MORPH_MAX_SPANS)) {
+            spans[count++] = (morph_span_t){.pair = pair, .frames = 0, .weight = position - pair};
+        }
+        spans[count - 1].frames++;
+    }
+    *weight_step = step;
+    morph_frame  = end;
+    return count;
+}
+
+// Helper function: Cut the spans of a block down to the segment of 'frames' frames from frame 'offset' on
+// Returns how many spans of the segment it filled in 'spans', with the weights they start the segment on
+static int morph_segment(const morph_block_t* morph, int offset, int frames, morph_span_t* spans) {
+    int count = 0;
+    int at    = 0;  // First frame of the block span
+    for (int span = 0; span < morph->count && at < offset + frames; at += morph->spans[span].frames, span++) {
+        int first = offset > at ? offset - at : 0;
+        int last  = offset + frames < at + morph->spans[span].frames ? offset + frames - at : morph->spans[span].frames;
+        if (first >= last) continue;
+        spans[count++] = (morph_span_t){.pair   = morph->spans[span].pair,
+                                        .frames = last - first,
+                                        .weight = morph->spans[span].weight + morph->weight_step * first};
+    }
+    return count;
+}
+
+// Helper function: Update ADSR envelope for a note
+static inline void update_adsr(active_note_t* note) {
+    switch (note->adsr_state) {
+        case ADSR_IDLE:
+            note->adsr_level = 0.0f;
+            break;
+
+        case ADSR_ATTACK:
+            note->adsr_timer++;
+            note->adsr_level = (float)note->adsr_timer / ADSR_ATTACK_SAMPLES;
+            if (note->adsr_timer >= ADSR_ATTACK_SAMPLES) {
+                note->adsr_state = ADSR_DECAY;
+                note->adsr_timer = 0;
+                note->adsr_level = 1.0f;
+            }
+            break;
+
+        case ADSR_DECAY:
+            note->adsr_timer++;
+            float decay_progress = (float)note->adsr_timer / ADSR_DECAY_SAMPLES;
+            note->adsr_level = 1.0f - (1.0f - ADSR_SUSTAIN_LEVEL) * decay_progress;
+            if (note->adsr_timer >= ADSR_DECAY_SAMPLES) {
+                note->adsr_state = ADSR_SUSTAIN;
+                note->adsr_level = ADSR_SUSTAIN_LEVEL;
+            }
+            break;
+
+        case ADSR_SUSTAIN:
+            note->adsr_level = ADSR_SUSTAIN_LEVEL;
+            // Check if key was released
+            if (!note->key_held) {
+                note->adsr_state = ADSR_RELEASE;
+                note->adsr_timer = 0;
+            }
+            break;
+
+        case ADSR_RELEASE:
+            note->adsr_timer++;
+            float release_progress = (float)note->adsr_timer / ADSR_RELEASE_SAMPLES;
+            note->adsr_level = ADSR_SUSTAIN_LEVEL * (1.0f - release_progress);
+            if (note->adsr_timer >= ADSR_RELEASE_SAMPLES) {
+                note->adsr_state = ADSR_IDLE;
+                note->adsr_level = 0.0f;
+                note->note_index = -1;  // Mark slot as free
+            }
+            break;
+
+        case ADSR_STEAL:
+            note->adsr_level -= note->steal_step;
+            if (note->adsr_level <= 0.0f) {
+                note->adsr_state = ADSR_IDLE;
+                note->adsr_level = 0.0f;
+                note->note_index = -1;  // Mark slot as free
+            }
+            break;
+    }
+}
+
+// Helper function: Fade out the quietest sounding voice, returns false if none is left to steal
+static bool steal_quietest_voice(void) {
+    int   victim = -1;
+    float lowest = 2.0f;
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        const active_note_t* note = &active_notes[i];
+        if (note->adsr_state == ADSR_IDLE || note->adsr_state == ADSR_STEAL) continue;
+        // Released notes are already on their way out, prefer them
+        float level = note->key_held ? note->adsr_level : note->adsr_level * 0.5f;
+        if (level < lowest) {
+            lowest = level;
+            victim = i;
+        }
+    }
+    if (victim < 0) return false;
+
+    active_notes[victim].steal_step = fmaxf(active_notes[victim].adsr_level, 0.001f) / STEAL_FADE_SAMPLES;
+    active_notes[victim].adsr_state = ADSR_STEAL;
+    return true;
+}
+
+// Helper function: Adjust the load shedding level from the last block's compute time
+// Escalates quickly (one level per overloaded block) and recovers slowly with hysteresis
+static void update_load_shedding(uint32_t block_us, float load, int active_voices) {
+    shed_load += 0.25f * (load - shed_load);
+
+    if (!shed_enabled) {
+        shed_level       = SYNTH_SHED_NONE;
+        shed_calm        = 0;
+        stats.shed_level = shed_level;
+        return;
+    }
+
+    if (load > SHED_LOAD_CRITICAL || shed_load > SHED_LOAD_HIGH) {
+        shed_calm = 0;
+        if (shed_level < SYNTH_SHED_STEAL) {
+            shed_level = shed_level + 1;
+            stats.shed_events++;
+        } else if (active_voices > 1 && steal_quietest_voice()) {
+            stats.voices_stolen++;
+        }
+    } else if (shed_load < SHED_LOAD_LOW && shed_level > SYNTH_SHED_NONE) {
+        shed_calm += block_us;
+        if (shed_calm >= SHED_RECOVER_MS * 1000) {
+            shed_level = shed_level - 1;
+            shed_calm  = 0;
+        }
+    } else {
+        shed_calm = 0;
+    }
+    stats.shed_level = shed_level;
+}
+
+// Helper function: Interpolation mode after applying the load shedding cap
+static inline synth_interp_t effective_interpolation(void) {
+    synth_interp_t mode = interpolation;
+    if (shed_level >= SYNTH_SHED_NO_TAILS) return SYNTH_INTERP_NEAREST;
+    if (shed_level >= SYNTH_SHED_INTERP && mode > SYNTH_INTERP_LINEAR) return SYNTH_INTERP_LINEAR;
+    return mode;
+}
+
+// I2S callback: the DMA finished a buffer and found no new data queued
+static IRAM_ATTR bool on_send_queue_overflow(i2s_chan_handle_t handle, i2s_event_data_t* event, void* user_ctx) {
+    underrun_count++;
+    return false;
+}
+
+// Helper function: Fold one block's timing into the statistics
+static float update_stats(int frames, int64_t block_start, int64_t block_end, int active_voices) {
+    uint32_t block_us    = (uint32_t)(block_end - block_start);
+    uint32_t deadline_us = (uint32_t)((int64_t)frames * 1000000 / active_rate);
+    float    load        = (float)block_us / (float)deadline_us;
+
+    stats.blocks++;
+    stats.underruns     = underrun_count;
+    stats.block_us_last = block_us;
+    stats.deadline_us   = deadline_us;
+    stats.active_voices = active_voices;
+    if (block_us > stats.block_us_max) stats.block_us_max = block_us;
+    if (load > stats.load_peak) stats.load_peak = load;
+    stats.load_avg += 0.01f * (load - stats.load_avg);
+
+    // Note-on latency: from the key press (or the scheduled start) to the end of the first block with the note
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        int64_t note_on_time = active_notes[i].note_on_time;
+        if (note_on_time == 0 || active_notes[i].adsr_state == ADSR_IDLE) continue;
+        active_notes[i].note_on_time = 0;
+
+        uint32_t latency_us = (uint32_t)(block_end - note_on_time);
+        if (stats.latency_count == 0 || latency_us < stats.latency_us_min) stats.latency_us_min = latency_us;
+        if (latency_us > stats.latency_us_max) stats.latency_us_max = latency_us;
+        stats.latency_us_avg = (stats.latency_us_avg * stats.latency_count + latency_us) / (stats.latency_count + 1);
+        stats.latency_count++;
+    }
+    return load;
+}
+
+// Helper function: Publish what one block played for the UI and the LEDs
+static void publish_snapshot(const float* mix, int frames, int voices, float load) {
+    synth_snapshot_t next = {.block = block_count, .active_voices = voices, .load = load};
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        const active_note_t* note = &active_notes[i];
+        if (note->adsr_state == ADSR_IDLE || note->note_index < 0) continue;
+        if (next.note_state[note->note_index] != SYNTH_NOTE_IDLE &&
+            note->adsr_level <= next.note_level[note->note_index]) {
+            continue;  // A retriggered note still fading out on another voice, the louder voice wins
+        }
+        next.note_level[note->note_index] = note->adsr_level;
+        next.note_state[note->note_index] = note->adsr_state == ADSR_STEAL ? SYNTH_NOTE_STOLEN
+                                            : note->key_held                ? SYNTH_NOTE_HELD
+                                                                            : SYNTH_NOTE_RELEASED;
+    }
+
+    // Peak meters, and a peak follower that jumps up to new peaks and decays exponentially
+    for (int i = 0; i < frames; i++) {
+        next.peak[0] = fmaxf(next.peak[0], fabsf(mix[i * 2]));
+        next.peak[1] = fmaxf(next.peak[1], fabsf(mix[i * 2 + 1]));
+    }
+    float peak = fmaxf(next.peak[0], next.peak[1]);
+    if (peak > mix_envelope) {
+        mix_envelope = peak;
+    } else {
+        mix_envelope *= decay_factor((float)frames * 1000.0f / (SAMPLE_RATE * (float)ENVELOPE_RELEASE_MS));
+    }
+    next.envelope = fminf(mix_envelope, 1.0f);
+
+    unsigned seq = atomic_load_explicit(&snapshot_seq, memory_order_relaxed);
+    atomic_store_explicit(&snapshot_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(&snapshot, &next, sizeof(snapshot));
+    atomic_store_explicit(&snapshot_seq, seq + 2, memory_order_release);
+}
+
+// Helper function: Pick up new effect and engine settings, unless the console is writing them right now
+static void take_effect_settings(void) {
+    unsigned before = atomic_load_explicit(&effect_request_seq, memory_order_acquire);
+    if (before & 1) return;
+    fx_settings_t     next     = effect_request;
+    granular_params_t granular = granular_request;
+    modal_params_t    modal    = modal_request;
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&effect_request_seq, memory_order_relaxed) == before) {
+        effect_settings   = next;
+        granular_settings = granular;
+        modal_settings    = modal;
+    }
+}
+
+// Helper function: Reconfigure the I2S slots for a new output format
+// Runs in the audio task between two writes, so no block is ever written in the wrong format
+static void apply_output_format(output_format_t format) {
+    if (i2s_handle != NULL) {
+        i2s_std_slot_config_t slot_config =
+            I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(output_format_bit_width(format), I2S_SLOT_MODE_STEREO);
+        i2s_channel_disable(i2s_handle);
+        esp_err_t res = i2s_channel_reconfig_std_slot(i2s_handle, &slot_config);
+        i2s_channel_enable(i2s_handle);
+        if (res != ESP_OK) {
+            output_format = active_format;  // Keep the old format
+            return;
+        }
+    }
+    active_format = format;
+}
+
+// Helper function: Switch the I2S clock to a new output rate
+static void apply_output_rate(uint32_t rate) {
+    if (i2s_handle != NULL) {
+        i2s_std_clk_config_t clk_config = I2S_STD_CLK_DEFAULT_CONFIG(rate);
+        i2s_channel_disable(i2s_handle);
+        esp_err_t res = i2s_channel_reconfig_std_clock(i2s_handle, &clk_config);
+        i2s_channel_enable(i2s_handle);
+        if (res != ESP_OK) {
+            output_rate = active_rate;  // Keep the old rate
+            return;
+        }
+    }
+    resampler_reset(resampler);
+    active_rate = rate;
+}
+
+// Helper function: Render 'frames' frames of one voice into 'buffer' (mono) and count it in 'counts'
+// Advances its position and envelope; once the voice falls idle the rest of the buffer is silence
+static inline void render_voice(active_note_t* note, float* buffer, uint8_t* counts, int frames, synth_interp_t interp,
+                                const int16_t* table, const int16_t* next, float weight, float weight_step) {
+    int frame = 0;
+    for (; frame < frames && note->adsr_state != ADSR_IDLE; frame++) {
+        counts[frame]++;
+
+        // Get interpolated sample from waveform
+        float sample;
+        if (next != NULL) {
+            // Both morph frames are read at the voice's one phase
+            float position = note->playback_position * WAVETABLE_SCALE;
+            float lower    = get_wavetable_sample(table, position, interp);
+            float upper    = get_wavetable_sample(next, position, interp);
+            sample         = lower + (upper - lower) * weight;
+        } else if (table != NULL) {
+            sample = get_wavetable_sample(table, note->playback_position * WAVETABLE_SCALE, interp);
+        } else {
+            sample = get_waveform_sample(note->playback_position, interp);
+        }
+
+        // Update and apply the ADSR envelope
+        update_adsr(note);
+        buffer[frame] = sample * note->adsr_level;
+
+        // Advance playback position at the correct speed
+        // Speed is independent per note - this ensures correct pitch
+        note->playback_position += note->playback_speed;
+
+        // Wrap after every cycle, this keeps the fractional part precise
+        // (and the scaled position for user wavetables within float precision)
+        if (note->playback_position >= WAVEFORM_CYCLE_LENGTH) {
+            note->playback_position -= WAVEFORM_CYCLE_LENGTH;
+        }
+        weight += weight_step;
+    }
+    for (; frame < frames; frame++) buffer[frame] = 0.0f;
+}
+
+// Helper function: Apply one voice's envelope to the 'frames' samples its engine rendered into 'buffer'
+// and count it in 'counts'; once the voice falls idle the rest of the buffer is silence
+static inline void envelope_voice(active_note_t* note, float* buffer, uint8_t* counts, int frames) {
+    int frame = 0;
+    for (; frame < frames && note->adsr_state != ADSR_IDLE; frame++) {
+        counts[frame]++;
+        update_adsr(note);
+        buffer[frame] *= note->adsr_level;
+    }
+    for (; frame < frames; frame++) buffer[frame] = 0.0f;
+}
+
+// Helper function: Mix 'frames' frames of all voices into 'out' (interleaved stereo) from frame 'offset' on
+// With a schedule every voice runs through the voice inserts, and the buses it sends to get their share
+// at the same offset. 'morph' holds the morph spans of the whole block when 'bank' is set. Advances voice
+// positions and envelopes; returns the most voices active at once. With the modal engine 'frames' is at
+// most MODAL_CHUNK
+static int mix_voices(float* out, int offset, int frames, synth_engine_t voice_engine, synth_interp_t interp,
+                      const wavetable_t* table, const wavetable_bank_t* bank, const morph_block_t* morph,
+                      const fx_schedule_t* fx) {
+    const bool  send_a  = fx != NULL && fx->send_used[0];
+    const bool  send_b  = fx != NULL && fx->send_used[1];
+    const float level_a = send_a ? fx->send[0] : 0.0f;
+    const float level_b = send_b ? fx->send[1] : 0.0f;
+
+    // With a morph bank the two frames around the position are crossfaded, span by span; without
+    // one the whole segment is a single span
+    morph_span_t spans[MORPH_MAX_SPANS] = {{.pair = 0, .frames = frames, .weight = 0.0f}};
+    float        weight_step            = bank != NULL ? morph->weight_step : 0.0f;
+    int          span_count             = bank != NULL ? morph_segment(morph, offset, frames, spans) : 1;
+
+    memset(voice_counts, 0, frames);
+    memset(dry_sum, 0, sizeof(float) * frames);
+
+    // Modal engine: strike the notes started since the last segment (and sounding ones the engine has not
+    // played yet), then run the resonators of all voices in one pass
+    if (voice_engine == SYNTH_ENGINE_MODAL) {
+        for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+            active_note_t* note = &active_notes[i];
+            if (note->adsr_state == ADSR_IDLE) continue;
+            if (note->struck || !modal_voice_active(i)) modal_voice_strike(i, note->note_index, &modal_settings);
+            note->struck = false;
+        }
+        modal_render(frames);
+    }
+    if (send_a) memset(send_sum[0], 0, sizeof(float) * frames);
+    if (send_b) memset(send_sum[1], 0, sizeof(float) * frames);
+
+    // One voice at a time: render, inserts, then its share of the dry and send sums
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        active_note_t* note = &active_notes[i];
+        if (note->adsr_state == ADSR_IDLE) continue;
+
+        if (voice_engine == SYNTH_ENGINE_GRANULAR) {
+            // Grains at the voice's pitch (the source plays C1 at speed 1, as the waveform), then its envelope
+            granular_voice_render(i, note->playback_speed, &granular_settings, voice_buffer, frames);
+            envelope_voice(note, voice_buffer, voice_counts, frames);
+            if (note->adsr_state == ADSR_IDLE) granular_voice_stop(i);
+        } else if (voice_engine == SYNTH_ENGINE_MODAL) {
+            memcpy(voice_buffer, modal_voice_output(i), sizeof(float) * frames);
+            envelope_voice(note, voice_buffer, voice_counts, frames);
+            if (note->adsr_state == ADSR_IDLE) modal_voice_stop(i);
+        } else {
+            // With a user wavetable every voice reads the mip level that has no harmonics above Nyquist
+            int level = 0;
+            if (bank != NULL || table != NULL) {
+                level = wavetable_mip_level(note->playback_speed * SAMPLE_RATE / WAVEFORM_CYCLE_LENGTH, SAMPLE_RATE);
+            }
+            for (int span = 0, at = 0; span < span_count; at += spans[span].frames, span++) {
+                const int16_t* voice_table = NULL;
+                const int16_t* voice_next  = NULL;  // Same level of the upper morph frame
+                if (bank != NULL) {
+                    voice_table = bank->tables[spans[span].pair].mips[level];
+                    voice_next  = bank->tables[spans[span].pair + 1].mips[level];
+                } else if (table != NULL) {
+                    voice_table = table->mips[level];
+                }
+                render_voice(note, voice_buffer + at, voice_counts + at, spans[span].frames, interp, voice_table,
+                             voice_next, spans[span].weight, weight_step);
+            }
+        }
+        if (fx != NULL) fx_chain_run_voice(fx, i, voice_buffer, frames);
+
+        for (int frame = 0; frame < frames; frame++) dry_sum[frame] += voice_buffer[frame];
+        if (send_a) {
+            for (int frame = 0; frame < frames; frame++) send_sum[0][frame] += level_a * voice_buffer[frame];
+        }
+        if (send_b) {
+            for (int frame = 0; frame < frames; frame++) send_sum[1][frame] += level_b * voice_buffer[frame];
+        }
+    }
+
+    // Normalize by number of active notes to prevent clipping, then spread to stereo
+    float* bus_a  = send_a ? fx_chain_bus(0) + offset * 2 : NULL;
+    float* bus_b  = send_b ? fx_chain_bus(1) + offset * 2 : NULL;
+    int    voices = 0;
+    out += offset * 2;
+    for (int frame = 0; frame < frames; frame++) {
+        int active_count = voice_counts[frame];
+        if (active_count > voices) voices = active_count;
+
+        if (active_count > 0) {
+            // Target normalization (1 / sqrt for better perceived loudness), from a table set up in synth_init
+            float target_normalization = normalization_table[active_count];
+
+            // Smooth the normalization change to prevent clicks when notes start/stop
+            // Use exponential smoothing: smaller alpha = smoother but slower response
+            // Alpha of 0.01 means normalization reaches 99% of target in ~460 samples (~10ms)
+            float alpha = 0.01f;
+            current_normalization += alpha * (target_normalization - current_normalization);
+        } else {
+            // No active notes, reset normalization to 1.0
+            current_normalization = 1.0f;
+        }
+
+        // Mono to stereo
+        float mix          = dry_sum[frame] * current_normalization;
+        out[frame * 2]     = mix;
+        out[frame * 2 + 1] = mix;
+        if (send_a) {
+            bus_a[frame * 2]     = send_sum[0][frame] * current_normalization;
+            bus_a[frame * 2 + 1] = bus_a[frame * 2];
+        }
+        if (send_b) {
+            bus_b[frame * 2]     = send_sum[1][frame] * current_normalization;
+            bus_b[frame * 2 + 1] = bus_b[frame * 2];
+        }
+    }
+    return voices;
+}
+
+// Helper function: Start playing a note, returns the voice it plays on (-1 if none was free)
+// Audio task only, like everything that changes voices
+static int start_note(int note_index) {
+    if (note_index < 0 || note_index >= NUM_NOTES) return -1;
+
+    // Find a free slot or reuse a slot with the same note
+    // Only the first 'polyphony' slots are handed out to new notes
+    const int voices = polyphony;
+    int slot = -1;
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        if (active_notes[i].note_index == note_index) {
+            slot = i;  // Reuse existing slot for this note
+            break;
+        }
+        if (slot == -1 && i < voices && active_notes[i].adsr_state == ADSR_IDLE) {
+            slot = i;  // Found a free slot
+        }
+    }
+
+    if (slot >= 0) {
+        // Start the note
+        active_notes[slot].note_index = note_index;
+        active_notes[slot].playback_position = 0.0f;
+        active_notes[slot].playback_speed = note_defs[note_index].frequency / WAVEFORM_BASE_FREQ;
+        active_notes[slot].adsr_state = ADSR_ATTACK;
+        active_notes[slot].adsr_timer = 0;
+        active_notes[slot].adsr_level = 0.0f;
+        active_notes[slot].key_held = true;
+        active_notes[slot].note_on_time = esp_timer_get_time();
+        active_notes[slot].struck = true;
+    }
+    return slot;
+}
+
+// Helper function: Stop playing a note
+static void stop_note(int note_index) {
+    if (note_index < 0 || note_index >= NUM_NOTES) return;
+
+    // Find the active note and trigger release
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        if (active_notes[i].note_index == note_index) {
+            active_notes[i].key_held = false;  // Trigger release phase
+        }
+    }
+}
+
+// Helper function: Queue an event on a ring, returns false if it is full (producer of the ring)
+static bool ring_put(event_ring_t* ring, scheduled_event_t event) {
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    if (head - tail >= SCHEDULE_QUEUE_LENGTH) {
+        ring->dropped++;
+        return false;
+    }
+    ring->events[head & (SCHEDULE_QUEUE_LENGTH - 1)] = event;
+    atomic_store_explicit(&ring->head, head + 1, memory_order_release);
+    return true;
+}
+
+// Helper function: Take the oldest event off a ring, returns false if it is empty (audio task)
+static bool ring_take(event_ring_t* ring, scheduled_event_t* event) {
+    unsigned tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    if (tail == head) return false;
+    *event = ring->events[tail & (SCHEDULE_QUEUE_LENGTH - 1)];
+    atomic_store_explicit(&ring->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+// Helper function: Play the key and console notes queued since the last block
+static void take_note_events(void) {
+    scheduled_event_t event;
+    for (int source = 0; source < SYNTH_SOURCE_COUNT; source++) {
+        while (ring_take(&note_rings[source], &event)) {
+            if (event.on) {
+                // Latency counts from the key press, not from the block that took the event
+                int slot = start_note(event.note_index);
+                if (slot >= 0) active_notes[slot].note_on_time = event.time_us;
+            } else {
+                stop_note(event.note_index);
+            }
+        }
+    }
+}
+
+// Helper function: Move newly scheduled events into the pending list, which is sorted latest first
+static void take_scheduled_events(void) {
+    scheduled_event_t event;
+    while (pending_count < SCHEDULE_QUEUE_LENGTH && ring_take(&schedule_ring, &event)) {
+        // Insertion sort, an event goes in front of those due at the same time so they keep their order
+        int i = pending_count++;
+        while (i > 0 && pending[i - 1].time_us <= event.time_us) {
+            pending[i] = pending[i - 1];
+            i--;
+        }
+        pending[i] = event;
+    }
+}
+
+// Helper function: Mix a block, playing scheduled events at the frame they are due
+// 'block_time' is the esp_timer time of the first frame, 'fx' the effects schedule that decides the voice
+// inserts and sends (the bus and master chains are left to the caller); returns the most voices active at once
+static int render_block(float* out, int frames, int64_t block_time, synth_engine_t voice_engine, synth_interp_t interp,
+                        const wavetable_t* table, const wavetable_bank_t* bank, const fx_schedule_t* fx) {
+    take_note_events();
+    take_scheduled_events();
+
+    // The morph position moves once per block, each segment below takes its part of the spans
+    morph_block_t morph = {.count = 0};
+    if (bank != NULL) morph.count = update_morph(bank->frames, frames, morph.spans, &morph.weight_step);
+
+    int voices = 0;
+    int done   = 0;
+    while (done < frames) {
+        // Play everything due by the current frame, the next event later in the block ends the segment
+        int end = frames;
+        while (pending_count > 0) {
+            const scheduled_event_t* event = &pending[pending_count - 1];
+            int64_t                  frame = (event->time_us - block_time) * SAMPLE_RATE / 1000000;
+            if (frame > done) {
+                if (frame < frames) end = (int)frame;
+                break;
+            }
+            if (frame < 0) {
+                uint32_t late_us = (uint32_t)(block_time - event->time_us);
+                if (late_us > stats.late_us_max) stats.late_us_max = late_us;
+                stats.events_late++;
+            }
+            stats.events_played++;
+            if (event->on) {
+                start_note(event->note_index);
+            } else {
+                stop_note(event->note_index);
+            }
+            pending_count--;
+        }
+
+        // The modal engine runs its resonators over at most MODAL_CHUNK frames at a time
+        if (voice_engine == SYNTH_ENGINE_MODAL && end - done > MODAL_CHUNK) end = done + MODAL_CHUNK;
+
+        int segment_voices = mix_voices(out, done, end - done, voice_engine, interp, table, bank, &morph, fx);
+        if (segment_voices > voices) voices = segment_voices;
+        done = end;
+    }
+    uint32_t dropped = schedule_ring.dropped;
+    for (int source = 0; source < SYNTH_SOURCE_COUNT; source++) dropped += note_rings[source].dropped;
+    stats.events_dropped = dropped;
+    return voices;
+}
+
+// Helper function: Render one block through the whole output path and write it to I2S
+static void audio_block(void) {
+    size_t bytes_written;
+
+    if (output_format != active_format) {
+        apply_output_format(output_format);
+    }
+    if (output_rate != active_rate) {
+        apply_output_rate(output_rate);
+    }
+
+    // Pick up tunables once so a whole block uses consistent settings
+    const int            frames     = block_frames;  // Output frames
+    const bool           resample   = (active_rate != SAMPLE_RATE);
+    const int            mix_frames = resample ? resampler_input_frames(resampler, frames) : frames;
+    const synth_interp_t interp     = effective_interpolation();
+
+    TRACE_BEGIN(TRACE_AUDIO_BLOCK);
+    dsp_arena_render_begin();
+    int64_t block_start = esp_timer_get_time();
+
+    // The render clock advances by the frames mixed and follows the real clock slowly, so
+    // scheduled events keep their spacing even though blocks start with some jitter
+    int64_t clock_error = block_start - render_clock_us;
+    if (clock_error > RENDER_CLOCK_RESYNC_US || clock_error < -RENDER_CLOCK_RESYNC_US) {
+        render_clock_us = block_start;
+    } else {
+        render_clock_us += clock_error / 16;
+    }
+    int64_t block_time = render_clock_us;
+    render_clock_us += (int64_t)mix_frames * 1000000 / SAMPLE_RATE;
+
+    // Effect settings and schedule for the whole block; the chorus/flanger fades out with the
+    // other effect tails under heavy load shedding
+    take_effect_settings();
+    effect_block = effect_settings;
+    if (shed_level >= SYNTH_SHED_NO_TAILS) effect_block.chorus.mode = CHORUS_OFF;
+    // Tables and schedule for the whole block; once they are published as in use, the previous block's
+    // are no longer read and synth_wait_switch() lets their owner free or reuse them
+    const wavetable_t*      table = wavetable;
+    const wavetable_bank_t* bank  = wavetable_bank;
+    const fx_schedule_t*    fx    = fx_schedule;
+    atomic_thread_fence(memory_order_acquire);
+    if (fx != fx_schedule_run) fx_chain_prepare(fx);
+    atomic_thread_fence(memory_order_release);
+    wavetable_run   = table;
+    bank_run        = bank;
+    fx_schedule_run = fx;
+
+    // Engine for the whole block; switching away from the granular or modal engine gives every grain
+    // back or empties the resonator pass
+    const synth_engine_t voice_engine = engine;
+    if (voice_engine != active_engine) {
+        if (active_engine == SYNTH_ENGINE_GRANULAR) {
+            for (int i = 0; i < MAX_ACTIVE_NOTES; i++) granular_voice_stop(i);
+        } else if (active_engine == SYNTH_ENGINE_MODAL) {
+            for (int i = 0; i < MAX_ACTIVE_NOTES; i++) modal_voice_stop(i);
+        }
+        active_engine = voice_engine;
+    }
+
+    // Voices with their inserts and sends, then the bus chains, returns and master chain
+    int voices = render_block(mix_buffer, mix_frames, block_time, voice_engine, interp, table, bank, fx);
+    fx_chain_run(fx, mix_frames);
+
+    // Recording of the granular source from the mix (returns at once when off)
+    granular_capture_block(mix_buffer, mix_frames);
+
+    // Convert to the codec rate if it is not running at the synth's native rate
+    float* block = mix_buffer;
+    if (resample) {
+        resampler_process(resampler, mix_buffer, resample_buffer, frames);
+        block = resample_buffer;
+    }
+
+    // Speaker EQ and bass enhancer, with the coefficients of the codec rate
+    const speaker_eq_params_t speaker = {.eq = speaker_eq_on, .bass = speaker_bass};
+    speaker_eq_process(speaker_eq, &speaker, active_rate, block, frames);
+
+    // Gain, clipping, dither and conversion to the I2S sample format in one pass
+    output_stage_process(active_format, block, output_buffer, frames * 2, master_gain);
+
+    // Debug capture of exactly what goes to the I2S driver (returns at once when off)
+    pcm_capture_block(output_buffer, frames, active_format, active_rate, block_count, underrun_count);
+
+    float load = update_stats(frames, block_start, esp_timer_get_time(), voices);
+    block_count++;
+    publish_snapshot(mix_buffer, mix_frames, voices, load);
+    update_load_shedding(stats.deadline_us, load, voices);
+    dsp_arena_render_end();
+    TRACE_END(TRACE_AUDIO_BLOCK);
+
+    // Write to I2S (blocks until DMA buffer is ready, ~1.45ms at 64 frames)
+    // I2S output rate is constant at SAMPLE_RATE (44100 Hz) or RESAMPLER_OUTPUT_RATE (48000 Hz)
+    // regardless of how many notes are playing
+    if (i2s_handle != NULL) {
+        TRACE_BEGIN(TRACE_AUDIO_WRITE);
+        i2s_channel_write(i2s_handle, output_buffer,
+                        frames * 2 * output_format_bytes(active_format), &bytes_written, portMAX_DELAY);
+        TRACE_END(TRACE_AUDIO_WRITE);
+    }
+}
+
+// Audio mixing task
+static void audio_task(void* arg) {
+    while (1) audio_block();
+}
+
+void synth_init(i2s_chan_handle_t handle) {
+    i2s_handle = handle;
+
+    // All block buffers are touched every sample, so they go to internal SRAM
+    mix_buffer      = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * MAX_FRAMES_PER_WRITE * 2, "synth mix");
+    resample_buffer = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * MAX_FRAMES_PER_WRITE * 2, "synth resample");
+    output_buffer   = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(int32_t) * MAX_FRAMES_PER_WRITE * 2, "synth output");
+    resampler       = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(resampler_t), "resampler");
+    speaker_eq      = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(speaker_eq_t), "speaker eq");
+    voice_buffer    = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * MAX_FRAMES_PER_WRITE, "synth voice");
+    dry_sum         = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * MAX_FRAMES_PER_WRITE, "synth dry sum");
+    send_sum[0]     = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * MAX_FRAMES_PER_WRITE, "synth send A sum");
+    send_sum[1]     = dsp_arena_alloc(DSP_ARENA_FAST, sizeof(float) * MAX_FRAMES_PER_WRITE, "synth send B sum");
+    voice_counts    = dsp_arena_alloc(DSP_ARENA_FAST, MAX_FRAMES_PER_WRITE, "synth voice counts");
+    if (mix_buffer == NULL || resample_buffer == NULL || output_buffer == NULL || resampler == NULL ||
+        speaker_eq == NULL || voice_buffer == NULL || dry_sum == NULL || send_sum[0] == NULL || send_sum[1] == NULL ||
+        voice_counts == NULL || !fx_chain_init(mix_buffer, MAX_ACTIVE_NOTES, MAX_FRAMES_PER_WRITE) ||
+        !granular_init(MAX_ACTIVE_NOTES) || !modal_init(MAX_ACTIVE_NOTES)) {
+        return;
+    }
+
+    speaker_eq_reset(speaker_eq);
+
+    // Effects start switched off, with their settings ready for switching on, in the default patch
+    waveshaper_init_tables();
+    effect_settings.drive = (waveshaper_params_t){.curve = WAVESHAPER_OFF, .drive = 4.0f, .level = 0.5f};
+    chorus_preset(CHORUS_CHORUS, &effect_settings.chorus);
+    effect_settings.chorus.mode = CHORUS_OFF;
+    effect_request              = effect_settings;
+    effect_block                = effect_settings;
+    fx_patch_default(&fx_patch);
+    fx_chain_compile(&fx_patch, &effect_block, NULL, &fx_schedules[0]);
+    fx_schedule = &fx_schedules[0];
+    granular_params_default(&granular_settings);
+    granular_request = granular_settings;
+    modal_params_default(&modal_settings);
+    modal_request = modal_settings;
+
+    for (int i = 1; i <= MAX_ACTIVE_NOTES; i++) normalization_table[i] = 1.0f / sqrtf((float)i);
+
+    // Initialize active notes array
+    memset(active_notes, 0, sizeof(active_notes));
+    for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
+        active_notes[i].note_index = -1;  // Mark all slots as free
+        active_notes[i].adsr_state = ADSR_IDLE;
+    }
+    synth_reset_stats();
+
+    // Count DMA underruns; callbacks can only be registered while the channel is stopped
+    if (i2s_handle != NULL && i2s_channel_disable(i2s_handle) == ESP_OK) {
+        const i2s_event_callbacks_t callbacks = {
+            .on_send_q_ovf = on_send_queue_overflow,
+        };
+        i2s_channel_register_event_callback(i2s_handle, &callbacks, NULL);
+        i2s_channel_enable(i2s_handle);
+    }
+
+    // Create audio mixing task on Core 1 with high priority
+    xTaskCreatePinnedToCore(
+        audio_task,
+        "audio",
+        4096,                           // Stack size
+        NULL,                           // Parameters
+        configMAX_PRIORITIES - 2,       // High priority
+        &audio_task_handle,             // Task handle
+        1                               // Pin to Core 1
+    );
+}
+
+bool synth_play_note(synth_source_t source, int note_index, bool on) {
+    if (source < 0 || source >= SYNTH_SOURCE_COUNT || note_index < 0 || note_index >= NUM_NOTES) return false;
+    return ring_put(&note_rings[source],
+                    (scheduled_event_t){.time_us = esp_timer_get_time(), .note_index = note_index, .on = on});
+}
+
+bool synth_schedule_note(int note_index, bool on, int64_t time_us) {
+    if (note_index < 0 || note_index >= NUM_NOTES) return false;
+    return ring_put(&schedule_ring, (scheduled_event_t){.time_us = time_us, .note_index = note_index, .on = on});
+}
+
+void synth_get_stats(synth_stats_t* out) {
+    *out = stats;
+}
+
+void synth_reset_stats(void) {
+    memset(&stats, 0, sizeof(stats));
+    underrun_count        = 0;
+    schedule_ring.dropped = 0;
+    for (int source = 0; source < SYNTH_SOURCE_COUNT; source++) note_rings[source].dropped = 0;
+}
+
+TaskHandle_t synth_get_task(void) {
+    return audio_task_handle;
+}
+
+bool synth_set_block_frames(int frames) {
+    if (frames < MIN_FRAMES_PER_WRITE || frames > MAX_FRAMES_PER_WRITE) return false;
+    block_frames = frames;
+    return true;
+}
+
+int synth_get_block_frames(void) {
+    return block_frames;
+}
+
+bool synth_set_polyphony(int voices) {
+    if (voices < 1 || voices > MAX_ACTIVE_NOTES) return false;
+    polyphony = voices;
+    return true;
+}
+
+int synth_get_polyphony(void) {
+    return polyphony;
+}
+
+bool synth_set_interpolation(synth_interp_t mode) {
+    if (mode < 0 || mode >= SYNTH_INTERP_COUNT) return false;
+    interpolation = mode;
+    return true;
+}
+
+synth_interp_t synth_get_interpolation(void) {
+    return interpolation;
+}
+
+const char* synth_interp_name(synth_interp_t mode) {
+    if (mode < 0 || mode >= SYNTH_INTERP_COUNT) return "?";
+    return interp_names[mode];
+}
+
+void synth_set_load_shedding(bool enable) {
+    shed_enabled = enable;
+}
+
+bool synth_get_load_shedding(void) {
+    return shed_enabled;
+}
+
+synth_shed_level_t synth_get_shed_level(void) {
+    return shed_level;
+}
+
+const char* synth_shed_name(synth_shed_level_t level) {
+    if (level < 0 || level >= SYNTH_SHED_COUNT) return "?";
+    return shed_names[level];
+}
+
+bool synth_set_output_format(output_format_t format) {
+    if (format < 0 || format >= OUTPUT_FORMAT_COUNT) return false;
+    output_format = format;
+    return true;
+}
+
+output_format_t synth_get_output_format(void) {
+    return active_format;
+}
+
+bool synth_set_master_gain(float gain) {
+    if (!(gain >= 0.0f && gain <= 4.0f)) return false;
+    master_gain = gain;
+    return true;
+}
+
+float synth_get_master_gain(void) {
+    return master_gain;
+}
+
+bool synth_set_speaker_eq(const speaker_eq_params_t* params) {
+    if (!speaker_eq_params_valid(params)) return false;
+    speaker_eq_on = params->eq;
+    speaker_bass  = params->bass;
+    return true;
+}
+
+void synth_get_speaker_eq(speaker_eq_params_t* params) {
+    params->eq   = speaker_eq_on;
+    params->bass = speaker_bass;
+}
+
+bool synth_set_output_rate(uint32_t rate) {
+    if (rate != SAMPLE_RATE && rate != RESAMPLER_OUTPUT_RATE) return false;
+    output_rate = rate;
+    return true;
+}
+
+uint32_t synth_get_output_rate(void) {
+    return active_rate;
+}
+
+bool synth_get_snapshot(synth_snapshot_t* out) {
+    // The writer holds the odd sequence number for one short copy, a few retries always suffice
+    for (int attempt = 0; attempt < 16; attempt++) {
+        unsigned before = atomic_load_explicit(&snapshot_seq, memory_order_acquire);
+        if (before & 1) continue;
+        memcpy(out, &snapshot, sizeof(*out));
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&snapshot_seq, memory_order_relaxed) == before) return true;
+    }
+    return false;
+}
+
+// Helper function: Open (odd sequence number) and close (even again) a write of the effect settings
+static void begin_effect_write(void) {
+    unsigned seq = atomic_load_explicit(&effect_request_seq, memory_order_relaxed);
+    atomic_store_explicit(&effect_request_seq, seq + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void end_effect_write(void) {
+    unsigned seq = atomic_load_explicit(&effect_request_seq, memory_order_relaxed);
+    atomic_store_explicit(&effect_request_seq, seq + 1, memory_order_release);
+}
+
+bool synth_set_chorus(const chorus_params_t* params) {
+    if (!chorus_params_valid(params)) return false;
+    begin_effect_write();
+    effect_request.chorus = *params;
+    end_effect_write();
+    return true;
+}
+
+void synth_get_chorus(chorus_params_t* params) {
+    *params = effect_request.chorus;  // The console is the only writer, and the caller
+}
+
+bool synth_set_waveshaper(const waveshaper_params_t* params) {
+    if (!waveshaper_params_valid(params)) return false;
+    begin_effect_write();
+    effect_request.drive = *params;
+    end_effect_write();
+    return true;
+}
+
+void synth_get_waveshaper(waveshaper_params_t* params) {
+    *params = effect_request.drive;
+}
+
+bool synth_set_engine(synth_engine_t voice_engine) {
+    if (voice_engine < 0 || voice_engine >= SYNTH_ENGINE_COUNT) return false;
+    engine = voice_engine;
+    return true;
+}
+
+synth_engine_t synth_get_engine(void) {
+    return engine;
+}
+
+const char* synth_engine_name(synth_engine_t voice_engine) {
+    if (voice_engine < 0 || voice_engine >= SYNTH_ENGINE_COUNT) return "?";
+    return engine_names[voice_engine];
+}
+
+bool synth_set_granular(const granular_params_t* params) {
+    if (!granular_params_valid(params)) return false;
+    begin_effect_write();
+    granular_request = *params;
+    end_effect_write();
+    return true;
+}
+
+void synth_get_granular(granular_params_t* params) {
+    *params = granular_request;
+}
+
+bool synth_set_modal(const modal_params_t* params) {
+    if (!modal_params_valid(params)) return false;
+    begin_effect_write();
+    modal_request = *params;
+    end_effect_write();
+    return true;
+}
+
+void synth_get_modal(modal_params_t* params) {
+    *params = modal_request;
+}
+
+bool synth_set_fx_patch(const fx_patch_t* patch) {
+    if (!fx_patch_valid(patch)) return false;
+
+    // The other schedule is only compiled into once the audio task has switched to the current one
+    synth_wait_switch();
+    const fx_schedule_t* current = fx_schedule;
+    fx_schedule_t*       next    = current == &fx_schedules[0] ? &fx_schedules[1] : &fx_schedules[0];
+    fx_chain_compile(patch, &effect_block, current, next);
+    fx_patch = *patch;
+    atomic_thread_fence(memory_order_release);
+    fx_schedule = next;
+    return true;
+}
+
+void synth_get_fx_patch(fx_patch_t* patch) {
+    *patch = fx_patch;
+}
+
+void synth_set_wavetable(const wavetable_t* table) {
+    wavetable = table;
+}
+
+void synth_wait_switch(void) {
+    // No timeout: when the audio task stalls (a flash erase, say), it may still be reading the old memory.
+    // Without an audio task (the host programs render the blocks themselves) there is nothing to wait for
+    if (audio_task_handle == NULL) return;
+    while (wavetable_run != wavetable || bank_run != wavetable_bank || fx_schedule_run != fx_schedule) {
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    atomic_thread_fence(memory_order_acquire);
+}
+
+void synth_set_wavetable_bank(const wavetable_bank_t* bank) {
+    wavetable_bank = bank;
+}
+
+bool synth_set_morph(float position, float lfo_rate, float lfo_depth) {
+    if (!(position >= 0.0f && position <= 1.0f)) return false;
+    if (!(lfo_rate >= 0.0f && lfo_rate <= 20.0f)) return false;
+    if (!(lfo_depth >= 0.0f && lfo_depth <= 1.0f)) return false;
+    morph_position  = position;
+    morph_lfo_rate  = lfo_rate;
+    morph_lfo_depth = lfo_depth;
+    return true;
+}
+
+void synth_get_morph(float* position, float* lfo_rate, float* lfo_depth) {
+    *position  = morph_position;
+    *lfo_rate  = morph_lfo_rate;
+    *lfo_depth = morph_lfo_depth;
+}
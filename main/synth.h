@@ -0,0 +1,220 @@
+// Synthesizer engine: voice allocation, ADSR envelopes and the audio mixing task
+//
+// The mixer runs in audio_task pinned to core 1 and streams blocks to the I2S
+// channel provided by the BSP. Everything the UI or the console needs to know
+// about the engine (statistics, tunables) goes through this header.
+
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/i2s_std.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "fx_chain.h"
+#include "granular.h"
+#include "keyboard_notes.h"
+#include "modal.h"
+#include "output_stage.h"
+#include "speaker_eq.h"
+#include "wavetable.h"
+
+// Audio constants
+#define MAX_ACTIVE_NOTES     13     // 8 white keys + 5 black keys
+#define FRAMES_PER_WRITE     64     // Default block size
+#define MIN_FRAMES_PER_WRITE 16     // Smallest block size selectable at runtime
+#define MAX_FRAMES_PER_WRITE 512    // Largest block size selectable at runtime
+#define SAMPLE_RATE          44100
+
+// Waveform interpolation modes, cheapest first
+typedef enum {
+    SYNTH_INTERP_NEAREST = 0,  // Truncate to the previous sample
+    SYNTH_INTERP_LINEAR,       // Linear interpolation between two samples (default)
+    SYNTH_INTERP_CUBIC,        // 4-point Catmull-Rom interpolation
+    SYNTH_INTERP_COUNT
+} synth_interp_t;
+
+// Sound engines, selected for all voices at once
+typedef enum {
+    SYNTH_ENGINE_WAVE = 0,  // Built-in waveform, user wavetable or morph bank (default)
+    SYNTH_ENGINE_GRANULAR,  // Grains from the granular source, see granular.h
+    SYNTH_ENGINE_MODAL,     // Struck resonator banks, see modal.h
+    SYNTH_ENGINE_COUNT
+} synth_engine_t;
+
+// Tasks that play notes, each with its own queue to the audio task (synth_play_note())
+typedef enum {
+    SYNTH_SOURCE_KEYBOARD = 0,  // The UI task's key events
+    SYNTH_SOURCE_CONSOLE,       // Console commands
+    SYNTH_SOURCE_COUNT
+} synth_source_t;
+
+// Load shedding levels, applied in order as the audio deadline comes under pressure
+// Effects with long tails should stop feeding them from SYNTH_SHED_NO_TAILS upwards
+typedef enum {
+    SYNTH_SHED_NONE = 0,     // Full quality
+    SYNTH_SHED_INTERP,       // Interpolation capped at linear
+    SYNTH_SHED_NO_TAILS,     // Nearest-sample interpolation, effect tails dropped
+    SYNTH_SHED_STEAL,        // As above, plus the quietest voice is faded out every overloaded block
+    SYNTH_SHED_COUNT
+} synth_shed_level_t;
+
+// Load shedding thresholds (fraction of the block deadline spent computing)
+#define SHED_LOAD_CRITICAL 0.90f  // A single block this heavy escalates immediately
+#define SHED_LOAD_HIGH     0.75f  // Smoothed load above this escalates
+#define SHED_LOAD_LOW      0.45f  // Smoothed load below this for SHED_RECOVER_MS steps back
+#define SHED_RECOVER_MS    250    // Calm period before restoring one level of quality
+
+// Engine statistics, updated by the audio task once per block
+typedef struct {
+    uint32_t blocks;          // Blocks rendered since the last reset
+    uint32_t underruns;       // I2S DMA ran out of data (send queue overflow events)
+    uint32_t block_us_last;   // Compute time of the last block
+    uint32_t block_us_max;    // Worst compute time since the last reset
+    uint32_t deadline_us;     // Real-time duration of one block at the current block size
+    float    load_avg;        // Smoothed compute time / deadline (1.0 = no headroom left)
+    float    load_peak;       // Worst compute time / deadline since the last reset
+    int      active_voices;   // Voices that were not idle in the last block
+    uint32_t latency_count;   // Note-on events measured
+    uint32_t latency_us_min;  // Note-on to end of first rendered block, best case
+    uint32_t latency_us_max;  // ... worst case
+    uint32_t latency_us_avg;  // ... running average
+    synth_shed_level_t shed_level;  // Current load shedding level
+    uint32_t shed_events;     // Times the shedding level was raised
+    uint32_t voices_stolen;   // Voices faded out by load shedding
+    uint32_t events_played;   // Scheduled note events played at their frame
+    uint32_t events_late;     // ... of which were already due when their block started
+    uint32_t events_dropped;  // Scheduled note events the queue had no room for
+    uint32_t late_us_max;     // Worst lateness of a scheduled event
+} synth_stats_t;
+
+// What a note is doing in a snapshot
+typedef enum {
+    SYNTH_NOTE_IDLE = 0,  // Silent
+    SYNTH_NOTE_HELD,      // Key down
+    SYNTH_NOTE_RELEASED,  // Key up, the envelope is finishing (release tail)
+    SYNTH_NOTE_STOLEN,    // Fading out after load shedding took its voice
+} synth_note_state_t;
+
+// Audio state published by the audio task after every block
+typedef struct {
+    uint32_t block;                  // Blocks rendered since start
+    uint8_t  note_state[NUM_NOTES];  // synth_note_state_t of every note
+    float    note_level[NUM_NOTES];  // Envelope level of every note (0.0 to 1.0)
+    int      active_voices;          // Most voices sounding at once in the block
+    float    load;                   // Compute time / deadline of the block
+    float    peak[2];                // Left and right sample peak of the block
+    float    envelope;               // Peak follower of the mix (0.0 to 1.0, 150 ms decay)
+} synth_snapshot_t;
+
+// Initialise all voices, hook up underrun detection and start the audio task
+// The block buffers come from the DSP arena, so dsp_arena_init() must have run
+void synth_init(i2s_chan_handle_t handle);
+
+// Start (on) or release a note (0 to NUM_NOTES - 1) at the start of the next block; a released note
+// fades out with the ADSR release time. Each source is a single producer: call from its task only.
+// Returns false if the source's queue is full
+bool synth_play_note(synth_source_t source, int note_index, bool on);
+
+// Start (on) or release a note at 'time_us' on the esp_timer clock, for sources that know ahead
+// of time when a note should sound (network MIDI). The audio task splits the block at the event,
+// so it lands on the sample frame it is due; events already due play at the start of the next block.
+// Single producer: call from one task only. Returns false if the queue is full
+bool synth_schedule_note(int note_index, bool on, int64_t time_us);
+
+// Copy the current statistics
+void synth_get_stats(synth_stats_t* stats);
+
+// Clear block time, load, underrun and latency statistics
+void synth_reset_stats(void);
+
+// Copy the snapshot of the last rendered block without ever blocking the audio task
+// Returns false (leaving 'snapshot' undefined) only if the audio task kept overwriting it
+bool synth_get_snapshot(synth_snapshot_t* snapshot);
+
+// Handle of the audio task (for stack high-water marks and runtime stats)
+TaskHandle_t synth_get_task(void);
+
+// Runtime tunables, applied at the start of the next block
+bool           synth_set_block_frames(int frames);
+int            synth_get_block_frames(void);
+bool           synth_set_polyphony(int voices);
+int            synth_get_polyphony(void);
+bool           synth_set_interpolation(synth_interp_t mode);
+synth_interp_t synth_get_interpolation(void);
+const char*    synth_interp_name(synth_interp_t mode);
+
+// Output sample format, switched by the audio task before its next write
+bool            synth_set_output_format(output_format_t format);
+output_format_t synth_get_output_format(void);
+
+// I2S output rate: SAMPLE_RATE (native) or 48000 (resampled from SAMPLE_RATE)
+bool     synth_set_output_rate(uint32_t rate);
+uint32_t synth_get_output_rate(void);
+
+// Digital master gain applied in the output stage (0.0 to 4.0, default 1.0)
+bool  synth_set_master_gain(float gain);
+float synth_get_master_gain(void);
+
+// Speaker compensation EQ and bass enhancer on the output (both off by default), see speaker_eq.h
+// Picked up at the start of the next block; returns false if a setting is out of range
+bool synth_set_speaker_eq(const speaker_eq_params_t* params);
+void synth_get_speaker_eq(speaker_eq_params_t* params);
+
+// Load shedding (enabled by default)
+void               synth_set_load_shedding(bool enable);
+bool               synth_get_load_shedding(void);
+synth_shed_level_t synth_get_shed_level(void);
+const char*        synth_shed_name(synth_shed_level_t level);
+
+// Chorus/flanger settings (off by default), see chorus.h; returns false if a setting is out of range
+// Picked up at the start of the next block, switching on or off fades the effect in or out
+bool synth_set_chorus(const chorus_params_t* params);
+void synth_get_chorus(chorus_params_t* params);
+
+// 2x oversampled overdrive settings (off by default), see waveshaper.h, for the stereo instance
+// and every voice insert alike; drive and level glide, a new curve starts from silence
+bool synth_set_waveshaper(const waveshaper_params_t* params);
+void synth_get_waveshaper(waveshaper_params_t* params);
+
+// Where the effects sit: voice inserts, send buses and master chain, see fx_chain.h
+// The default patch runs drive, then chorus on the master chain. A new patch is compiled at once and
+// played from the next block on; first waits until the audio task plays the previous one (see
+// synth_wait_switch()). Console task only (single writer), returns false if the patch is invalid
+bool synth_set_fx_patch(const fx_patch_t* patch);
+void synth_get_fx_patch(fx_patch_t* patch);
+
+// Sound engine of all voices, switched at the start of the next block; sounding notes carry on in the new engine
+bool           synth_set_engine(synth_engine_t engine);
+synth_engine_t synth_get_engine(void);
+const char*    synth_engine_name(synth_engine_t engine);
+
+// Granular engine settings, see granular.h; picked up at the start of the next block by the grains started
+// from then on. Returns false if a setting is out of range
+bool synth_set_granular(const granular_params_t* params);
+void synth_get_granular(granular_params_t* params);
+
+// Modal engine settings, see modal.h; picked up at the start of the next block by the notes struck from then
+// on. Returns false if a setting is out of range
+bool synth_set_modal(const modal_params_t* params);
+void synth_get_modal(modal_params_t* params);
+
+// Play a user wavetable instead of the compiled-in waveform (NULL = built-in)
+// Takes effect at the next block; the previous table must stay valid until synth_wait_switch() returned
+void synth_set_wavetable(const wavetable_t* table);
+
+// Play a morph bank instead of any single table (NULL = none), same lifetime rule as above
+void synth_set_wavetable_bank(const wavetable_bank_t* bank);
+
+// Morph position (0.0 .. 1.0 over the bank) and an LFO swinging it by +/- depth (rate up to 20 Hz)
+// The position is picked up once per block and glides to its new value within the block, crossing at most
+// 8 frames per audio block, however many segments scheduled events split it into
+bool synth_set_morph(float position, float lfo_rate, float lfo_depth);
+void synth_get_morph(float* position, float* lfo_rate, float* lfo_depth);
+
+// Wait until the audio task renders with the wavetable, morph bank and effects patch set last, so whatever
+// they replaced can be freed; no timeout, a stalled audio task holds the caller
+void synth_wait_switch(void);
+
+#endif  // SYNTH_H
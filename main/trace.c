@@ -0,0 +1,131 @@
+// Lightweight cross-task trace recorder
+//
+// Writers claim a slot with a single atomic fetch-add on the head index, fill
+// it in and then publish it by storing the slot's sequence number. Readers only
+// trust slots whose sequence number matches the index they expect, so a slot
+// that is half written or already overwritten by a later lap is skipped.
+//
+// Every event carries the index of the task that recorded it, so begin/end
+// pairs of tasks that preempt each other on one core are not mixed up. A task
+// claims its index with a compare-and-swap on a free entry of trace_tasks[]
+// the first time it records, and the dump lists the tasks by name.
+
+#include "trace.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define TRACE_INDEX_MASK (TRACE_BUFFER_EVENTS - 1)
+
+#define TRACE_FLAG_BEGIN 0x80  // Set for begin events, clear for end events
+#define TRACE_FLAG_TASK  0x7E  // Index of the task that recorded the event in trace_tasks[]
+#define TRACE_FLAG_CORE  0x01  // Core that recorded the event
+#define TRACE_TASK_SHIFT 1
+
+// One recorded event (8 bytes)
+typedef struct {
+    uint32_t timestamp;  // esp_timer time in microseconds (wraps after ~71 minutes)
+    uint16_t seq;        // Low 16 bits of (index + 1), 0 = never written
+    uint8_t  id;         // trace_id_t
+    uint8_t  flags;      // TRACE_FLAG_*
+} trace_event_t;
+
+_Static_assert((TRACE_BUFFER_EVENTS & TRACE_INDEX_MASK) == 0, "TRACE_BUFFER_EVENTS must be a power of two");
+_Static_assert(TRACE_MAX_TASKS <= (TRACE_FLAG_TASK >> TRACE_TASK_SHIFT) + 1, "TRACE_MAX_TASKS does not fit the flags");
+
+static const char* const trace_names[TRACE_NUM_IDS] = {
+    [TRACE_AUDIO_BLOCK] = "audio_block",
+    [TRACE_AUDIO_WRITE] = "audio_write",
+    [TRACE_INPUT]       = "input",
+    [TRACE_RENDER]      = "render",
+    [TRACE_BLIT]        = "blit",
+    [TRACE_LED]         = "led",
+};
+
+static trace_event_t trace_buffer[TRACE_BUFFER_EVENTS];
+static atomic_uint   trace_head   = 0;      // Total number of slots ever claimed
+static atomic_uint   trace_tail   = 0;      // First index still considered valid
+static atomic_bool   trace_paused = false;  // Set while dumping
+
+// Tasks that recorded events, by index; entries are claimed once and never given back
+static atomic_uintptr_t trace_tasks[TRACE_MAX_TASKS];
+static char             trace_task_names[TRACE_MAX_TASKS][configMAX_TASK_NAME_LEN];
+
+static inline uint8_t trace_core_id(void) {
+#if defined(CONFIG_IDF_TARGET_LINUX)
+    // The Linux simulator runs every task on a single emulated core
+    return 0;
+#else
+    return (uint8_t)xPortGetCoreID();
+#endif
+}
+
+// Helper function: Index of the calling task in trace_tasks[], claiming a free entry the first time
+static inline uint8_t trace_task_id(void) {
+    const uintptr_t task = (uintptr_t)xTaskGetCurrentTaskHandle();
+    for (int i = 0; i < TRACE_MAX_TASKS; i++) {
+        uintptr_t entry = atomic_load_explicit(&trace_tasks[i], memory_order_relaxed);
+        if (entry == 0 && atomic_compare_exchange_strong(&trace_tasks[i], &entry, task)) {
+            const char* name = pcTaskGetName(NULL);
+            for (int c = 0; c < configMAX_TASK_NAME_LEN - 1 && name[c] != '\0'; c++) trace_task_names[i][c] = name[c];
+            return (uint8_t)i;
+        }
+        if (entry == task) return (uint8_t)i;
+    }
+    return TRACE_MAX_TASKS - 1;  // Out of entries, the rest share the last one
+}
+
+void trace_record(trace_id_t id, bool begin) {
+    if (atomic_load_explicit(&trace_paused, memory_order_relaxed)) return;
+
+    uint32_t       index = atomic_fetch_add_explicit(&trace_head, 1, memory_order_relaxed);
+    trace_event_t* event = &trace_buffer[index & TRACE_INDEX_MASK];
+
+    event->timestamp = (uint32_t)esp_timer_get_time();
+    event->id        = (uint8_t)id;
+    event->flags     = (begin ? TRACE_FLAG_BEGIN : 0) | ((trace_task_id() << TRACE_TASK_SHIFT) & TRACE_FLAG_TASK) |
+                   (trace_core_id() & TRACE_FLAG_CORE);
+
+    // Publish: the sequence number must become visible after the payload
+    atomic_thread_fence(memory_order_release);
+    event->seq = (uint16_t)(index + 1);
+}
+
+void trace_dump(void) {
+    atomic_store(&trace_paused, true);
+    // Give writers that already passed the pause check time to finish their slot
+    vTaskDelay(pdMS_TO_TICKS(2));
+
+    uint32_t head  = atomic_load(&trace_head);
+    uint32_t start = atomic_load(&trace_tail);
+    if (head - start > TRACE_BUFFER_EVENTS) {
+        start = head - TRACE_BUFFER_EVENTS;
+    }
+
+    printf("TRACE-START %u\n", (unsigned)(head - start));
+    for (int i = 0; i < TRACE_MAX_TASKS && atomic_load(&trace_tasks[i]) != 0; i++) {
+        printf("TRACE-TASK %d %s\n", i, trace_task_names[i]);
+    }
+    for (uint32_t index = start; index != head; index++) {
+        const trace_event_t* event = &trace_buffer[index & TRACE_INDEX_MASK];
+        atomic_thread_fence(memory_order_acquire);
+        if (event->seq != (uint16_t)(index + 1) || event->id >= TRACE_NUM_IDS) {
+            continue;  // Torn or overwritten slot
+        }
+        printf("T %lu %u %u %c %s\n", (unsigned long)event->timestamp, event->flags & TRACE_FLAG_CORE,
+               (event->flags & TRACE_FLAG_TASK) >> TRACE_TASK_SHIFT, (event->flags & TRACE_FLAG_BEGIN) ? 'B' : 'E',
+               trace_names[event->id]);
+    }
+    printf("TRACE-STOP\n");
+    fflush(stdout);
+
+    atomic_store(&trace_tail, head);
+    atomic_store(&trace_paused, false);
+}
+
+void trace_clear(void) {
+    atomic_store(&trace_tail, atomic_load(&trace_head));
+}
@@ -0,0 +1,54 @@
+// Lightweight cross-task trace recorder
+//
+// Records timestamped begin/end events from any task on either core into one
+// lock-free ring buffer. trace_dump() prints the buffer over the serial console;
+// trace_to_chrome.py turns that log into Chrome trace JSON that can be opened
+// in chrome://tracing or ui.perfetto.dev (one timeline row per task).
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Comment out to compile all trace points away
+#define TRACE_ENABLED
+
+// Number of events kept in the ring buffer (must be a power of two)
+// 4096 events x 8 bytes = 32 KB, roughly 1.5 seconds of audio + UI activity
+#define TRACE_BUFFER_EVENTS 4096
+
+// Tasks told apart in the trace, later ones share the last row
+#define TRACE_MAX_TASKS 16
+
+// Trace point identifiers (keep trace_names[] in trace.c in sync)
+typedef enum {
+    TRACE_AUDIO_BLOCK = 0,  // Mixing one block in audio_task
+    TRACE_AUDIO_WRITE,      // Waiting for i2s_channel_write to accept the block
+    TRACE_INPUT,            // Draining the BSP input event queue
+    TRACE_RENDER,           // Drawing the UI into the framebuffer
+    TRACE_BLIT,             // Transferring the framebuffer to the display
+    TRACE_LED,              // Writing the LED colours
+    TRACE_NUM_IDS
+} trace_id_t;
+
+// Record a begin (true) or end (false) event for a trace point
+// Safe to call from any task on any core, never blocks
+void trace_record(trace_id_t id, bool begin);
+
+// Print all buffered events to the console, oldest first
+// Recording is paused while dumping so the output is a consistent snapshot
+void trace_dump(void);
+
+// Discard all buffered events
+void trace_clear(void);
+
+#ifdef TRACE_ENABLED
+#define TRACE_BEGIN(id) trace_record((id), true)
+#define TRACE_END(id)   trace_record((id), false)
+#else
+#define TRACE_BEGIN(id) ((void)0)
+#define TRACE_END(id)   ((void)0)
+#endif
+
+#endif  // TRACE_H
@@ -0,0 +1,116 @@
+// Falling-notes play-along mode
+
+#include "tutorial.h"
+#include <stdint.h>
+#include "esp_timer.h"
+#include "fb_region.h"
+
+#define TUTORIAL_STEP_MS 300  // One song step (an eighth note at 100 BPM)
+#define TUTORIAL_STEP_PX 40   // Distance a note falls per step
+#define NOTE_GAP_PX      4    // Space between repeated notes
+#define NOTE_INSET_PX    4    // Space between a note and the edges of its key
+
+#define COLOR_LANE       0xFF202020
+#define COLOR_DIVIDER    0xFF404040
+#define COLOR_WHITE_NOTE 0xFF4444FF  // Same colours as a pressed key
+#define COLOR_BLACK_NOTE 0xFFFF0000
+
+typedef struct {
+    uint8_t  note;    // Index into note_defs
+    uint16_t start;   // In steps from the start of the song
+    uint8_t  length;  // In steps
+} song_note_t;
+
+// Ode to Joy, using only the keys of the on-screen keyboard
+static const song_note_t song[] = {
+    {2, 0, 2},  {2, 2, 2},  {3, 4, 2},  {4, 6, 2},  {4, 8, 2},  {3, 10, 2}, {2, 12, 2}, {1, 14, 2},
+    {0, 16, 2}, {0, 18, 2}, {1, 20, 2}, {2, 22, 2}, {2, 24, 3}, {1, 27, 1}, {1, 28, 4},
+    {2, 32, 2}, {2, 34, 2}, {3, 36, 2}, {4, 38, 2}, {4, 40, 2}, {3, 42, 2}, {2, 44, 2}, {1, 46, 2},
+    {0, 48, 2}, {0, 50, 2}, {1, 52, 2}, {2, 54, 2}, {1, 56, 3}, {0, 59, 1}, {0, 60, 4},
+};
+
+#define SONG_LENGTH   (sizeof(song) / sizeof(song[0]))
+#define SONG_END_STEP 64
+
+static pax_recti lane;                  // Screen area the notes fall through
+static pax_recti columns[NUM_NOTES];    // Key below each note, notes fall in line with it
+static int64_t   song_start_us = 0;     // esp_timer time at which the lane was empty
+static int       lane_position = 0;     // Song position (px) at the bottom row of the lane
+static size_t    first_note    = 0;     // First song note that has not left the lane yet
+static bool      lane_dirty    = true;  // Redraw the whole lane on the next frame
+
+// Helper function: Draw the top 'rows' pixel rows of the lane for the current position
+// Pixel row y of the lane shows song position lane_position + lane.h - 1 - y
+static void draw_strip(pax_buf_t* fb, int rows) {
+    pax_draw_rect(fb, COLOR_LANE, lane.x, lane.y, lane.w, rows);
+
+    // Dividers between the white key columns
+    for (int i = 1; i < 8; i++) {
+        pax_draw_rect(fb, COLOR_DIVIDER, columns[i].x - 1, lane.y, 1, rows);
+    }
+
+    // Only the notes overlapping the strip's song positions [low, high) are drawn
+    int top = lane_position + lane.h;
+    int low = top - rows;
+    for (size_t i = first_note; i < SONG_LENGTH; i++) {
+        int start = song[i].start * TUTORIAL_STEP_PX;
+        int end   = (song[i].start + song[i].length) * TUTORIAL_STEP_PX - NOTE_GAP_PX;
+        if (start >= top) break;  // The song is sorted by start
+        if (end <= low) continue;
+
+        int y0 = top - end < 0 ? 0 : top - end;
+        int y1 = top - start > rows ? rows : top - start;
+
+        pax_recti column = columns[song[i].note];
+        pax_col_t color  = note_defs[song[i].note].is_black_key ? COLOR_BLACK_NOTE : COLOR_WHITE_NOTE;
+        pax_draw_rect(fb, color, column.x + NOTE_INSET_PX, lane.y + y0, column.w - 2 * NOTE_INSET_PX, y1 - y0);
+    }
+}
+
+void tutorial_start(pax_recti lane_rect, const pax_recti keys[NUM_NOTES]) {
+    lane = lane_rect;
+    for (int i = 0; i < NUM_NOTES; i++) {
+        columns[i] = keys[i];
+    }
+    song_start_us = esp_timer_get_time();
+    lane_position = -lane.h;
+    first_note    = 0;
+    lane_dirty    = true;
+}
+
+void tutorial_invalidate(void) {
+    lane_dirty = true;
+}
+
+bool tutorial_render(pax_buf_t* fb) {
+    int64_t elapsed_ms = (esp_timer_get_time() - song_start_us) / 1000;
+    int     position   = (int)(elapsed_ms * TUTORIAL_STEP_PX / TUTORIAL_STEP_MS) - lane.h;
+
+    // Start over once the last note has fallen past the keyboard
+    if (position >= SONG_END_STEP * TUTORIAL_STEP_PX) {
+        song_start_us = esp_timer_get_time();
+        position      = -lane.h;
+        first_note    = 0;
+        lane_dirty    = true;
+    }
+
+    int scroll = position - lane_position;
+    if (scroll <= 0 && !lane_dirty) return false;
+
+    // Move what is already drawn down, then fill in the rows that scrolled into view
+    int rows = lane.h;
+    if (!lane_dirty && scroll < lane.h && fb_region_scroll(fb, lane, 0, scroll)) {
+        rows = scroll;
+    }
+    lane_position = position;
+    lane_dirty    = false;
+
+    // Notes that have fallen out of the lane are never looked at again
+    while (first_note < SONG_LENGTH &&
+           (song[first_note].start + song[first_note].length) * TUTORIAL_STEP_PX <= lane_position) {
+        first_note++;
+    }
+
+    draw_strip(fb, rows);
+    return true;
+}
@@ -0,0 +1,27 @@
+// Falling-notes play-along mode
+//
+// Notes of a built-in song fall down a lane above the on-screen keyboard and
+// reach the keys when they should be played. The song position is derived
+// from esp_timer, so a late frame never slows the song down. Each frame shifts
+// the existing lane image down in the framebuffer (see fb_region.h) and only
+// draws the few pixel rows that scrolled into view at the top, so the cost per
+// frame does not depend on how many notes are on screen.
+
+#ifndef TUTORIAL_H
+#define TUTORIAL_H
+
+#include <stdbool.h>
+#include "keyboard_notes.h"
+#include "pax_gfx.h"
+
+// Restart the song in the given lane, with one screen column per note (the key below it)
+void tutorial_start(pax_recti lane, const pax_recti keys[NUM_NOTES]);
+
+// Redraw the whole lane on the next tutorial_render() (after the screen was cleared)
+void tutorial_invalidate(void);
+
+// Advance the song to the current time and update the lane in the framebuffer
+// Returns true if the lane changed and has to be sent to the display
+bool tutorial_render(pax_buf_t* fb);
+
+#endif  // TUTORIAL_H
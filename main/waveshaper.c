@@ -0,0 +1,170 @@
+// Waveshaper (overdrive), 2x oversampled
+//
+// With h the half-band filter (length 2 * TAPS - 1, centre c = TAPS - 1) and
+// g = halfband_coeffs (its taps at even offsets from the start):
+//
+//   interpolate: up[2n]     = 2 * sum(g[i] * x[n - i])
+//                up[2n + 1] = x[n - (TAPS / 2 - 1)]        (2 * the centre tap 0.5)
+//   shape:       even[n] = curve(up[2n]), odd[n] = curve(up[2n + 1])
+//   decimate:    y[n] = sum(g[i] * even[n - i]) + 0.5 * odd[n - TAPS / 2]
+//
+// The half-band zeros make the other taps vanish, and each stage delays by
+// (TAPS - 1) / 2 base-rate frames, HALFBAND_LATENCY in total.
+
+#include "waveshaper.h"
+#include <math.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "synth.h"
+
+#define ODD_DELAY (HALFBAND_TAPS / 2 - 1)  // Input samples between the newest and the delayed phase
+
+_Static_assert(HALFBAND_TAPS % 4 == 0, "The dot products are unrolled by 4");
+
+static float curve_tables[WAVESHAPER_CURVE_COUNT][WAVESHAPER_SEGMENTS + 1];
+
+static const char* const curve_names[WAVESHAPER_CURVE_COUNT] = {
+    [WAVESHAPER_OFF]  = "off",
+    [WAVESHAPER_TANH] = "tanh",
+    [WAVESHAPER_SOFT] = "soft",
+    [WAVESHAPER_HARD] = "hard",
+};
+
+void waveshaper_init_tables(void) {
+    for (int i = 0; i <= WAVESHAPER_SEGMENTS; i++) {
+        float x = -WAVESHAPER_RANGE + 2.0f * WAVESHAPER_RANGE * i / WAVESHAPER_SEGMENTS;
+        float c = fminf(fmaxf(x, -1.0f), 1.0f);
+        curve_tables[WAVESHAPER_OFF][i]  = x;
+        curve_tables[WAVESHAPER_TANH][i] = tanhf(x);
+        curve_tables[WAVESHAPER_SOFT][i] = 1.5f * (c - c * c * c / 3.0f);
+        curve_tables[WAVESHAPER_HARD][i] = c;
+    }
+}
+
+bool waveshaper_params_valid(const waveshaper_params_t* params) {
+    if (params->curve < 0 || params->curve >= WAVESHAPER_CURVE_COUNT) return false;
+    if (!(params->drive >= 1.0f && params->drive <= 32.0f)) return false;
+    if (!(params->level >= 0.0f && params->level <= 1.0f)) return false;
+    return true;
+}
+
+const char* waveshaper_curve_name(waveshaper_curve_t curve) {
+    if (curve < 0 || curve >= WAVESHAPER_CURVE_COUNT) return "?";
+    return curve_names[curve];
+}
+
+void waveshaper_init(waveshaper_t* shaper, int channels) {
+    shaper->channels = channels;
+    waveshaper_reset(shaper);
+}
+
+void waveshaper_reset(waveshaper_t* shaper) {
+    shaper->drive = 0.0f;
+    shaper->level = 0.0f;
+    shaper->curve = WAVESHAPER_OFF;
+    memset(shaper->channel, 0, shaper->channels * sizeof(waveshaper_channel_t));
+}
+
+// Helper function: Half-band branch dot product over the newest HALFBAND_TAPS samples ending at 'x'
+static inline float halfband_branch(const float* x) {
+    const float* start = x - (HALFBAND_TAPS - 1);
+    float        s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+    for (int tap = 0; tap < HALFBAND_TAPS; tap += 4) {
+        s0 += start[tap] * halfband_coeffs[tap];
+        s1 += start[tap + 1] * halfband_coeffs[tap + 1];
+        s2 += start[tap + 2] * halfband_coeffs[tap + 2];
+        s3 += start[tap + 3] * halfband_coeffs[tap + 3];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+// Helper function: Curve lookup with linear interpolation, clamped to the table
+static inline float shape(const float* table, float x) {
+    const float scale    = WAVESHAPER_SEGMENTS / (2.0f * WAVESHAPER_RANGE);
+    float       position = fminf(fmaxf((x + WAVESHAPER_RANGE) * scale, 0.0f), WAVESHAPER_SEGMENTS - 0.001f);
+    int         index    = (int)position;
+    float       frac     = position - index;
+    return table[index] + (table[index + 1] - table[index]) * frac;
+}
+
+// Helper function: Oversample, shape and decimate one chunk of one channel
+// 'buffer' points at the channel's first sample, 'stride' samples apart
+static void process_channel(waveshaper_channel_t* state, const float* table, float* buffer, int stride, int count,
+                            float drive, float drive_step, float level, float level_step) {
+    float* input = state->input;
+    float* even  = state->even;
+    float* odd   = state->odd;
+
+    for (int i = 0; i < count; i++) input[HALFBAND_TAPS + i] = buffer[i * stride];
+
+    // Interpolate and shape, both 2x phases of every frame
+    for (int i = 0; i < count; i++) {
+        float up_even               = 2.0f * halfband_branch(&input[HALFBAND_TAPS + i]);
+        float up_odd                = input[HALFBAND_TAPS + i - ODD_DELAY];
+        even[HALFBAND_TAPS + i]     = shape(table, up_even * drive);
+        odd[HALFBAND_TAPS / 2 + i]  = shape(table, up_odd * drive);
+        drive                      += drive_step;
+    }
+
+    // Decimate
+    for (int i = 0; i < count; i++) {
+        float y                  = halfband_branch(&even[HALFBAND_TAPS + i]) + 0.5f * odd[i];
+        buffer[i * stride]  = y * level;
+        level              += level_step;
+    }
+
+    // Keep the newest samples as history for the next chunk
+    memmove(input, &input[count], HALFBAND_TAPS * sizeof(float));
+    memmove(even, &even[count], HALFBAND_TAPS * sizeof(float));
+    memmove(odd, &odd[count], HALFBAND_TAPS / 2 * sizeof(float));
+}
+
+void waveshaper_process(waveshaper_t* shaper, const waveshaper_params_t* params, float* buffer, int frames) {
+    if (params->curve != shaper->curve) {
+        // Start over from silence, with the new gains, rather than filtering through another curve's history
+        waveshaper_reset(shaper);
+        shaper->curve = params->curve;
+        shaper->drive = params->drive;
+        shaper->level = params->level;
+    }
+    if (params->curve == WAVESHAPER_OFF) return;
+
+    const float* table    = curve_tables[params->curve];
+    const int    channels = shaper->channels;
+    for (int done = 0; done < frames; done += WAVESHAPER_CHUNK) {
+        const int   count      = frames - done < WAVESHAPER_CHUNK ? frames - done : WAVESHAPER_CHUNK;
+        const float drive_step = (params->drive - shaper->drive) / count;
+        const float level_step = (params->level - shaper->level) / count;
+        for (int channel = 0; channel < channels; channel++) {
+            process_channel(&shaper->channel[channel], table, buffer + done * channels + channel, channels, count,
+                            shaper->drive, drive_step, shaper->level, level_step);
+        }
+        shaper->drive = params->drive;
+        shaper->level = params->level;
+    }
+}
+
+uint32_t waveshaper_bench(int blocks) {
+    static float              buffer[FRAMES_PER_WRITE * 2];
+    const waveshaper_params_t params = {.curve = WAVESHAPER_TANH, .drive = 8.0f, .level = 0.5f};
+
+    // Internal RAM like the real state in the fast arena, freed again after the run
+    waveshaper_t* shaper = heap_caps_malloc(WAVESHAPER_SIZE(2), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (shaper == NULL) return 0;
+    waveshaper_init(shaper, 2);
+
+    for (int i = 0; i < FRAMES_PER_WRITE; i++) {
+        buffer[i * 2]     = sinf(i * 0.0627f);  // ~440 Hz at 44.1 kHz
+        buffer[i * 2 + 1] = buffer[i * 2];
+    }
+
+    // The shaper works in place, later blocks shape the output of earlier ones (still within +/-1)
+    int64_t start = esp_timer_get_time();
+    for (int block = 0; block < blocks; block++) {
+        waveshaper_process(shaper, &params, buffer, FRAMES_PER_WRITE);
+    }
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+    heap_caps_free(shaper);
+    return elapsed;
+}
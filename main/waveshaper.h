@@ -0,0 +1,87 @@
+// Waveshaper (overdrive), 2x oversampled
+//
+// Runs on a stereo bus of the effects chain or, with one channel per
+// instance, as an insert on every voice (see fx_chain.h).
+//
+// The mix is interpolated to twice the sample rate, driven into a saturation
+// curve and decimated again. Both filters are the half-band lowpass from
+// halfband_coeffs.h (generate_halfband.pl), split into its two polyphase
+// branches: one branch is a plain delay (the centre tap), the other a
+// HALFBAND_TAPS long dot product. Harmonics the curve creates up to 26.1 kHz
+// are removed before decimation instead of folding back into the audio band.
+// The shaper delays the signal by HALFBAND_LATENCY frames.
+//
+// Cost per base-rate frame and channel: two dot products of HALFBAND_TAPS
+// multiply-adds (interpolator and decimator) and two table lookups, so 96
+// multiply-adds and four lookups per stereo frame; 'bench shaper' times it.
+//
+// The curves are tables over -WAVESHAPER_RANGE .. WAVESHAPER_RANGE, read with
+// linear interpolation and flat beyond the ends.
+
+#ifndef WAVESHAPER_H
+#define WAVESHAPER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "halfband_coeffs.h"
+
+#define WAVESHAPER_CHUNK    64    // Frames filtered per pass, longer blocks are cut into chunks
+#define WAVESHAPER_SEGMENTS 512   // Table segments over the input range
+#define WAVESHAPER_RANGE    4.0f  // Table input range (+/-), the curves are flat beyond
+
+typedef enum {
+    WAVESHAPER_OFF = 0,
+    WAVESHAPER_TANH,  // tanh(x), smooth and symmetric
+    WAVESHAPER_SOFT,  // Cubic soft clip, 1.5 (x - x^3 / 3) up to +/-1
+    WAVESHAPER_HARD,  // Hard clip at +/-1
+    WAVESHAPER_CURVE_COUNT
+} waveshaper_curve_t;
+
+// Settings, any value in range may change at any time
+typedef struct {
+    waveshaper_curve_t curve;
+    float              drive;  // Gain into the curve (1 .. 32)
+    float              level;  // Gain after the curve (0 .. 1)
+} waveshaper_params_t;
+
+// Histories of one channel, newest sample last, so each dot product is contiguous
+typedef struct {
+    float input[HALFBAND_TAPS + WAVESHAPER_CHUNK];    // Base-rate input
+    float even[HALFBAND_TAPS + WAVESHAPER_CHUNK];     // Shaped 2x samples on the filtered phase
+    float odd[HALFBAND_TAPS / 2 + WAVESHAPER_CHUNK];  // Shaped 2x samples on the delayed phase
+} waveshaper_channel_t;
+
+// State, about 1 KB per channel; lives in the fast DSP arena, WAVESHAPER_SIZE(channels) bytes
+typedef struct {
+    float                drive;     // Gains reached at the end of the last chunk
+    float                level;
+    waveshaper_curve_t   curve;     // Curve the histories belong to
+    int                  channels;  // 1 (voice insert) or 2 (interleaved stereo)
+    waveshaper_channel_t channel[];
+} waveshaper_t;
+
+#define WAVESHAPER_SIZE(channels) (sizeof(waveshaper_t) + (channels) * sizeof(waveshaper_channel_t))
+
+// Fill the curve tables, call once before the first waveshaper_process()
+void waveshaper_init_tables(void);
+
+// Set up a state of WAVESHAPER_SIZE(channels) bytes, switched off and silent
+void waveshaper_init(waveshaper_t* shaper, int channels);
+
+// Check that all settings are in range
+bool waveshaper_params_valid(const waveshaper_params_t* params);
+
+// Human readable name ("off", "tanh", "soft", "hard")
+const char* waveshaper_curve_name(waveshaper_curve_t curve);
+
+// Clear the filter histories
+void waveshaper_reset(waveshaper_t* shaper);
+
+// Process 'frames' frames of interleaved samples (as many channels as the state has) in place
+// Drive and level glide to new values; a new curve (or switching on) restarts the filters from silence
+void waveshaper_process(waveshaper_t* shaper, const waveshaper_params_t* params, float* buffer, int frames);
+
+// Benchmark: time 'blocks' tanh blocks of FRAMES_PER_WRITE frames, returns microseconds
+uint32_t waveshaper_bench(int blocks);
+
+#endif  // WAVESHAPER_H
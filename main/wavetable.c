@@ -0,0 +1,514 @@
+// Runtime-loadable user wavetables
+
+#include "wavetable.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driver/sdmmc_host.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_vfs_fat.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "synth.h"
+
+#define WAVETABLE_PATH_MAX 96
+#define LOAD_QUEUE_LENGTH  (WAVETABLE_SLOTS + 2)  // A load per slot and the bank, plus a selection
+
+static const char* TAG = "wavetable";
+
+// Everything that publishes or frees a table goes through the loader task, so that no table is
+// freed between being looked up and being handed to the mixer
+typedef enum {
+    REQUEST_LOAD = 0,     // Load a file into a slot
+    REQUEST_LOAD_BANK,    // Load or build the morph bank
+    REQUEST_SELECT,       // Play a slot (or the compiled-in waveform)
+    REQUEST_SELECT_BANK,  // Play the morph bank
+} request_type_t;
+
+typedef struct {
+    request_type_t type;
+    int            slot;                      // Slot index, -1 for the compiled-in waveform (selections)
+    int            frame_length;              // Samples per frame (banks only)
+    char           path[WAVETABLE_PATH_MAX];  // Empty for the built-in bank
+} load_request_t;
+
+static wavetable_slot_t      slots[WAVETABLE_SLOTS];
+static wavetable_bank_slot_t bank_slot;
+static volatile int          selected_slot = -1;
+static volatile bool         bank_selected = false;
+static QueueHandle_t         load_queue    = NULL;
+
+// Helper function: Read a little-endian integer of 'bytes' bytes
+static uint32_t read_le(const uint8_t* data, int bytes) {
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--) value = (value << 8) | data[i];
+    return value;
+}
+
+// Helper function: Convert one sample of a WAV data chunk to -1.0 .. 1.0
+static float wav_sample(const uint8_t* data, int format, int bits) {
+    switch (bits) {
+        case 8: return (data[0] - 128) / 128.0f;  // 8-bit WAV is unsigned
+        case 16: return (int16_t)read_le(data, 2) / 32768.0f;
+        case 24: return ((int32_t)(read_le(data, 3) << 8) >> 8) / 8388608.0f;
+        default: {
+            uint32_t raw = read_le(data, 4);
+            if (format == 3) {
+                float value;
+                memcpy(&value, &raw, sizeof(value));
+                return value;
+            }
+            return (int32_t)raw / 2147483648.0f;
+        }
+    }
+}
+
+// Helper function: Decode a whole file into at most 'max_samples' float samples (first channel only)
+// Returns the number of samples, or a negative esp_err_t
+static int decode_samples(const uint8_t* file, size_t size, float* out, int max_samples) {
+    // Anything without a RIFF/WAVE header is raw signed 16-bit little-endian mono
+    if (size < 12 || memcmp(file, "RIFF", 4) != 0 || memcmp(file + 8, "WAVE", 4) != 0) {
+        int samples = (int)(size / 2);
+        if (samples < WAVETABLE_MIN_INPUT || samples > max_samples) return -ESP_ERR_INVALID_SIZE;
+        for (int i = 0; i < samples; i++) out[i] = (int16_t)read_le(file + i * 2, 2) / 32768.0f;
+        return samples;
+    }
+
+    int    format = 0, channels = 0, bits = 0;
+    size_t offset = 12;
+    while (offset + 8 <= size) {
+        const uint8_t* chunk      = file + offset;
+        size_t         chunk_size = read_le(chunk + 4, 4);
+        if (chunk_size > size - offset - 8) return -ESP_ERR_INVALID_SIZE;  // Truncated file
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && chunk_size >= 16) {
+            format   = read_le(chunk + 8, 2);
+            channels = read_le(chunk + 10, 2);
+            bits     = read_le(chunk + 22, 2);
+            if (format == 0xFFFE && chunk_size >= 26) format = read_le(chunk + 32, 2);  // WAVE_FORMAT_EXTENSIBLE
+        } else if (memcmp(chunk, "data", 4) == 0) {
+            bool is_pcm   = format == 1 && (bits == 8 || bits == 16 || bits == 24 || bits == 32);
+            bool is_float = format == 3 && bits == 32;
+            if (!(is_pcm || is_float) || channels < 1) return -ESP_ERR_NOT_SUPPORTED;
+
+            int frame_bytes = channels * bits / 8;
+            int samples     = (int)(chunk_size / frame_bytes);
+            if (samples < WAVETABLE_MIN_INPUT || samples > max_samples) return -ESP_ERR_INVALID_SIZE;
+            for (int i = 0; i < samples; i++) out[i] = wav_sample(chunk + 8 + i * frame_bytes, format, bits);
+            return samples;
+        }
+        offset += 8 + chunk_size + (chunk_size & 1);  // Chunks are padded to even sizes
+    }
+    return -ESP_ERR_NOT_FOUND;  // No data chunk
+}
+
+// Helper function: Build all mip levels from one cycle of 'length' samples
+// The cycle's spectrum is taken with a direct DFT (fine for a background task)
+// and resynthesised at WAVETABLE_LENGTH samples, dropping DC and any harmonic
+// a level cannot hold. Returns the number of harmonics kept, or a negative esp_err_t
+static int build_mips(const float* cycle, int length, wavetable_t* table) {
+    int    harmonics = length / 2 - 1;  // Leave out Nyquist, its phase is ambiguous
+    int    points    = length > WAVETABLE_LENGTH ? length : WAVETABLE_LENGTH;
+    float* sine      = malloc(sizeof(float) * points);
+    float* cosine    = malloc(sizeof(float) * points);
+    float* re        = malloc(sizeof(float) * (harmonics + 1));
+    float* im        = malloc(sizeof(float) * (harmonics + 1));
+    float* level     = malloc(sizeof(float) * WAVETABLE_LENGTH);
+    int    result    = -ESP_ERR_NO_MEM;
+    if (sine == NULL || cosine == NULL || re == NULL || im == NULL || level == NULL) goto done;
+
+    if (harmonics > WAVETABLE_LENGTH / 2 - 1) harmonics = WAVETABLE_LENGTH / 2 - 1;
+
+    // Analysis: harmonic h of sample n uses table entry (h * n) modulo the source length
+    for (int i = 0; i < length; i++) {
+        sine[i]   = sinf(2.0f * (float)M_PI * i / length);
+        cosine[i] = cosf(2.0f * (float)M_PI * i / length);
+    }
+    for (int h = 1; h <= harmonics; h++) {
+        float sum_re = 0.0f, sum_im = 0.0f;
+        int   index  = 0;
+        for (int n = 0; n < length; n++) {
+            sum_re += cycle[n] * cosine[index];
+            sum_im += cycle[n] * sine[index];
+            index += h;
+            if (index >= length) index -= length;
+        }
+        re[h] = sum_re * 2.0f / length;
+        im[h] = sum_im * 2.0f / length;
+    }
+
+    // Synthesis at the table length, one level per octave of harmonics
+    for (int i = 0; i < WAVETABLE_LENGTH; i++) {
+        sine[i]   = sinf(2.0f * (float)M_PI * i / WAVETABLE_LENGTH);
+        cosine[i] = cosf(2.0f * (float)M_PI * i / WAVETABLE_LENGTH);
+    }
+    float scale = 0.0f;
+    for (int mip = 0; mip < WAVETABLE_MIPS; mip++) {
+        int limit = (WAVETABLE_LENGTH / 2) >> mip;
+        if (limit > harmonics) limit = harmonics;
+
+        float peak = 0.0f;
+        for (int n = 0; n < WAVETABLE_LENGTH; n++) {
+            float value = 0.0f;
+            int   index = 0;
+            for (int h = 1; h <= limit; h++) {
+                index = (index + n) & (WAVETABLE_LENGTH - 1);
+                value += re[h] * cosine[index] + im[h] * sine[index];
+            }
+            level[n] = value;
+            peak     = fmaxf(peak, fabsf(value));
+        }
+
+        // All levels share the scale of level 0, so notes do not jump in volume between octaves
+        if (mip == 0) {
+            if (peak < 1e-6f) {
+                result = -ESP_ERR_INVALID_STATE;  // Silent or pure DC
+                goto done;
+            }
+            scale = WAVETABLE_AMPLITUDE * 32767.0f / peak;
+        }
+        for (int n = 0; n < WAVETABLE_LENGTH; n++) {
+            float sample        = level[n] * scale;
+            table->mips[mip][n] = (int16_t)fmaxf(-32768.0f, fminf(32767.0f, lrintf(sample)));
+        }
+    }
+    result = harmonics;
+
+done:
+    free(sine);
+    free(cosine);
+    free(re);
+    free(im);
+    free(level);
+    return result;
+}
+
+// Helper function: Allocate a large buffer, in PSRAM if there is any
+static void* alloc_large(size_t size) {
+    void* buffer = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    return buffer != NULL ? buffer : malloc(size);
+}
+
+// Helper function: Read a whole file of at most 'max_size' bytes
+static esp_err_t read_file(const char* path, long max_size, uint8_t** out_data, size_t* out_size) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return ESP_ERR_NOT_FOUND;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    esp_err_t result = ESP_OK;
+    uint8_t*  data   = NULL;
+    if (size <= 0 || size > max_size) {
+        result = ESP_ERR_INVALID_SIZE;
+    } else if ((data = alloc_large(size)) == NULL) {
+        result = ESP_ERR_NO_MEM;
+    } else if (fread(data, 1, size, file) != (size_t)size) {
+        result = ESP_FAIL;
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+
+    *out_data = data;
+    *out_size = (size_t)size;
+    return result;
+}
+
+// Helper function: Load and build one table, returns ESP_OK or the reason it failed
+static esp_err_t load_table(const char* path, wavetable_t** out_table, int* out_length, int* out_harmonics) {
+    // A WAV cycle of WAVETABLE_MAX_INPUT samples needs at most this much, plus headers
+    uint8_t*  data = NULL;
+    size_t    size = 0;
+    esp_err_t res  = read_file(path, WAVETABLE_MAX_INPUT * 8L * 4 + 4096, &data, &size);
+    if (res != ESP_OK) return res;
+
+    float*       cycle  = malloc(sizeof(float) * WAVETABLE_MAX_INPUT);
+    wavetable_t* table  = alloc_large(sizeof(wavetable_t));
+    esp_err_t    result = ESP_OK;
+    if (cycle == NULL || table == NULL) {
+        result = ESP_ERR_NO_MEM;
+    } else {
+        int length = decode_samples(data, size, cycle, WAVETABLE_MAX_INPUT);
+        int built  = length < 0 ? length : build_mips(cycle, length, table);
+        if (built < 0) {
+            result = -built;
+        } else {
+            *out_table     = table;
+            *out_length    = length;
+            *out_harmonics = built;
+            table          = NULL;  // Handed over
+        }
+    }
+
+    free(data);
+    free(cycle);
+    free(table);
+    return result;
+}
+
+// Helper function: Fill 'samples' with the built-in bank, one pulse cycle per frame
+static int build_pulse_frames(float* samples, int frame_length) {
+    for (int frame = 0; frame < WAVETABLE_BANK_MAX; frame++) {
+        float duty = 0.5f - 0.48f * frame / (WAVETABLE_BANK_MAX - 1);
+        int   high = (int)lrintf(duty * frame_length);
+        for (int n = 0; n < frame_length; n++) samples[frame * frame_length + n] = n < high ? 1.0f : -1.0f;
+    }
+    return WAVETABLE_BANK_MAX * frame_length;
+}
+
+// Helper function: Load (or build, for a NULL path) a morph bank, returns ESP_OK or the reason it failed
+static esp_err_t load_bank(const char* path, int frame_length, wavetable_bank_t** out_bank) {
+    const int max_samples = WAVETABLE_BANK_MAX * frame_length;
+    uint8_t*  data        = NULL;
+    size_t    size        = 0;
+    if (path != NULL) {
+        esp_err_t res = read_file(path, max_samples * 8L * 4 + 4096, &data, &size);
+        if (res != ESP_OK) return res;
+    }
+
+    float*            samples = alloc_large(sizeof(float) * max_samples);
+    wavetable_bank_t* bank    = NULL;
+    esp_err_t         result  = ESP_OK;
+    if (samples == NULL) {
+        result = ESP_ERR_NO_MEM;
+        goto done;
+    }
+
+    int length = path != NULL ? decode_samples(data, size, samples, max_samples)
+                              : build_pulse_frames(samples, frame_length);
+    if (length < 0) {
+        result = -length;
+        goto done;
+    }
+    int frames = length / frame_length;  // A partial frame at the end is ignored
+    if (frames < 2) {
+        result = ESP_ERR_INVALID_SIZE;
+        goto done;
+    }
+
+    bank = alloc_large(sizeof(wavetable_bank_t) + frames * sizeof(wavetable_t));
+    if (bank == NULL) {
+        result = ESP_ERR_NO_MEM;
+        goto done;
+    }
+    bank->frames = frames;
+    for (int frame = 0; frame < frames; frame++) {
+        int built = build_mips(&samples[frame * frame_length], frame_length, &bank->tables[frame]);
+        if (built == -ESP_ERR_INVALID_STATE) {
+            memset(&bank->tables[frame], 0, sizeof(wavetable_t));  // A silent frame stays silent
+        } else if (built < 0) {
+            result = -built;
+            goto done;
+        }
+    }
+    *out_bank = bank;
+    bank      = NULL;  // Handed over
+
+done:
+    free(data);
+    free(samples);
+    free(bank);
+    return result;
+}
+
+// Helper function: Base name of a path, for display
+static const char* base_name(const char* path) {
+    const char* slash = strrchr(path, '/');
+    return slash != NULL ? slash + 1 : path;
+}
+
+// Helper function: Build a requested morph bank and swap it in
+static void handle_bank_request(const load_request_t* request) {
+    const char*       path  = request->path[0] != '\0' ? request->path : NULL;
+    wavetable_bank_t* bank  = NULL;
+    int64_t           start = esp_timer_get_time();
+    esp_err_t         res   = load_bank(path, request->frame_length, &bank);
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Loading bank %s failed: %s", path != NULL ? path : "pulse", esp_err_to_name(res));
+        bank_slot.error = res;
+        bank_slot.state = bank_slot.bank != NULL ? WAVETABLE_READY : WAVETABLE_FAILED;
+        return;
+    }
+
+    const wavetable_bank_t* old = bank_slot.bank;
+    bank_slot.bank              = bank;
+    bank_slot.frame_length      = request->frame_length;
+    bank_slot.error             = ESP_OK;
+    snprintf(bank_slot.name, sizeof(bank_slot.name), "%.*s", WAVETABLE_NAME_MAX - 1,
+             path != NULL ? base_name(path) : "pulse");
+    bank_slot.state = WAVETABLE_READY;
+    if (bank_selected) synth_set_wavetable_bank(bank);
+    if (old != NULL) {
+        synth_wait_switch();  // Even when deselected, the mixer may have taken it a block ago
+        free((void*)old);
+    }
+
+    ESP_LOGI(TAG, "Loaded bank %s: %d frames of %d samples, %lld ms", bank_slot.name, bank->frames,
+             request->frame_length, (long long)((esp_timer_get_time() - start) / 1000));
+}
+
+// Helper function: Load a file into a slot and swap it in
+static void handle_load_request(const load_request_t* request) {
+    wavetable_slot_t* slot = &slots[request->slot];
+
+    wavetable_t* table     = NULL;
+    int          length    = 0;
+    int          harmonics = 0;
+    int64_t      start     = esp_timer_get_time();
+    esp_err_t    res       = load_table(request->path, &table, &length, &harmonics);
+    if (res != ESP_OK) {
+        ESP_LOGE(TAG, "Loading %s failed: %s", request->path, esp_err_to_name(res));
+        slot->error = res;
+        slot->state = slot->table != NULL ? WAVETABLE_READY : WAVETABLE_FAILED;
+        return;
+    }
+
+    // Swap the new table in; the mixer may still hold the old one, so wait until it has let go
+    const wavetable_t* old = slot->table;
+    slot->table            = table;
+    slot->source_length    = length;
+    slot->harmonics        = harmonics;
+    slot->error            = ESP_OK;
+    snprintf(slot->name, sizeof(slot->name), "%.*s", WAVETABLE_NAME_MAX - 1, base_name(request->path));
+    slot->state = WAVETABLE_READY;
+    if (selected_slot == request->slot) synth_set_wavetable(table);
+    if (old != NULL) {
+        synth_wait_switch();
+        free((void*)old);
+    }
+
+    ESP_LOGI(TAG, "Loaded %s into slot %d: %d samples, %d harmonics, %lld ms", slot->name, request->slot, length,
+             harmonics, (long long)((esp_timer_get_time() - start) / 1000));
+}
+
+// Helper function: Switch the mixer to a slot, the compiled-in waveform or the bank
+static void handle_select_request(const load_request_t* request) {
+    if (request->type == REQUEST_SELECT_BANK) {
+        if (bank_slot.bank == NULL) {
+            ESP_LOGW(TAG, "No morph bank to select");
+            return;
+        }
+        bank_selected = true;
+        synth_set_wavetable_bank(bank_slot.bank);
+        return;
+    }
+    const wavetable_t* table = NULL;
+    if (request->slot != -1) {
+        table = slots[request->slot].table;
+        if (table == NULL) {
+            ESP_LOGW(TAG, "Slot %d has no table to select", request->slot);
+            return;
+        }
+    }
+    selected_slot = request->slot;
+    bank_selected = false;
+    synth_set_wavetable(table);
+    synth_set_wavetable_bank(NULL);
+}
+
+static void wavetable_task(void* arg) {
+    load_request_t request;
+    while (1) {
+        if (xQueueReceive(load_queue, &request, portMAX_DELAY) != pdTRUE) continue;
+        switch (request.type) {
+            case REQUEST_LOAD: handle_load_request(&request); break;
+            case REQUEST_LOAD_BANK: handle_bank_request(&request); break;
+            case REQUEST_SELECT:
+            case REQUEST_SELECT_BANK: handle_select_request(&request); break;
+        }
+    }
+}
+
+void wavetable_start(void) {
+    load_queue = xQueueCreate(LOAD_QUEUE_LENGTH, sizeof(load_request_t));
+
+    // Idle priority on core 0: building tables only uses time nothing else wants
+    xTaskCreatePinnedToCore(wavetable_task, "wavetable", 4096, NULL, tskIDLE_PRIORITY, NULL, 0);
+}
+
+esp_err_t wavetable_mount_sd(void) {
+    sdmmc_host_t                     host         = SDMMC_HOST_DEFAULT();
+    sdmmc_slot_config_t              slot_config  = SDMMC_SLOT_CONFIG_DEFAULT();
+    esp_vfs_fat_sdmmc_mount_config_t mount_config = {
+        .format_if_mount_failed = false,
+        .max_files              = 2,
+        .allocation_unit_size   = 0,
+    };
+    sdmmc_card_t* card = NULL;
+    slot_config.width  = 4;
+    return esp_vfs_fat_sdmmc_mount("/sd", &host, &slot_config, &mount_config, &card);
+}
+
+esp_err_t wavetable_load(int slot, const char* path) {
+    if (slot < 0 || slot >= WAVETABLE_SLOTS || path == NULL) return ESP_ERR_INVALID_ARG;
+    if (strlen(path) >= WAVETABLE_PATH_MAX) return ESP_ERR_INVALID_SIZE;
+    if (load_queue == NULL) return ESP_ERR_INVALID_STATE;
+
+    load_request_t request = {.type = REQUEST_LOAD, .slot = slot};
+    snprintf(request.path, sizeof(request.path), "%s", path);
+    slots[slot].state = WAVETABLE_LOADING;
+    if (xQueueSend(load_queue, &request, 0) != pdTRUE) {
+        slots[slot].state = slots[slot].table != NULL ? WAVETABLE_READY : WAVETABLE_EMPTY;
+        return ESP_ERR_NO_MEM;  // Too many loads queued
+    }
+    return ESP_OK;
+}
+
+// Helper function: Queue a selection behind any load in progress
+static esp_err_t queue_select(request_type_t type, int slot) {
+    if (load_queue == NULL) return ESP_ERR_INVALID_STATE;
+    load_request_t request = {.type = type, .slot = slot};
+    return xQueueSend(load_queue, &request, 0) == pdTRUE ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t wavetable_select(int slot) {
+    if (slot < -1 || slot >= WAVETABLE_SLOTS) return ESP_ERR_INVALID_ARG;
+    if (slot != -1 && slots[slot].state != WAVETABLE_READY && slots[slot].state != WAVETABLE_LOADING) {
+        return ESP_ERR_INVALID_STATE;  // Nothing loaded or on its way
+    }
+    return queue_select(REQUEST_SELECT, slot);
+}
+
+int wavetable_selected(void) {
+    return selected_slot;
+}
+
+esp_err_t wavetable_load_bank(const char* path, int frame_length) {
+    if (frame_length < WAVETABLE_MIN_INPUT || frame_length > WAVETABLE_MAX_INPUT) return ESP_ERR_INVALID_ARG;
+    if (path != NULL && strlen(path) >= WAVETABLE_PATH_MAX) return ESP_ERR_INVALID_SIZE;
+    if (load_queue == NULL) return ESP_ERR_INVALID_STATE;
+
+    load_request_t request = {.type = REQUEST_LOAD_BANK, .frame_length = frame_length};
+    if (path != NULL) snprintf(request.path, sizeof(request.path), "%s", path);
+    bank_slot.state = WAVETABLE_LOADING;
+    if (xQueueSend(load_queue, &request, 0) != pdTRUE) {
+        bank_slot.state = bank_slot.bank != NULL ? WAVETABLE_READY : WAVETABLE_EMPTY;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t wavetable_select_bank(void) {
+    if (bank_slot.state != WAVETABLE_READY && bank_slot.state != WAVETABLE_LOADING) return ESP_ERR_INVALID_STATE;
+    return queue_select(REQUEST_SELECT_BANK, 0);
+}
+
+bool wavetable_bank_selected(void) {
+    return bank_selected;
+}
+
+const wavetable_bank_slot_t* wavetable_get_bank(void) {
+    return &bank_slot;
+}
+
+const wavetable_slot_t* wavetable_get_slot(int slot) {
+    if (slot < 0 || slot >= WAVETABLE_SLOTS) return NULL;
+    return &slots[slot];
+}
@@ -0,0 +1,104 @@
+// Runtime-loadable user wavetables
+//
+// Single-cycle waveforms are read from a FAT volume (internal flash or SD card)
+// as .wav (8/16/24/32-bit PCM or 32-bit float, first channel) or as raw signed
+// 16-bit little-endian samples. A low priority loader task on core 0 takes the
+// harmonic spectrum of the cycle, rebuilds it at WAVETABLE_LENGTH samples with
+// one band-limited mip level per octave, normalises it and stores the result
+// in PSRAM in the mixer's int16 format. Selecting a loaded slot is a pointer
+// swap, the audio task never touches a file.
+//
+// A morph bank is a file of consecutive cycles (frames) of equal length, built
+// the same way frame by frame. The mixer plays it with one phase accumulator
+// per voice and crossfades between the two frames around the morph position.
+
+#ifndef WAVETABLE_H
+#define WAVETABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+#define WAVETABLE_LENGTH    2048  // Samples per cycle (power of two)
+#define WAVETABLE_MIPS      11    // Level k keeps harmonics up to WAVETABLE_LENGTH / 2 >> k
+#define WAVETABLE_SLOTS     8     // Tables cached at the same time
+#define WAVETABLE_MIN_INPUT 16    // Shortest accepted cycle in samples
+#define WAVETABLE_MAX_INPUT 8192  // Longest accepted cycle in samples
+#define WAVETABLE_AMPLITUDE 0.5f  // Peak after normalisation, same headroom as the built-in wave
+#define WAVETABLE_NAME_MAX  32
+#define WAVETABLE_BANK_MAX  64    // Most frames in a morph bank
+
+// One cycle at every mip level, in the mixer's format (value / 32768 = sample)
+typedef struct {
+    int16_t mips[WAVETABLE_MIPS][WAVETABLE_LENGTH];
+} wavetable_t;
+
+// Frames of a morph bank, each one normalised on its own so the level stays even across the morph
+typedef struct {
+    int         frames;    // 2 to WAVETABLE_BANK_MAX
+    wavetable_t tables[];  // 'frames' entries
+} wavetable_bank_t;
+
+typedef enum {
+    WAVETABLE_EMPTY = 0,
+    WAVETABLE_LOADING,  // Queued or being built by the loader task
+    WAVETABLE_READY,
+    WAVETABLE_FAILED,
+} wavetable_state_t;
+
+typedef struct {
+    wavetable_state_t  state;
+    esp_err_t          error;                     // Reason of the last failure
+    char               name[WAVETABLE_NAME_MAX];  // File name the slot was loaded from
+    int                source_length;             // Samples per cycle in the file
+    int                harmonics;                 // Harmonics kept at mip level 0
+    const wavetable_t* table;                     // NULL unless READY
+} wavetable_slot_t;
+
+typedef struct {
+    wavetable_state_t       state;
+    esp_err_t               error;                     // Reason of the last failure
+    char                    name[WAVETABLE_NAME_MAX];  // File name, or "pulse" for the built-in bank
+    int                     frame_length;              // Samples per frame in the file
+    const wavetable_bank_t* bank;                      // NULL unless READY
+} wavetable_bank_slot_t;
+
+// Create the loader task
+void wavetable_start(void);
+
+// Mount the SD card on /sd (files on internal FAT volumes need no mount here)
+esp_err_t wavetable_mount_sd(void);
+
+// Queue a file for loading into a slot, returns immediately
+// The slot keeps its old table (and stays selected) until the new one is ready
+esp_err_t wavetable_load(int slot, const char* path);
+
+// Play a loaded slot, or the compiled-in waveform for slot -1
+// Queued behind any load in progress: the loader task is the only one that publishes or frees tables
+esp_err_t wavetable_select(int slot);
+int       wavetable_selected(void);
+
+// Status of a slot (0 to WAVETABLE_SLOTS - 1)
+const wavetable_slot_t* wavetable_get_slot(int slot);
+
+// Queue a morph bank for loading, the file is cut into frames of 'frame_length' samples
+// A NULL path builds the built-in bank instead, a pulse wave narrowing from 50% to 2%
+esp_err_t wavetable_load_bank(const char* path, int frame_length);
+
+// Play the morph bank (wavetable_select() switches back to a single table), queued like wavetable_select()
+esp_err_t wavetable_select_bank(void);
+bool      wavetable_bank_selected(void);
+
+// Status of the morph bank
+const wavetable_bank_slot_t* wavetable_get_bank(void);
+
+// Mip level with no harmonic above Nyquist for a note of the given frequency
+static inline int wavetable_mip_level(float frequency, float sample_rate) {
+    int level = 0;
+    while (level < WAVETABLE_MIPS - 1 && (float)((WAVETABLE_LENGTH / 2) >> level) * frequency > sample_rate / 2) {
+        level++;
+    }
+    return level;
+}
+
+#endif  // WAVETABLE_H
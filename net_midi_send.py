@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+"""
+Play the musical keyboard over the network, or stand in for it on a PC.
+
+The badge listens for network MIDI packets on UDP port 5504 once it is on
+Wi-Fi (the address is logged at startup). Send a test pattern with
+    ./net_midi_send.py send 192.168.1.42 --pattern chords --seconds 20
+and check the receiver with the 'netmidi' console command.
+
+Without a badge, run the loopback receiver in a second terminal
+    ./net_midi_send.py listen --delay 10
+    ./net_midi_send.py send 127.0.0.1 --jitter 8 --loss 2
+It applies the same clock mapping and jitter buffer as main/net_midi.c and
+prints latency and jitter statistics every second. --jitter and --loss delay
+and drop packets on purpose, to see what the jitter buffer absorbs.
+
+Packet layout (little-endian), see main/net_midi.h:
+    "NMID", uint16 sequence, uint8 event count, uint8 0, uint32 sender clock in us,
+    then per event: uint32 sender clock time to sound, 3 MIDI bytes, uint8 0
+"""
+
+import argparse
+import heapq
+import random
+import socket
+import struct
+import time
+
+PORT = 5504
+MAX_EVENTS = 32
+HEADER = struct.Struct("<4sHBBI")
+EVENT = struct.Struct("<I3sB")
+CLOCK_WRAP = 1 << 32
+KEEPALIVE_S = 0.25  # Clock-only packets between notes keep the receiver's clock window fresh
+WINDOW_US = 2000000  # Same as NET_MIDI_WINDOW_US
+MAX_AHEAD_US = 200000 + WINDOW_US  # Same as NET_MIDI_MAX_AHEAD
+
+def now_us():
+    return time.monotonic_ns() // 1000
+
+def build_pattern(name, tempo, seconds, seed):
+    """Return a list of (time in seconds, note, on) sorted by time."""
+    beat = 60.0 / tempo
+    events = []
+    rng = random.Random(seed)
+    t = 0.0
+    step = 0
+    scale = [60, 62, 64, 65, 67, 69, 71, 72]
+    chords = [[60, 64, 67], [65, 69, 72], [67, 71, 62], [60, 64, 67, 72]]
+    while t < seconds:
+        if name == "scale":
+            notes = [scale[step % len(scale)] if (step // len(scale)) % 2 == 0 else scale[-1 - step % len(scale)]]
+            length = beat / 2
+        elif name == "chords":
+            notes = chords[step % len(chords)]
+            length = beat * 0.9
+        else:
+            notes = rng.sample(range(60, 73), rng.randint(1, 4))
+            length = beat * rng.choice([0.25, 0.5, 1.0])
+        for note in notes:
+            events.append((t, note, True))
+            events.append((t + length * 0.9, note, False))
+        t += length
+        step += 1
+    events.sort(key=lambda e: (e[0], e[2]))  # Note offs first at equal times, so repeats retrigger
+    return events
+
+def build_packets(events, lead):
+    """Group events into packets, returns a list of (send time, [(event time, midi bytes)])."""
+    packets = []
+    last_send = 0.0
+    i = 0
+    while i < len(events):
+        t = events[i][0]
+        group = []
+        while i < len(events) and events[i][0] == t and len(group) < MAX_EVENTS:
+            _, note, on = events[i]
+            group.append((t, bytes([0x90 if on else 0x80, note, 100 if on else 0])))
+            i += 1
+        send = max(t - lead, 0.0)
+        while send - last_send > KEEPALIVE_S:
+            last_send += KEEPALIVE_S
+            packets.append((last_send, []))
+        packets.append((send, group))
+        last_send = send
+    return packets
+
+def cmd_send(args):
+    events = build_pattern(args.pattern, args.tempo, args.seconds, args.seed)
+    packets = build_packets(events, args.lead / 1000.0)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    rng = random.Random(args.seed)
+
+    # Every packet is stamped at its planned send time, then held back by the simulated network
+    start = now_us() + 100000
+    queue = []
+    for sequence, (send, group) in enumerate(packets):
+        sender = start + int(send * 1e6)
+        payload = HEADER.pack(b"NMID", sequence & 0xFFFF, len(group), 0, sender % CLOCK_WRAP)
+        for t, midi in group:
+            payload += EVENT.pack((start + int(t * 1e6)) % CLOCK_WRAP, midi, 0)
+        if rng.random() * 100.0 < args.loss:
+            continue
+        delay = int(rng.random() * args.jitter * 1000)
+        heapq.heappush(queue, (sender + delay, sequence, payload))
+
+    print(f"Sending {len(packets)} packets ({len(events)} events) to {args.host}:{args.port}")
+    while queue:
+        due, _, payload = heapq.heappop(queue)
+        wait = (due - now_us()) / 1e6
+        if wait > 0:
+            time.sleep(wait)
+        sock.sendto(payload, (args.host, args.port))
+    print("Done")
+
+class Receiver:
+    """Clock mapping and statistics of main/net_midi.c, for testing senders on a PC."""
+
+    def __init__(self, delay_us):
+        self.delay_us = delay_us
+        self.synced = False
+        self.reset_interval()
+
+    def reset_interval(self):
+        self.packets = 0
+        self.lost = 0
+        self.reordered = 0
+        self.events = 0
+        self.too_far_ahead = 0
+        self.late = 0
+        self.late_max = 0
+        self.transits = []
+
+    def handle(self, data, arrival):
+        if len(data) < HEADER.size:
+            return
+        magic, sequence, count, _, sender = HEADER.unpack_from(data)
+        if magic != b"NMID" or len(data) != HEADER.size + count * EVENT.size:
+            return
+
+        if self.synced:
+            sender_step = (sender - self.sender_last + CLOCK_WRAP // 2) % CLOCK_WRAP - CLOCK_WRAP // 2
+            sequence_step = (sequence - self.sequence_last - 1 + 0x8000) % 0x10000 - 0x8000
+            if abs(sender_step) > 10000000 or abs(sequence_step) > 1000:
+                self.synced = False
+        if not self.synced:
+            self.synced = True
+            self.sender_last, self.sender_time, self.sequence_last = sender, sender, sequence
+            self.window_start = arrival
+            self.offset_min = self.offset_prev = arrival - sender
+            self.transit_last = 0
+            self.jitter = 0.0
+            sender_step = sequence_step = 0
+
+        if sequence_step > 0:
+            self.lost += sequence_step
+        elif sequence_step < 0:
+            self.reordered += 1
+        if sequence_step >= 0:
+            self.sequence_last = sequence
+        sender_time = self.sender_time + sender_step
+        if sender_step > 0:
+            self.sender_last, self.sender_time = sender, sender_time
+
+        offset = arrival - sender_time
+        if arrival - self.window_start > WINDOW_US // 2:
+            self.offset_prev, self.offset_min, self.window_start = self.offset_min, offset, arrival
+        else:
+            self.offset_min = min(self.offset_min, offset)
+        self.offset_prev = min(self.offset_prev, offset)
+        base = min(self.offset_min, self.offset_prev)
+
+        transit = offset - base
+        self.jitter += (abs(transit - self.transit_last) - self.jitter) / 16.0
+        self.transit_last = transit
+        self.transits.append(transit)
+        self.packets += 1
+
+        # An event is late if it arrives after the time the jitter buffer would play it
+        for i in range(count):
+            event_time, _, _ = EVENT.unpack_from(data, HEADER.size + i * EVENT.size)
+            step = (event_time - sender + CLOCK_WRAP // 2) % CLOCK_WRAP - CLOCK_WRAP // 2
+            if step > MAX_AHEAD_US:
+                self.too_far_ahead += 1
+                continue
+            play = sender_time + step + base + self.delay_us
+            self.events += 1
+            if arrival > play:
+                self.late += 1
+                self.late_max = max(self.late_max, arrival - play)
+
+    def report(self):
+        if self.packets == 0:
+            print("No packets")
+            return
+        transits = sorted(self.transits)
+        p99 = transits[min(len(transits) - 1, int(len(transits) * 0.99))]
+        print(f"{self.packets:5d} packets, {self.lost} lost, {self.reordered} reordered | "
+              f"transit avg {sum(transits) // len(transits)} us, p99 {p99} us, max {transits[-1]} us | "
+              f"jitter {self.jitter:.0f} us | {self.events} events, {self.too_far_ahead} too far ahead, "
+              f"{self.late} late (worst {self.late_max} us)")
+        self.reset_interval()
+
+def cmd_listen(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sock.bind(("0.0.0.0", args.port))
+    sock.settimeout(0.1)
+    receiver = Receiver(int(args.delay * 1000))
+    print(f"Listening on UDP port {args.port}, playout delay {args.delay} ms (Ctrl-C to stop)")
+    next_report = time.monotonic() + 1.0
+    try:
+        while True:
+            try:
+                data = sock.recv(2048)
+                receiver.handle(data, now_us())
+            except socket.timeout:
+                pass
+            if time.monotonic() >= next_report:
+                receiver.report()
+                next_report += 1.0
+    except KeyboardInterrupt:
+        pass
+
+def main():
+    parser = argparse.ArgumentParser(description="Network MIDI sender and loopback receiver")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    send = sub.add_parser("send", help="Send a test pattern")
+    send.add_argument("host")
+    send.add_argument("--port", type=int, default=PORT)
+    send.add_argument("--pattern", choices=["scale", "chords", "random"], default="scale")
+    send.add_argument("--tempo", type=float, default=120.0, help="Beats per minute")
+    send.add_argument("--seconds", type=float, default=10.0)
+    send.add_argument("--lead", type=float, default=0.0, help="Send events this many ms ahead of time")
+    send.add_argument("--jitter", type=float, default=0.0, help="Delay packets by up to this many ms")
+    send.add_argument("--loss", type=float, default=0.0, help="Drop this percentage of packets")
+    send.add_argument("--seed", type=int, default=1)
+
+    listen = sub.add_parser("listen", help="Loopback stand-in for the badge, prints statistics")
+    listen.add_argument("--port", type=int, default=PORT)
+    listen.add_argument("--delay", type=float, default=10.0, help="Playout delay in ms")
+
+    args = parser.parse_args()
+    if args.command == "send":
+        cmd_send(args)
+    else:
+        cmd_listen(args)
+
+if __name__ == "__main__":
+    main()
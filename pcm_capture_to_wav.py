@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""
+Rebuild a WAV file from an audio capture streamed over the serial console.
+
+Start the capture with the 'capture on' console command while logging
+    idf.py monitor | tee capture.log
+stop it with 'capture off', then run
+    ./pcm_capture_to_wav.py capture.log capture.wav
+The WAV holds exactly the samples the synth handed to the I2S driver. Blocks
+the capture had to drop are filled with silence, and both dropped blocks and
+I2S underruns are listed, written as cue points into the WAV and as an
+Audacity label track (capture.txt, File > Import > Labels).
+A change of sample rate or format starts a new file (capture-1.wav, ...).
+
+The payload format is described in main/pcm_capture.h.
+"""
+
+import base64
+import struct
+import sys
+
+METHOD_VERBATIM = 0
+
+class BitReader:
+    def __init__(self, data):
+        self.bits = "".join(f"{byte:08b}" for byte in data)
+        self.position = 0
+
+    def read(self, count):
+        if count == 0:
+            return 0
+        value = int(self.bits[self.position:self.position + count], 2)
+        self.position += count
+        return value
+
+    def read_signed(self, count):
+        value = self.read(count)
+        return value - (1 << count) if value >> (count - 1) else value
+
+    def read_rice(self, k):
+        end = self.bits.index("1", self.position)
+        quotient = end - self.position
+        self.position = end + 1
+        value = (quotient << k) | self.read(k)
+        return (value >> 1) ^ -(value & 1)  # Undo the zigzag mapping
+
+def decode_channel(reader, frames, width):
+    method = reader.read(2)
+    shift = reader.read(5)
+    sample_bits = width - shift
+    if method == METHOD_VERBATIM:
+        samples = [reader.read_signed(sample_bits) for _ in range(frames)]
+    else:
+        k = reader.read(5)
+        samples = [reader.read_signed(sample_bits) for _ in range(method)]
+        for _ in range(frames - method):
+            residual = reader.read_rice(k)
+            if method == 1:
+                samples.append(samples[-1] + residual)
+            else:
+                samples.append(2 * samples[-1] - samples[-2] + residual)
+    return [s << shift for s in samples]
+
+def decode_block(payload, frames, bits):
+    """Return the interleaved samples of one block as they were in the I2S buffer."""
+    reader = BitReader(payload)
+    width = 16 if bits == 16 else 32
+    left = decode_channel(reader, frames, width)
+    right = decode_channel(reader, frames, width)
+    interleaved = [0] * (frames * 2)
+    interleaved[0::2] = left
+    interleaved[1::2] = right
+    return interleaved
+
+def parse_log(lines):
+    """Yield (block, underruns, rate, bits, frames, payload) for every intact PCM line."""
+    for line in lines:
+        start = line.find("PCM ")
+        if start < 0:
+            continue
+        parts = line[start:].split()
+        if len(parts) != 7:
+            continue  # Line mangled by other console output
+        try:
+            yield (int(parts[1]), int(parts[2]), int(parts[3]), int(parts[4]), int(parts[5]),
+                   base64.b64decode(parts[6], validate=True))
+        except ValueError:
+            continue
+
+class WavWriter:
+    """One output file: samples of one rate and format, plus markers."""
+
+    def __init__(self, path, rate, bits):
+        self.path = path
+        self.rate = rate
+        self.bits = bits
+        self.data = bytearray()
+        self.frames = 0
+        self.markers = []  # (frame, length in frames, label)
+
+    def add(self, samples):
+        if self.bits == 16:
+            self.data += struct.pack(f"<{len(samples)}h", *samples)
+        elif self.bits == 24:
+            # Left-justified in 32-bit slots on the device, written as packed 24-bit
+            for s in samples:
+                self.data += struct.pack("<i", s >> 8)[:3]
+        else:
+            self.data += struct.pack(f"<{len(samples)}i", *samples)
+        self.frames += len(samples) // 2
+
+    def add_silence(self, frames):
+        self.data += bytes(frames * 2 * (self.bits // 8))
+        self.frames += frames
+
+    def mark(self, length, label):
+        self.markers.append((self.frames, length, label))
+
+    def write(self):
+        block_align = 2 * self.bits // 8
+        fmt = struct.pack("<HHIIHH", 1, 2, self.rate, self.rate * block_align, block_align, self.bits)
+        chunks = b"fmt " + struct.pack("<I", len(fmt)) + fmt
+        chunks += b"data" + struct.pack("<I", len(self.data)) + bytes(self.data)
+        if len(self.data) % 2:
+            chunks += b"\0"
+        if self.markers:
+            cue = struct.pack("<I", len(self.markers))
+            labels = b""
+            for i, (frame, _, label) in enumerate(self.markers):
+                cue += struct.pack("<II4sIII", i + 1, frame, b"data", 0, 0, frame)
+                text = label.encode() + b"\0"
+                if len(text) % 2:
+                    text += b"\0"
+                labels += b"labl" + struct.pack("<II", 4 + len(text), i + 1) + text
+            chunks += b"cue " + struct.pack("<I", len(cue)) + cue
+            chunks += b"LIST" + struct.pack("<I", 4 + len(labels)) + b"adtl" + labels
+        with open(self.path, "wb") as f:
+            f.write(b"RIFF" + struct.pack("<I", 4 + len(chunks)) + b"WAVE" + chunks)
+
+        label_path = self.path.rsplit(".", 1)[0] + ".txt"
+        with open(label_path, "w") as f:
+            for frame, length, label in self.markers:
+                f.write(f"{frame / self.rate:.6f}\t{(frame + length) / self.rate:.6f}\t{label}\n")
+        duration = self.frames / self.rate
+        print(f"Output: {self.path} ({duration:.2f} s, {self.rate} Hz, {self.bits}-bit, "
+              f"{len(self.markers)} markers in {label_path})")
+
+def main():
+    if len(sys.argv) < 2:
+        print(f"Usage: {sys.argv[0]} <serial log> [output.wav]")
+        sys.exit(1)
+
+    input_path = sys.argv[1]
+    output_path = sys.argv[2] if len(sys.argv) > 2 else "capture.wav"
+
+    writers = []
+    writer = None
+    last_block = None
+    last_underruns = None
+    last_frames = 0
+    dropped = 0
+    underruns = 0
+    with open(input_path, "r", errors="replace") as f:
+        for block, underrun_count, rate, bits, frames, payload in parse_log(f):
+            if writer is None or rate != writer.rate or bits != writer.bits:
+                path = output_path if not writers else output_path.rsplit(".", 1)[0] + f"-{len(writers)}.wav"
+                writer = WavWriter(path, rate, bits)
+                writers.append(writer)
+                last_block = None
+            try:
+                samples = decode_block(payload, frames, bits)
+            except (ValueError, IndexError):
+                samples = None  # Corrupted on the way, treat as dropped
+
+            # Gaps in the block numbers are blocks the capture dropped, fill them with silence
+            if last_block is not None and block > last_block + 1:
+                missing = block - last_block - 1
+                writer.mark(missing * last_frames, f"dropped {missing} block(s)")
+                writer.add_silence(missing * last_frames)
+                dropped += missing
+            if samples is None:
+                writer.mark(frames, "corrupted block")
+                writer.add_silence(frames)
+                dropped += 1
+            else:
+                if last_underruns is not None and underrun_count > last_underruns:
+                    # The DMA ran dry after the previous block, so the gap is right before this one
+                    writer.mark(0, f"underrun x{underrun_count - last_underruns}")
+                    underruns += underrun_count - last_underruns
+                writer.add(samples)
+            last_block = block
+            last_underruns = underrun_count
+            last_frames = frames
+
+    if not writers:
+        print("No PCM lines found in input")
+        sys.exit(1)
+    for writer in writers:
+        writer.write()
+    print(f"Dropped blocks: {dropped}, underruns: {underruns}")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""
+Convert a trace dump captured from the serial console into Chrome trace JSON.
+
+Capture the output of trace_dump() (press F1 on the device) with
+    idf.py monitor | tee trace.log
+then run
+    ./trace_to_chrome.py trace.log trace.json
+and open trace.json in chrome://tracing or https://ui.perfetto.dev
+Each task is shown as its own timeline row, so the begin/end pairs of tasks
+that preempt each other on one core stay apart; every event carries the core
+it ran on in its arguments.
+"""
+
+import json
+import sys
+
+# Timestamps on the device are 32-bit microsecond counters
+TIMESTAMP_WRAP = 1 << 32
+
+def parse_dumps(lines):
+    """Return a list of dumps, each a pair of the task names by index and a list of
+    (timestamp, core, task, phase, name)."""
+    dumps = []
+    current = None
+    tasks = {}
+    for line in lines:
+        line = line.strip()
+        if line.startswith("TRACE-START"):
+            current = []
+            tasks = {}
+        elif line.startswith("TRACE-STOP"):
+            if current is not None:
+                dumps.append((tasks, current))
+            current = None
+        elif current is not None and line.startswith("TRACE-TASK "):
+            parts = line.split(maxsplit=2)
+            if len(parts) == 3 and parts[1].isdigit():
+                tasks[int(parts[1])] = parts[2]
+        elif current is not None and line.startswith("T "):
+            parts = line.split()
+            if len(parts) != 6:
+                continue  # Line mangled by other console output
+            _, timestamp, core, task, phase, name = parts
+            current.append((int(timestamp), int(core), int(task), phase, name))
+    return dumps
+
+def unwrap_timestamps(events):
+    """Make timestamps monotonic across a 32-bit wrap of the device clock."""
+    result = []
+    offset = 0
+    previous = None
+    for timestamp, core, task, phase, name in events:
+        if previous is not None and timestamp + offset < previous - TIMESTAMP_WRAP // 2:
+            offset += TIMESTAMP_WRAP
+        previous = timestamp + offset
+        result.append((previous, core, task, phase, name))
+    return result
+
+def main():
+    if len(sys.argv) < 2:
+        print(f"Usage: {sys.argv[0]} <serial log> [output.json]")
+        sys.exit(1)
+
+    input_path = sys.argv[1]
+    output_path = sys.argv[2] if len(sys.argv) > 2 else "trace.json"
+
+    with open(input_path, "r", errors="replace") as f:
+        dumps = parse_dumps(f)
+
+    if not dumps:
+        print("No TRACE-START/TRACE-STOP block found in input")
+        sys.exit(1)
+
+    # Use the most recent complete dump
+    tasks, events = dumps[-1]
+    events = unwrap_timestamps(events)
+    print(f"Found {len(dumps)} dump(s), converting the last one ({len(events)} events)")
+
+    base = min(e[0] for e in events) if events else 0
+    trace_events = []
+    for timestamp, core, task, phase, name in events:
+        trace_events.append({
+            "name": name,
+            "ph": phase,
+            "ts": timestamp - base,
+            "pid": 0,
+            "tid": task,
+            "args": {"core": core},
+        })
+
+    # Label the timeline rows
+    for task in sorted({e[2] for e in events}):
+        trace_events.append({
+            "name": "thread_name",
+            "ph": "M",
+            "pid": 0,
+            "tid": task,
+            "args": {"name": tasks.get(task, f"Task {task}")},
+        })
+
+    with open(output_path, "w") as f:
+        json.dump({"traceEvents": trace_events, "displayTimeUnit": "ms"}, f)
+
+    print(f"Output: {output_path}")
+
+if __name__ == "__main__":
+    main()